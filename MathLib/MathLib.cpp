@@ -5,6 +5,21 @@
 #include "Tests/DualQuaternionTests.hpp"
 #include "Tests/SceneNodeTests.hpp"
 #include "Tests/HierarchicalCoordinateSystemTests.hpp"
+#include "Tests/HierarchySnapshotTests.hpp"
+#include "Tests/SceneDeltaTests.hpp"
+#include "Tests/QuaternionCompressionTests.hpp"
+#include "Tests/AnimationTrackTests.hpp"
+#include "Tests/PoseBlenderTests.hpp"
+#include "Tests/QuaternionSplineTests.hpp"
+#include "Tests/ScrewMotionTests.hpp"
+#include "Tests/QuaternionAverageTests.hpp"
+#include "Tests/RotationIntegrationTests.hpp"
+#include "Tests/FastMathTests.hpp"
+#include "Tests/AutomaticDifferentiationTests.hpp"
+#include "Tests/HyperDualTests.hpp"
+#include "Tests/InverseKinematicsTests.hpp"
+#include "Tests/AdjointTapeTests.hpp"
+#include "Tests/EulerAnglesTests.hpp"
 #include "Tests/AngleTests.hpp"
 #include "Tests/ColorTypesTests.hpp"
 #include "Tests/ColorConversionTests.hpp"
@@ -24,6 +39,21 @@ int main()
     DualQuaternionTests::Run();
     SceneNodeTests::Run();
     HierarchicalCoordinateSystemTests::Run();
+    HierarchySnapshotTests::Run();
+    SceneDeltaTests::Run();
+    QuaternionCompressionTests::Run();
+    AnimationTrackTests::Run();
+    PoseBlenderTests::Run();
+    QuaternionSplineTests::Run();
+    ScrewMotionTests::Run();
+    QuaternionAverageTests::Run();
+    RotationIntegrationTests::Run();
+    FastMathTests::Run();
+    AutomaticDifferentiationTests::Run();
+    HyperDualTests::Run();
+    InverseKinematicsTests::Run();
+    AdjointTapeTests::Run();
+    EulerAnglesTests::Run();
     Vector2DTests::Run();
     Vector3DTests::Run();
 
@@ -0,0 +1,190 @@
+#include "AdjointTapeTests.hpp"
+#include "math/AdjointTape.hpp"
+#include "math/DualQuaternion.hpp"
+#include "math/Checks.hpp"
+#include <cassert>
+#include <cmath>
+#include <iostream>
+
+
+/** @file
+ * 
+ *  @hideincludegraph
+ */
+
+/** @defgroup AdjointTapeTests AdjointTape Unit Tests
+ * 
+ *  Here are all the unit tests used to exercise the AdjointTape and Adjoint classes
+ * 
+ *  @ingroup UnitTests
+ * 
+ *  @{
+ */
+
+/** Contains the unit tests for AdjointTape and Adjoint
+ * 
+ */
+namespace AdjointTapeTests
+{
+
+using namespace Math;
+
+void OperationsRecordTheirPartialDerivatives()
+{
+    std::cout << __func__ << std::endl;
+
+    AdjointTape<double> tape;
+    const Adjointd      x{ tape.variable( 1.5 ) };
+    const Adjointd      y{ tape.variable( -0.5 ) };
+    const Adjointd      f{ x * y + x / y - sin( x * y ) + 2.0 * exp( y ) };
+
+    CHECK_IF_EQUAL( f.real, 1.5 * -0.5 + 1.5 / -0.5 - std::sin( 1.5 * -0.5 ) + 2.0 * std::exp( -0.5 ), 1e-12f );
+
+    tape.propagate( f );
+
+    // df/dx = y + 1/y - y cos(xy) and df/dy = x - x/y^2 - x cos(xy) + 2 e^y
+    CHECK_IF_EQUAL( tape.adjoint( x ), -0.5 + 1.0 / -0.5 + 0.5 * std::cos( -0.75 ), 1e-12f );
+    CHECK_IF_EQUAL( tape.adjoint( y ), 1.5 - 1.5 / 0.25 - 1.5 * std::cos( -0.75 ) + 2.0 * std::exp( -0.5 ), 1e-12f );
+}
+
+void ConstantsAreNotRecorded()
+{
+    std::cout << __func__ << std::endl;
+
+    AdjointTape<double> tape;
+    const Adjointd      constant{ 3.0 };
+    const Adjointd      x{ tape.variable( 2.0 ) };
+    const std::size_t   size = tape.size();
+    const Adjointd      folded{ constant * constant + sqrt( constant ) };
+
+    assert( folded.tape == nullptr );
+    assert( tape.size() == size );
+
+    // One operand being a constant still records a node, with one partial derivative
+    const Adjointd product{ x * constant };
+
+    assert( product.tape == &tape );
+    assert( tape.size() == size + 1 );
+
+    tape.propagate( product );
+    CHECK_IF_EQUAL( tape.adjoint( x ), 3.0, 1e-12f );
+    CHECK_IF_ZERO( tape.adjoint( constant ), 1e-12f );
+}
+
+void AdjointsAddUpUntilCleared()
+{
+    std::cout << __func__ << std::endl;
+
+    AdjointTape<double> tape;
+    const Adjointd      x{ tape.variable( 2.0 ) };
+
+    tape.propagate( x * x );
+    tape.propagate( x * 3.0 );
+    CHECK_IF_EQUAL( tape.adjoint( x ), 4.0 + 3.0, 1e-12f );
+
+    tape.clearAdjoints();
+    CHECK_IF_ZERO( tape.adjoint( x ), 1e-12f );
+}
+
+void RewindingToACheckpointKeepsWhatCameBefore()
+{
+    std::cout << __func__ << std::endl;
+
+    AdjointTape<double> tape;
+    const Adjointd      x{ tape.variable( 2.0 ) };
+    const Adjointd      y{ tape.variable( 5.0 ) };
+    const auto          checkpoint = tape.checkpoint();
+
+    // Differentiate x^2 y + x y^2 one term at a time
+    tape.propagate( x * x * y, checkpoint );
+    tape.rewind( checkpoint );
+    assert( tape.size() == checkpoint );
+
+    tape.propagate( x * y * y, checkpoint );
+    tape.rewind( checkpoint );
+    assert( tape.size() == checkpoint );
+
+    CHECK_IF_EQUAL( tape.adjoint( x ), 2.0 * 2.0 * 5.0 + 5.0 * 5.0, 1e-12f );
+    CHECK_IF_EQUAL( tape.adjoint( y ), 2.0 * 2.0 + 2.0 * 2.0 * 5.0, 1e-12f );
+}
+
+void ClearingKeepsTheMemory()
+{
+    std::cout << __func__ << std::endl;
+
+    AdjointTape<double> tape{ 16 };
+    auto                record = [&tape]()
+        {
+            Adjointd total{ tape.variable( 0.5 ) };
+
+            for (int i = 0; i < 100; ++i)
+                total = total * total + 0.25;
+            return total;
+        };
+
+    tape.propagate( record() );
+
+    const std::size_t size = tape.size();
+    const std::size_t capacity = tape.capacity();
+
+    assert( capacity >= size && size > 100 );
+
+    tape.clear();
+    assert( tape.size() == 1 );
+    assert( tape.capacity() == capacity );
+
+    tape.propagate( record() );
+    assert( tape.size() == size );
+    assert( tape.capacity() == capacity );
+}
+
+void WorksAsTheScalarOfDualQuaternions()
+{
+    std::cout << __func__ << std::endl;
+
+    using Scalar = Adjointd;
+
+    // Two joints that turn about z with links 2 and 1 long, as in a planar arm
+    const double        shoulder = 0.3;
+    const double        elbow = 0.7;
+    AdjointTape<double> tape;
+    const Scalar        angles[] = { tape.variable( shoulder ), tape.variable( elbow ) };
+    const Vector3D<Scalar> axis{ Vector3D<Scalar>::unit_z() };
+
+    const DualQuaternion<Scalar> upper_arm{ DualQuaternion<Scalar>::make_coordinate_system( Quaternion<Scalar>::make_rotation( Radian<Scalar>{ angles[0] }, axis ), Scalar{}, Scalar{}, Scalar{} ) };
+    const DualQuaternion<Scalar> forearm{ DualQuaternion<Scalar>::make_coordinate_system( Quaternion<Scalar>::make_rotation( Radian<Scalar>{ angles[1] }, axis ), Scalar{2.0}, Scalar{}, Scalar{} ) };
+    const DualQuaternion<Scalar> hand{ DualQuaternion<Scalar>::make_coordinate_system( Quaternion<Scalar>::identity(), Scalar{1.0}, Scalar{}, Scalar{} ) };
+    const Vector3D<Scalar>       tip{ (upper_arm * forearm * hand).translation() };
+
+    CHECK_IF_EQUAL( tip.x.real, 2.0 * std::cos( shoulder ) + std::cos( shoulder + elbow ), 1e-12f );
+
+    tape.propagate( tip.x );
+    CHECK_IF_EQUAL( tape.adjoint( angles[0] ), -2.0 * std::sin( shoulder ) - std::sin( shoulder + elbow ), 1e-12f );
+    CHECK_IF_EQUAL( tape.adjoint( angles[1] ), -std::sin( shoulder + elbow ), 1e-12f );
+
+    tape.clearAdjoints();
+    tape.propagate( tip.y );
+    CHECK_IF_EQUAL( tape.adjoint( angles[0] ), 2.0 * std::cos( shoulder ) + std::cos( shoulder + elbow ), 1e-12f );
+    CHECK_IF_EQUAL( tape.adjoint( angles[1] ), std::cos( shoulder + elbow ), 1e-12f );
+}
+/// @}
+
+/** Run all of the unit tests in this namespace
+ * 
+ */
+void Run()
+{
+    std::cout << "Running AdjointTape Tests..." << std::endl;
+
+    OperationsRecordTheirPartialDerivatives();
+    ConstantsAreNotRecorded();
+    AdjointsAddUpUntilCleared();
+    RewindingToACheckpointKeepsWhatCameBefore();
+    ClearingKeepsTheMemory();
+    WorksAsTheScalarOfDualQuaternions();
+
+    std::cout << "PASSED!" << std::endl;
+}
+
+}
+/// @}
\ No newline at end of file
@@ -0,0 +1,6 @@
+#pragma once
+
+namespace AdjointTapeTests
+{
+    void Run();
+}
\ No newline at end of file
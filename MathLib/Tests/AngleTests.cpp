@@ -1,6 +1,8 @@
 #include "AngleTests.hpp"
 #include "math/Angle.hpp"
 #include <cassert>
+#include <cmath>
+#include <cstdint>
 #include <iostream>
 #include <numbers>
 
@@ -36,11 +38,217 @@ void CommonUsage()
     TestFunctionTakingRadian( Radian{std::numbers::pi_v<float>} );
 }
 
+void SinCosComputesBothTogether()
+{
+    std::cout << __func__ << std::endl;
+
+    for (double angle : { -7.0, -PI_2, -0.3, 0.0, PI_4, 2.0, PI, 11.0 })
+    {
+        SineCosine<double> both{ sincos( Radiand{ angle } ) };
+
+        assert( approximately_equal_to( both.sin, std::sin( angle ) ) );
+        assert( approximately_equal_to( both.cos, std::cos( angle ) ) );
+
+        SineCosine<double> fast{ sincos<fast::HighPrecision>( Radiand{ angle } ) };
+
+        assert( approximately_equal_to( fast.sin, both.sin, 1e-7 ) );
+        assert( approximately_equal_to( fast.cos, both.cos, 1e-7 ) );
+    }
+
+    SineCosine<float> right_angle{ sincos( 90.0_deg_f ) };
+
+    assert( approximately_equal_to( right_angle.sin, 1.0f ) );
+    assert( approximately_equal_to( right_angle.cos, 0.0f ) );
+    assert( approximately_equal_to( sincos( Degreed{ 60.0 } ).cos, 0.5 ) );
+
+    const Radiand angles[] = { Radiand{ PI }, Radiand{ -PI_4 }, Radiand{ 0.1 } };
+    double        sines[3], cosines[3];
+
+    sincos<StandardMath, double>( angles, sines, cosines );
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        assert( sines[i] == sincos( angles[i] ).sin );
+        assert( cosines[i] == sincos( angles[i] ).cos );
+    }
+}
+
+void WrappingKeepsAnglesInOneTurn()
+{
+    std::cout << __func__ << std::endl;
+
+    for (double angle : { -1000.0, -7.0, -PI, -PI_4, -0.0, 0.0, 0.3, PI, 2.0 * PI, 11.0, 12345.6 })
+    {
+        const long double two_pi = 2.0L * std::numbers::pi_v<long double>;
+        const long double expected = std::fmod( std::fmod( (long double)angle, two_pi ) + two_pi, two_pi );
+
+        const double two_pi_wrapped = wrap_two_pi( Radiand{ angle } ).value();
+        const double pi_wrapped = wrap_pi( Radiand{ angle } ).value();
+
+        assert( 0.0 <= two_pi_wrapped && two_pi_wrapped < 2.0 * PI );
+        assert( -PI <= pi_wrapped && pi_wrapped < PI );
+        assert( approximately_equal_to( std::sin( two_pi_wrapped ), std::sin( angle ), 1e-9 ) );
+        assert( approximately_equal_to( std::cos( pi_wrapped ), std::cos( angle ), 1e-9 ) );
+        assert( approximately_equal_to( (long double)two_pi_wrapped, expected, 1e-12 ) ||
+                approximately_equal_to( (long double)two_pi_wrapped + two_pi, expected, 1e-12 ) );
+
+        const double degrees = angle * 57.0;
+
+        assert( approximately_equal_to( wrap_360( Degreed{ degrees } ).value(), std::fmod( std::fmod( degrees, 360.0 ) + 360.0, 360.0 ), 1e-9 ) );
+        assert( -180.0 <= wrap_180( Degreed{ degrees } ).value() && wrap_180( Degreed{ degrees } ).value() < 180.0 );
+    }
+
+    assert( wrap_pi( Radiand{ PI } ).value() == -PI );
+    assert( wrap_two_pi( Radiand{ 2.0 * PI } ).value() < 1e-15 );
+    assert( wrap_360( 360.0_deg_f ).value() == 0.0f );
+    assert( wrap_360( -90.0_deg_f ).value() == 270.0f );
+    assert( wrap_180( 180.0_deg_f ).value() == -180.0f );
+    assert( wrap_180( 540.5_deg_f ).value() == -179.5f );
+    assert( Degreef{ -90.0f }.modulo().value() == 270.0f );
+
+    // Taking off 2 pi in pieces keeps large float angles accurate
+    const float  large{ 10000.0f };
+    const double exact{ std::remainder( double(large), 2.0 * PI ) };
+
+    assert( approximately_equal_to( wrap_pi( Radianf{ large } ).value(), float(exact), 2e-6f ) );
+}
+
+void ShortestAngleDifferenceTakesTheShortWayAround()
+{
+    std::cout << __func__ << std::endl;
+
+    assert( approximately_equal_to( shortest_angle_difference( 350.0_deg_f, 10.0_deg_f ).value(), 20.0f ) );
+    assert( approximately_equal_to( shortest_angle_difference( 10.0_deg_f, 350.0_deg_f ).value(), -20.0f ) );
+    assert( approximately_equal_to( shortest_angle_difference( -720.0_deg_f, 90.0_deg_f ).value(), 90.0f ) );
+    assert( approximately_equal_to( shortest_angle_difference( Radiand{ 3.0 }, Radiand{ -3.0 } ).value(), 2.0 * PI - 6.0, 1e-12 ) );
+    assert( approximately_equal_to( shortest_angle_difference( Radiand{ 0.5 }, Radiand{ 0.25 } ).value(), -0.25, 1e-12 ) );
+
+    const Radiand from[] = { Radiand{ 0.0 }, Radiand{ 6.0 }, Radiand{ -100.0 } };
+    const Radiand to[] = { Radiand{ 1.0 }, Radiand{ 0.5 }, Radiand{ 100.0 } };
+    Radiand       differences[3], wrapped[3];
+
+    shortest_angle_difference<double>( from, to, differences );
+    wrap_pi<double>( to, wrapped );
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        assert( differences[i] == shortest_angle_difference( from[i], to[i] ) );
+        assert( wrapped[i] == wrap_pi( to[i] ) );
+    }
+
+    const Degreef headings[] = { Degreef{ -10.0f }, Degreef{ 370.0f }, Degreef{ 180.0f } };
+    Degreef       compass[3];
+
+    wrap_360<float>( headings, compass );
+    assert( compass[0] == 350.0f && compass[1] == 10.0f && compass[2] == 180.0f );
+}
+
+void BinaryAnglesWrapAroundThroughOverflow()
+{
+    std::cout << __func__ << std::endl;
+
+    const BinaryAngle16 three_quarters{ BinaryAngle16::half_turn() + BinaryAngle16::quarter_turn() };
+
+    assert( three_quarters.value() == 0xC000 );
+    assert( three_quarters + BinaryAngle16::half_turn() == BinaryAngle16::quarter_turn() );
+    assert( BinaryAngle16::zero() - BinaryAngle16::quarter_turn() == three_quarters );
+    assert( -three_quarters == BinaryAngle16::quarter_turn() );
+    assert( three_quarters.signedValue() == -0x4000 );
+    assert( shortest_angle_difference( BinaryAngle16{ 0xFFF0 }, BinaryAngle16{ 0x0010 } ) == 0x20 );
+    assert( shortest_angle_difference( BinaryAngle32{ 0x10u }, BinaryAngle32{ 0xFFFFFFF0u } ) == -0x20 );
+    static_assert( sizeof( BinaryAngle16 ) == 2 && sizeof( BinaryAngle32 ) == 4 );
+}
+
+void BinaryAnglesConvertWithoutLoss()
+{
+    std::cout << __func__ << std::endl;
+
+    // Every 16 bit angle survives the trip through doubles
+    for (std::uint32_t value = 0; value <= 0xFFFF; ++value)
+    {
+        const BinaryAngle16 angle{ std::uint16_t( value ) };
+
+        assert( BinaryAngle16{ static_cast<Radiand>( angle ) } == angle );
+        assert( BinaryAngle16{ static_cast<Degreed>( angle ) } == angle );
+    }
+
+    for (std::uint32_t value : { 0u, 1u, 0x12345678u, 0x80000000u, 0xFFFFFFFFu })
+    {
+        const BinaryAngle32 angle{ value };
+
+        assert( BinaryAngle32{ static_cast<Radiand>( angle ) } == angle );
+        assert( BinaryAngle32{ static_cast<Degreed>( angle ) } == angle );
+    }
+
+    assert( static_cast<Degreef>( BinaryAngle16::quarter_turn() ).value() == 90.0f );
+    assert( approximately_equal_to( static_cast<Radiand>( BinaryAngle32::half_turn() ).value(), PI, 1e-15 ) );
+
+    // Other angles are rounded to the nearest step and wrapped
+    assert( BinaryAngle16{ 90.0_deg_f } == BinaryAngle16::quarter_turn() );
+    assert( BinaryAngle16{ -90.0_deg_f } == BinaryAngle16::zero() - BinaryAngle16::quarter_turn() );
+    assert( BinaryAngle16{ Radiand{ 5.0 * PI } } == BinaryAngle16::half_turn() );
+    assert( BinaryAngle16{ Degreed{ 359.999 } } == BinaryAngle16::zero() );
+    assert( BinaryAngle16{ Degreed{ 360.0 / 65536.0 * 0.6 } }.value() == 1 );
+}
+
+void BinaryAngleTrigonometryComesFromATable()
+{
+    std::cout << __func__ << std::endl;
+
+    for (std::uint32_t value = 0; value <= 0xFFFF; value += 37)
+    {
+        const BinaryAngle16      angle{ std::uint16_t( value ) };
+        const double             radians{ static_cast<Radiand>( angle ).value() };
+        const SineCosine<double> both{ sincos<double>( angle ) };
+
+        assert( approximately_equal_to( both.sin, std::sin( radians ), 5e-6 ) );
+        assert( approximately_equal_to( both.cos, std::cos( radians ), 5e-6 ) );
+        assert( approximately_equal_to( angle.sin(), float( both.sin ), 1e-6f ) );
+    }
+
+    assert( BinaryAngle32::quarter_turn().sin() == 1.0f );
+    assert( BinaryAngle32::half_turn().cos() == -1.0f );
+    assert( BinaryAngle32::zero().sin() == 0.0f );
+
+    const BinaryAngle32 angles[] = { BinaryAngle32{ 0x01234567u }, BinaryAngle32{ 0x89ABCDEFu }, BinaryAngle32{ 0xFEDCBA98u } };
+    float               sines[3], cosines[3];
+
+    sincos<float, std::uint32_t>( angles, sines, cosines );
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        assert( sines[i] == angles[i].sin() );
+        assert( cosines[i] == angles[i].cos() );
+        assert( approximately_equal_to( sines[i], float( std::sin( static_cast<Radiand>( angles[i] ).value() ) ), 5e-6f ) );
+    }
+}
+
+void AnglesWorkInConstantExpressions()
+{
+    std::cout << __func__ << std::endl;
+
+    constexpr Radiand           right_angle{ 90.0_deg };
+    constexpr SineCosine<float> sixty{ sincos( 60.0_deg_f ) };
+
+    static_assert( approximately_equal_to( right_angle.value(), std::numbers::pi / 2.0, 1e-15 ) );
+    static_assert( approximately_equal_to( (right_angle + right_angle - Radiand{ 0.5 }).value(), std::numbers::pi - 0.5, 1e-15 ) );
+    static_assert( approximately_equal_to( sixty.cos, 0.5f ) && approximately_equal_to( sixty.sin, std::numbers::sqrt3_v<float> / 2.0f ) );
+    static_assert( wrap_360( Degreef{ -90.0f } ) == 270.0f );
+    static_assert( approximately_equal_to( wrap_pi( Radiand{ 7.0 } ).value(), 7.0 - 2.0 * std::numbers::pi, 1e-15 ) );
+    static_assert( approximately_equal_to( shortest_angle_difference( 350.0_deg, 10.0_deg ).value(), 20.0, 1e-12 ) );
+    static_assert( BinaryAngle16{ 90.0_deg } == BinaryAngle16::quarter_turn() );
+    static_assert( BinaryAngle32::half_turn().cos() == -1.0f );
+}
+
 void Run()
 {
     std::cout << "Running Angle Tests..." << std::endl;
 
     CommonUsage();
+    SinCosComputesBothTogether();
+    WrappingKeepsAnglesInOneTurn();
+    ShortestAngleDifferenceTakesTheShortWayAround();
+    BinaryAnglesWrapAroundThroughOverflow();
+    BinaryAnglesConvertWithoutLoss();
+    BinaryAngleTrigonometryComesFromATable();
+    AnglesWorkInConstantExpressions();
 
     std::cout << "PASSED!" << std::endl;
 }
@@ -0,0 +1,169 @@
+#include "AnimationTrackTests.hpp"
+#include "math/AnimationTrack.hpp"
+#include "math/Conversions.hpp"
+#include "math/Checks.hpp"
+#include <cassert>
+#include <iostream>
+
+
+/** @file
+ * 
+ *  @hideincludegraph
+ */
+
+/** @defgroup AnimationTrackTests AnimationTrack Unit Tests
+ * 
+ *  Here are all the unit tests used to exercise the AnimationTrack class
+ * 
+ *  @ingroup UnitTests
+ * 
+ *  @{
+ */
+
+/** Contains the unit tests for AnimationTrack
+ * 
+ */
+namespace AnimationTrackTests
+{
+
+using namespace Math;
+using namespace Math::Literals;
+
+static RotationTrackf GenerateSpin(int keyframe_count, float seconds_per_keyframe)
+{
+    RotationTrackf track;
+
+    for (int i = 0; i < keyframe_count; ++i)
+        track.insert( i * seconds_per_keyframe, Quaternionf::make_rotation( Degreef( 10.0f * i ), Vector3Df::unit_z() ) );
+    return track;
+}
+
+void KeyframesAreKeptInOrder()
+{
+    std::cout << __func__ << std::endl;
+
+    TranslationTrackf track{ { { 2.0f, { 2.0f, 0.0f, 0.0f } },
+                               { 0.0f, { 0.0f, 0.0f, 0.0f } },
+                               { 1.0f, { 1.0f, 0.0f, 0.0f } } } };
+
+    assert( track.size() == 3 );
+    CHECK_IF_EQUAL( track.startTime(), 0.0f );
+    CHECK_IF_EQUAL( track.endTime(), 2.0f );
+    CHECK_IF_EQUAL( track.duration(), 2.0f );
+
+    track.insert( 1.5f, { 5.0f, 0.0f, 0.0f } );
+    track.insert( 1.0f, { 3.0f, 0.0f, 0.0f } ); // Replaces
+
+    assert( track.size() == 4 );
+    CHECK_IF_EQUAL( track.keyframes()[1].value, Vector3Df( 3.0f, 0.0f, 0.0f ) );
+    CHECK_IF_EQUAL( track.keyframes()[2].time, 1.5f );
+}
+
+void SamplingInterpolatesBetweenKeyframes()
+{
+    std::cout << __func__ << std::endl;
+
+    TranslationTrackf translations{ { { 0.0f, { 0.0f, 0.0f, 0.0f } },
+                                      { 1.0f, { 2.0f, 4.0f, 0.0f } } } };
+
+    CHECK_IF_EQUAL( translations.sample( 0.25f ), Vector3Df( 0.5f, 1.0f, 0.0f ) );
+    CHECK_IF_EQUAL( translations.sample( -1.0f ), Vector3Df( 0.0f, 0.0f, 0.0f ) ); // Clamped
+    CHECK_IF_EQUAL( translations.sample( 5.0f ), Vector3Df( 2.0f, 4.0f, 0.0f ) );  // Clamped
+
+    RotationTrackf rotations{ GenerateSpin( 10, 0.5f ) };
+
+    CHECK_IF_EQUAL( rotations.sample( 1.0f ), Quaternionf::make_rotation( 20.0_deg_f, Vector3Df::unit_z() ) );
+    CHECK_IF_EQUAL( rotations.sample( 1.25f ), Quaternionf::make_rotation( 25.0_deg_f, Vector3Df::unit_z() ) );
+
+    // The shortest way round, even when the keyframes have opposite signs
+    RotationTrackf flipped{ { { 0.0f, Quaternionf::identity() },
+                              { 1.0f, -Quaternionf::make_rotation( 90.0_deg_f, Vector3Df::unit_x() ) } } };
+    Quaternionf    halfway{ flipped.sample( 0.5f ) };
+
+    if ( halfway.w() < 0.0f )
+        halfway = -halfway;
+    CHECK_IF_EQUAL( halfway, Quaternionf::make_rotation( 45.0_deg_f, Vector3Df::unit_x() ) );
+
+    TransformTrackf transforms{ { { 0.0f, DualQuaternionf{ Quaternionf::identity(), Vector3Df{ 0.0f, 0.0f, 0.0f } } },
+                                  { 1.0f, DualQuaternionf{ Quaternionf::identity(), Vector3Df{ 1.0f, 0.0f, 0.0f } } } } };
+
+    CHECK_IF_EQUAL( transforms.sample( 0.5f ).translation(), Vector3Df( 0.5f, 0.0f, 0.0f ) );
+}
+
+void CursorMatchesBinarySearch()
+{
+    std::cout << __func__ << std::endl;
+
+    RotationTrackf         track{ GenerateSpin( 30, 1.0f / 30.0f ) };
+    RotationTrackf::Cursor cursor;
+
+    // Forwards at a lower and a higher rate than the keyframes
+    for (float step : { 1.0f / 60.0f, 1.0f / 10.0f })
+    {
+        for (float time = -0.1f; time < 1.2f; time += step)
+            CHECK_IF_EQUAL( track.sample( time, cursor ), track.sample( time ) );
+    }
+
+    // Backwards
+    for (float time = 1.2f; time > -0.1f; time -= 1.0f / 45.0f)
+        CHECK_IF_EQUAL( track.sample( time, cursor ), track.sample( time ) );
+
+    // Jumping around
+    for (float time : { 0.5f, 0.1f, 0.9f, 0.3f, 0.3f })
+    {
+        CHECK_IF_EQUAL( track.sample( time, cursor ), track.sample( time ) );
+        assert( track.keyframes()[cursor.segment].time <= time );
+        assert( time < track.keyframes()[cursor.segment + 1].time );
+    }
+}
+
+void ReducingRemovesRedundantKeyframes()
+{
+    std::cout << __func__ << std::endl;
+
+    // A constant speed spin only needs its ends...
+    RotationTrackf spin{ GenerateSpin( 10, 0.1f ) };
+
+    assert( spin.reduce( 0.0001f ) == 8 );
+    CHECK_IF_EQUAL( spin.sample( 0.45f ), Quaternionf::make_rotation( 45.0_deg_f, Vector3Df::unit_z() ) );
+
+    // ...but a change of direction has to be kept
+    TranslationTrackf path;
+
+    for (int i = 0; i <= 20; ++i)
+        path.insert( i * 0.05f, Vector3Df{ i * 0.1f, (i <= 10) ? i * 0.1f : 2.0f - i * 0.1f, 0.0f } );
+
+    TranslationTrackf original{ path };
+
+    assert( path.reduce( 0.001f ) == 18 );
+    CHECK_IF_EQUAL( path.keyframes()[1].time, 0.5f );
+
+    // A looser tolerance keeps every original keyframe within it
+    TranslationTrackf wavy;
+
+    for (int i = 0; i <= 100; ++i)
+        wavy.insert( i * 0.01f, Vector3Df{ std::sin( i * 0.1f ), std::cos( i * 0.07f ), 0.0f } );
+
+    TranslationTrackf wavy_original{ wavy };
+
+    assert( wavy.reduce( 0.01f ) > 50 );
+    for (const auto &keyframe : wavy_original.keyframes())
+        assert( TranslationTrackf::distance( wavy.sample( keyframe.time ), keyframe.value ) <= 0.01f );
+}
+
+/** Run all of the unit tests in this namespace
+ * 
+ */
+void Run()
+{
+    std::cout << "Running AnimationTrack Tests..." << std::endl;
+
+    KeyframesAreKeptInOrder();
+    SamplingInterpolatesBetweenKeyframes();
+    CursorMatchesBinarySearch();
+    ReducingRemovesRedundantKeyframes();
+
+    std::cout << "PASSED!" << std::endl;
+}
+}
+/// @}
\ No newline at end of file
@@ -0,0 +1,315 @@
+#include "AutomaticDifferentiationTests.hpp"
+#include "math/AutomaticDifferentiation.hpp"
+#include "math/Checks.hpp"
+#include "math/Quaternion.hpp"
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+
+/** @file
+ * 
+ *  @hideincludegraph
+ */
+
+/** @defgroup AutomaticDifferentiationTests Automatic Differentiation Unit Tests
+ * 
+ *  Here are all the unit tests used to exercise DualN and the differentiation drivers
+ * 
+ *  @ingroup UnitTests
+ * 
+ *  @{
+ */
+
+/** Contains the unit tests for DualN and the differentiation drivers
+ * 
+ */
+namespace AutomaticDifferentiationTests
+{
+
+using namespace Math;
+
+/** Spherical to Cartesian coordinates, written once for any number type */
+auto Spherical = [](auto input, auto output)
+    {
+        const auto &radius = input[0];
+        const auto &polar = input[1];
+        const auto &azimuth = input[2];
+
+        output[0] = radius * sin( polar ) * cos( azimuth );
+        output[1] = radius * sin( polar ) * sin( azimuth );
+        output[2] = radius * cos( polar );
+        output[3] = radius * radius;
+    };
+
+/** The Jacobian of Spherical, worked out by hand */
+static std::vector<double> SphericalJacobian(double radius, double polar, double azimuth)
+{
+    return { std::sin( polar ) * std::cos( azimuth ), radius * std::cos( polar ) * std::cos( azimuth ), -radius * std::sin( polar ) * std::sin( azimuth ),
+             std::sin( polar ) * std::sin( azimuth ), radius * std::cos( polar ) * std::sin( azimuth ),  radius * std::sin( polar ) * std::cos( azimuth ),
+             std::cos( polar ),                       -radius * std::sin( polar ),                       0.0,
+             2.0 * radius,                            0.0,                                               0.0 };
+}
+
+void DualNCarriesEveryPartialDerivative()
+{
+    std::cout << __func__ << std::endl;
+
+    using Variable = DualNd<2>;
+
+    Variable x{ Variable::variable( 3.0, 0 ) };
+    Variable y{ Variable::variable( 2.0, 1 ) };
+    Variable f{ x * x * y - 4.0 / y + sin( x * y ) };
+
+    CHECK_IF_EQUAL( f.real, 9.0 * 2.0 - 2.0 + std::sin( 6.0 ) );
+    CHECK_IF_EQUAL( f.dual[0], 2.0 * 3.0 * 2.0 + 2.0 * std::cos( 6.0 ) );
+    CHECK_IF_EQUAL( f.dual[1], 9.0 + 4.0 / 4.0 + 3.0 * std::cos( 6.0 ) );
+
+    // Constants have no derivatives
+    Variable g{ (x - x) * 5.0 + 1.0 };
+
+    CHECK_IF_EQUAL( g.real, 1.0 );
+    CHECK_IF_EQUAL( g.dual[0], 0.0 );
+    CHECK_IF_EQUAL( g.dual[1], 0.0 );
+
+    // Comparisons only look at the values
+    assert( y < x && x > 2.5 && 2.5 < x );
+    assert( x == Variable{ 3.0 } );
+}
+
+void DerivativeOfAScalarFunction()
+{
+    std::cout << __func__ << std::endl;
+
+    auto function = [](auto x) { return exp( x * 0.5 ) * log( x ); };
+
+    CHECK_IF_EQUAL( derivative( function, 2.0 ), 0.5 * std::exp( 1.0 ) * std::log( 2.0 ) + std::exp( 1.0 ) / 2.0 );
+}
+
+void JacobianMatchesTheAnalyticOne()
+{
+    std::cout << __func__ << std::endl;
+
+    const double        point[] = { 2.0, 0.6, -1.1 };
+    std::vector<double> expected{ SphericalJacobian( point[0], point[1], point[2] ) };
+    std::vector<double> one_sweep( 12 ), two_sweeps( 12 ), three_sweeps( 12 );
+
+    jacobian<4, double>( Spherical, point, one_sweep );
+    jacobian<2, double>( Spherical, point, two_sweeps );
+    jacobian<1, double>( Spherical, point, three_sweeps );
+
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+        CHECK_IF_EQUAL( one_sweep[i], expected[i] );
+        CHECK_IF_EQUAL( two_sweeps[i], expected[i] );
+        CHECK_IF_EQUAL( three_sweeps[i], expected[i] );
+    }
+}
+
+void GradientOfACostFunction()
+{
+    std::cout << __func__ << std::endl;
+
+    // The squared distances between points on a line and a set of targets
+    auto cost = [](auto parameters)
+        {
+            auto total = parameters[0] * 0.0;
+
+            for (int i = 0; i < 5; ++i)
+            {
+                auto residual = parameters[0] + parameters[1] * double(i) - double(i * i);
+
+                total += residual * residual;
+            }
+            return total;
+        };
+
+    const double offset = 0.5, slope = 1.5;
+    const double point[] = { offset, slope };
+    double       output[2];
+    double       expected[2] = { 0.0, 0.0 };
+
+    for (int i = 0; i < 5; ++i)
+    {
+        double residual = offset + slope * i - i * i;
+
+        expected[0] += 2.0 * residual;
+        expected[1] += 2.0 * residual * i;
+    }
+
+    gradient<8, double>( cost, point, output );
+
+    CHECK_IF_EQUAL( output[0], expected[0] );
+    CHECK_IF_EQUAL( output[1], expected[1] );
+}
+
+void HessianOfTheRosenbrockFunction()
+{
+    std::cout << __func__ << std::endl;
+
+    // Summed over consecutive pairs of inputs
+    auto rosenbrock = [](auto input)
+        {
+            auto total = input[0] * 0.0;
+
+            for (std::size_t i = 0; i + 1 < input.size(); ++i)
+            {
+                auto a = 1.0 - input[i];
+                auto b = input[i + 1] - input[i] * input[i];
+
+                total += a * a + 100.0 * b * b;
+            }
+            return total;
+        };
+
+    const double point[] = { 0.5, -1.0, 2.0 };
+    double       matrix[9];
+    double       first_derivatives[3];
+
+    hessian<2, double>( rosenbrock, point, matrix, first_derivatives ); // The last block of the first row is partly filled
+
+    // Worked out by hand
+    const double expected[9] = { 2.0 - 400.0 * (point[1] - 3.0 * point[0] * point[0]), -400.0 * point[0], 0.0,
+                                 -400.0 * point[0], 202.0 - 400.0 * (point[2] - 3.0 * point[1] * point[1]), -400.0 * point[1],
+                                 0.0, -400.0 * point[1], 200.0 };
+
+    for (std::size_t i = 0; i < 9; ++i)
+        CHECK_IF_EQUAL( matrix[i], expected[i] );
+
+    // One lane per evaluation and all of a row in one evaluation give the same matrix
+    double unblocked[9];
+    double single_block[9];
+
+    hessian<1, double>( rosenbrock, point, unblocked );
+    hessian<8, double>( rosenbrock, point, single_block );
+    for (std::size_t i = 0; i < 9; ++i)
+    {
+        CHECK_IF_EQUAL( unblocked[i], expected[i] );
+        CHECK_IF_EQUAL( single_block[i], expected[i] );
+    }
+
+    double expected_gradient[3];
+
+    gradient<2, double>( rosenbrock, point, expected_gradient );
+    for (std::size_t i = 0; i < 3; ++i)
+        CHECK_IF_EQUAL( first_derivatives[i], expected_gradient[i] );
+
+    CHECK_IF_EQUAL( second_derivative( [](auto x) { return x * sin( x ); }, 1.2 ), 2.0 * std::cos( 1.2 ) - 1.2 * std::sin( 1.2 ) );
+}
+
+void ReverseModeGradientMatchesForwardMode()
+{
+    std::cout << __func__ << std::endl;
+
+    auto rosenbrock = [](auto input)
+        {
+            auto total = input[0] * 0.0;
+
+            for (std::size_t i = 0; i + 1 < input.size(); ++i)
+            {
+                auto a = 1.0 - input[i];
+                auto b = input[i + 1] - input[i] * input[i];
+
+                total += a * a + 100.0 * b * b;
+            }
+            return total;
+        };
+
+    std::vector<double> point( 20 );
+    std::vector<double> forward( point.size() );
+    std::vector<double> reverse( point.size() );
+    AdjointTape<double> tape;
+
+    for (std::size_t i = 0; i < point.size(); ++i)
+        point[i] = std::cos( double(i) );
+
+    gradient<8, double>( rosenbrock, point, forward );
+
+    const double value = adjoint_gradient<double>( tape, rosenbrock, point, reverse );
+
+    CHECK_IF_EQUAL( value, rosenbrock( std::span<const double>{ point } ), 1e-9f );
+    for (std::size_t i = 0; i < point.size(); ++i)
+        CHECK_IF_EQUAL( reverse[i], forward[i], 1e-9f );
+
+    // Reusing the tape doesn't allocate again
+    const std::size_t capacity = tape.capacity();
+
+    adjoint_gradient<double>( tape, rosenbrock, point, reverse );
+    assert( tape.capacity() == capacity );
+}
+
+void GradientOfASumOneTermAtATime()
+{
+    std::cout << __func__ << std::endl;
+
+    // Aligning points with their observations by a rotation vector and a translation
+    const Vector3Dd points[] = { { 1.0, 0.0, 0.0 }, { 0.0, 2.0, 0.0 }, { 0.0, 0.0, 3.0 }, { 1.0, -1.0, 0.5 } };
+    const Vector3Dd observed[] = { { 0.9, 0.3, 0.1 }, { -0.4, 2.1, 0.3 }, { 0.5, 0.2, 2.8 }, { 1.2, -0.5, 0.8 } };
+
+    auto residual = [&](std::size_t n, auto parameters)
+        {
+            using Scalar = std::remove_cvref_t<decltype( parameters[0] )>;
+
+            const Quaternion<Scalar> rotation{ Quaternion<Scalar>::make_pure( Vector3D<Scalar>{ parameters[0], parameters[1], parameters[2] } * Scalar{0.5} ).exp() };
+            const Vector3D<Scalar>   point{ Scalar{ points[n].x }, Scalar{ points[n].y }, Scalar{ points[n].z } };
+            const Vector3D<Scalar>   moved{ (rotation * Quaternion<Scalar>::encode_point( point ) * rotation.conjugate()).imaginary() };
+            const Vector3D<Scalar>   error{ moved + Vector3D<Scalar>{ parameters[3], parameters[4], parameters[5] }
+                                                  - Vector3D<Scalar>{ Scalar{ observed[n].x }, Scalar{ observed[n].y }, Scalar{ observed[n].z } } };
+
+            return error.magnitudeSquared();
+        };
+    auto cost = [&](auto parameters)
+        {
+            auto total = residual( 0, parameters );
+
+            for (std::size_t n = 1; n < 4; ++n)
+                total += residual( n, parameters );
+            return total;
+        };
+
+    const double        point[] = { 0.1, -0.2, 0.3, 0.05, 0.1, -0.1 };
+    double              forward[6];
+    double              whole[6];
+    double              term_by_term[6];
+    AdjointTape<double> tape;
+
+    gradient<6, double>( cost, point, forward );
+
+    const double value = adjoint_gradient<double>( tape, cost, point, whole );
+    const std::size_t whole_size = tape.size();
+    const double sum = adjoint_gradient_of_sum<double>( tape, residual, 4, point, term_by_term );
+
+    CHECK_IF_EQUAL( sum, value, 1e-12f );
+    for (std::size_t i = 0; i < 6; ++i)
+    {
+        CHECK_IF_EQUAL( whole[i], forward[i], 1e-9f );
+        CHECK_IF_EQUAL( term_by_term[i], forward[i], 1e-9f );
+    }
+
+    // Only the inputs are left on the tape
+    assert( tape.size() == 1 + 6 );
+    assert( whole_size > tape.size() );
+}
+
+/** Run all of the unit tests in this namespace
+ * 
+ */
+void Run()
+{
+    std::cout << "Running Automatic Differentiation Tests..." << std::endl;
+
+    DualNCarriesEveryPartialDerivative();
+    DerivativeOfAScalarFunction();
+    JacobianMatchesTheAnalyticOne();
+    GradientOfACostFunction();
+    HessianOfTheRosenbrockFunction();
+    ReverseModeGradientMatchesForwardMode();
+    GradientOfASumOneTermAtATime();
+
+    std::cout << "PASSED!" << std::endl;
+}
+}
+/// @}
\ No newline at end of file
@@ -230,6 +230,21 @@ void ConvertingOtherColorsToHSV()
     }
 }
 
+void PalettesCanBeMadeAtCompileTime()
+{
+    std::cout << __func__ << std::endl;
+
+    constexpr UnitRGBf palette[] = { ToRGB( HSVf{ 0.0_deg_f, 1.0f, 1.0f } ),
+                                     ToRGB( HSVf{ 30.0_deg_f, 1.0f, 1.0f } ),
+                                     ToRGB( HSVf{ 210.0_deg_f, 0.5f, 0.8f } ) };
+
+    static_assert( approximately_equal_to( palette[0], UnitRGBf{ 1.0f, 0.0f, 0.0f } ) );
+    static_assert( approximately_equal_to( palette[1], UnitRGBf{ 1.0f, 0.5f, 0.0f } ) );
+    static_assert( approximately_equal_to( palette[2], UnitRGBf{ 0.4f, 0.6f, 0.8f } ) );
+    static_assert( approximately_equal_to( ToHSV( UnitRGBf{ 1.0f, 0.0f, 0.5f } ), HSVf{ 330.0_deg_f, 1.0f, 1.0f } ) );
+    static_assert( approximately_equal_to( ToHSV( palette[2] ), HSVf{ 210.0_deg_f, 0.5f, 0.8f } ) );
+}
+
 void Run()
 {
     std::cout << "Running Color Conversion Tests..." << std::endl;
@@ -245,6 +260,7 @@ void Run()
     ConvertingBasicHSVColorsToRGB();
     ConvertingBasicCMYColorsToRGB();
     ConvertingOtherColorsToHSV();
+    PalettesCanBeMadeAtCompileTime();
 
     std::cout << "PASSED!" << std::endl;
 }
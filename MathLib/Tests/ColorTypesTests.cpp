@@ -133,12 +133,27 @@ void MinValueHSVf()
     assert( HSVf::min().value() == 0.0f );
 }
 
+void HueColorWrapsTheHue()
+{
+    std::cout << __func__ << std::endl;
+
+    assert( HSVf( Degreef{ 0.0f }, 1.0f, 1.0f ).hueColor() == HSVf::Red );
+    assert( HSVf( Degreef{ 59.9f }, 1.0f, 1.0f ).hueColor() == HSVf::Red );
+    assert( HSVf( Degreef{ 60.0f }, 1.0f, 1.0f ).hueColor() == HSVf::Yellow );
+    assert( HSVf( Degreef{ 200.0f }, 1.0f, 1.0f ).hueColor() == HSVf::Cyan );
+    assert( HSVf( Degreef{ 359.99f }, 1.0f, 1.0f ).hueColor() == HSVf::Magenta );
+    assert( HSVf::max().hueColor() == HSVf::Red );
+    assert( HSVf( Degreef{ -30.0f }, 1.0f, 1.0f ).hueColor() == HSVf::Magenta );
+    assert( HSVf( Degreef{ 2.0f * 360.0f + 130.0f }, 1.0f, 1.0f ).hueColor() == HSVf::Green );
+}
+
 void HSV()
 {
     DefaultConstructedUnitHSV();
     NormallyConstructedUnitHSV();
     MaxValueHSVf();
     MinValueHSVf();
+    HueColorWrapsTheHue();
 }
 
 void Run()
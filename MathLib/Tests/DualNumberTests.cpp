@@ -96,6 +96,65 @@ void DualScalarSquareRootTimesItselfIsTheOriginalNumber()
     CHECK_IF_EQUAL( original_number, root_squared );
 }
 
+/** Compares the derivative carried through @p function with a central difference at @p x */
+template <class Function>
+static void CheckDerivative(Function function, double x)
+{
+    const double h = 1e-6;
+    Duald        result{ function( Duald{ x, 1.0 } ) };
+    double       central_difference{ (function( Duald{ x + h } ).real - function( Duald{ x - h } ).real) / (2.0 * h) };
+
+    CHECK_IF_EQUAL( result.real, function( Duald{ x } ).real );
+    CHECK_IF_EQUAL( result.dual, central_difference, 1e-5f );
+}
+
+/** Verifies that the @c <cmath> overloads carry the derivative
+ * 
+ */
+void ElementaryFunctionsCarryTheirDerivatives()
+{
+    std::cout << __func__ << std::endl;
+
+    for (double x : { 0.3, 0.7 })
+    {
+        CheckDerivative( [](auto v) { return sqrt( v ); }, x );
+        CheckDerivative( [](auto v) { return cbrt( v ); }, x );
+        CheckDerivative( [](auto v) { return pow( v, 2.5 ); }, x );
+        CheckDerivative( [](auto v) { return pow( 3.0, v ); }, x );
+        CheckDerivative( [](auto v) { return pow( v, v * 2.0 ); }, x );
+        CheckDerivative( [](auto v) { return hypot( v, v * v ); }, x );
+        CheckDerivative( [](auto v) { return exp( v ); }, x );
+        CheckDerivative( [](auto v) { return exp2( v ); }, x );
+        CheckDerivative( [](auto v) { return expm1( v ); }, x );
+        CheckDerivative( [](auto v) { return log( v ); }, x );
+        CheckDerivative( [](auto v) { return log2( v ); }, x );
+        CheckDerivative( [](auto v) { return log10( v ); }, x );
+        CheckDerivative( [](auto v) { return log1p( v ); }, x );
+        CheckDerivative( [](auto v) { return sin( v ); }, x );
+        CheckDerivative( [](auto v) { return cos( v ); }, x );
+        CheckDerivative( [](auto v) { return tan( v ); }, x );
+        CheckDerivative( [](auto v) { return asin( v ); }, x );
+        CheckDerivative( [](auto v) { return acos( v ); }, x );
+        CheckDerivative( [](auto v) { return atan( v ); }, x );
+        CheckDerivative( [](auto v) { return atan2( v * v, 1.0 - v ); }, x );
+        CheckDerivative( [](auto v) { return sinh( v ); }, x );
+        CheckDerivative( [](auto v) { return cosh( v ); }, x );
+        CheckDerivative( [](auto v) { return tanh( v ); }, x );
+        CheckDerivative( [](auto v) { return asinh( v ); }, x );
+        CheckDerivative( [](auto v) { return acosh( v + 1.5 ); }, x );
+        CheckDerivative( [](auto v) { return atanh( v ); }, x );
+        CheckDerivative( [](auto v) { return erf( v ); }, x );
+        CheckDerivative( [](auto v) { return abs( 0.5 - v ); }, x );
+        CheckDerivative( [](auto v) { return fmax( v * v, 0.25 - v ); }, x );
+
+        // Compositions use the chain rule
+        CheckDerivative( [](auto v) { return sin( exp( v ) * v ) / sqrt( v + 1.0 ); }, x );
+    }
+
+    CHECK_IF_EQUAL( floor( Duald{ 2.5, 1.0 } ), Duald{ 2.0, 0.0 } );
+    CHECK_IF_EQUAL( -Duald{ 2.5, 1.0 }, Duald{ -2.5, -1.0 } );
+}
+
 /** Run all of the unit tests in this namespace
  * 
  */
@@ -108,6 +167,7 @@ void Run()
     MakePureDualSetsRealComponentToZero();
     MakePureDualSetsDualComponentToGivenValue();
     DualScalarSquareRootTimesItselfIsTheOriginalNumber();
+    ElementaryFunctionsCarryTheirDerivatives();
 
     std::cout << "PASSED!" << std::endl;
 }
@@ -47,6 +47,11 @@ void PureRotationHasZeroTranslation()
     CHECK_IF_EQUAL( DualQuaternionf::make_rotation( Quaternionf::make_rotation(0.0_deg_f, 0.0f, 1.0f, 0.0f) ).translation(), Vector3Df::zero() );
     CHECK_IF_EQUAL( DualQuaternionf::make_rotation( Quaternionf::make_rotation(45.0_deg_f, 0.0f, 0.0f, 1.0f) ).translation(), Vector3Df::zero() );
     CHECK_IF_EQUAL( DualQuaternionf::make_rotation( Quaternionf::make_rotation(90.0_deg_f, 1.0f, 0.0f, 0.0f) ).translation(), Vector3Df::zero() );
+
+    // Directly from an angle and an axis
+    CHECK_IF_EQUAL( DualQuaternionf::make_rotation( 60.0_deg_f, Vector3Df::unit_y() ).real(), Quaternionf::make_rotation( 60.0_deg_f, Vector3Df::unit_y() ) );
+    CHECK_IF_EQUAL( DualQuaternionf::make_rotation( 60.0_deg_f, Vector3Df::unit_y() ).dual(), Quaternionf::zero() );
+    CHECK_IF_EQUAL( DualQuaternionf::make_rotation<fast::HighPrecision>( 60.0_deg_f, Vector3Df::unit_y() ).real(), Quaternionf::make_rotation( 60.0_deg_f, Vector3Df::unit_y() ) );
 }
 
 void PureTranslationHasIdentityRotation()
@@ -328,6 +333,22 @@ void TranslationIsTheInverseOfMakeTranslation()
     assert( DualQuaternionf::make_translation(vector).translation() == vector);
 }
 
+void ConcatenatingTransformsAppliesThemInOrder()
+{
+    std::cout << __func__ << std::endl;
+
+    // Rotations about different axes don't commute, so the order of the factors matters
+    const Quaterniond     parent_rotation{ Quaterniond::make_rotation( 90.0_deg, Vector3Dd::unit_z() ) };
+    const Quaterniond     child_rotation{ Quaterniond::make_rotation( 90.0_deg, Vector3Dd::unit_x() ) };
+    const DualQuaterniond parent{ DualQuaterniond::make_coordinate_system( parent_rotation, 1.0, 2.0, 3.0 ) };
+    const DualQuaterniond child{ DualQuaterniond::make_coordinate_system( child_rotation, 0.0, 1.0, 0.0 ) };
+    const DualQuaterniond both{ parent * child };
+
+    // The child's origin is moved by (0, 1, 0) in the parent's frame, which the parent turns into (-1, 0, 0)
+    CHECK_IF_EQUAL( both.translation(), Vector3Dd( 0.0, 2.0, 3.0 ) );
+    CHECK_IF_EQUAL( both.rotation(), parent_rotation * child_rotation );
+}
+
 void TestTranslations()
 {
     TranslatingOriginOnlyAlongX();
@@ -342,6 +363,74 @@ void TestRotations()
     RotateOnlyAroundAMainAxis();
 }
 
+void LogAndExpAreInverses()
+{
+    std::cout << __func__ << std::endl;
+
+    CHECK_IF_EQUAL( DualQuaterniond::identity().log().real(), Quaterniond::zero() );
+    CHECK_IF_EQUAL( DualQuaterniond::identity().log().dual(), Quaterniond::zero() );
+    assert( approximately_equal_to( DualQuaterniond::zero().exp(), DualQuaterniond::identity() ) );
+
+    const DualQuaterniond transforms[] = { DualQuaterniond{ Quaterniond::make_rotation( 120.0_deg, Vector3Dd{ 1.0, 2.0, -1.0 }.normalized() ), Vector3Dd{ 3.0, -1.0, 0.5 } },
+                                           DualQuaterniond{ Quaterniond::make_rotation( 0.01_deg, Vector3Dd::unit_y() ), Vector3Dd{ 0.0, 0.0, 2.0 } },
+                                           DualQuaterniond::make_translation( 1.0, 2.0, 3.0 ),
+                                           DualQuaterniond::make_rotation( Quaterniond::make_rotation( 45.0_deg, Vector3Dd::unit_z() ) ) };
+
+    for (const DualQuaterniond &transform : transforms)
+    {
+        DualQuaterniond logarithm{ log( transform ) };
+
+        // Pure, since it is a unit DualQuaternion
+        CHECK_IF_EQUAL( logarithm.real().w(), 0.0 );
+        CHECK_IF_EQUAL( logarithm.dual().w(), 0.0 );
+        assert( approximately_equal_to( exp( logarithm ), transform ) );
+    }
+
+    // The log of a pure translation is half of the translation
+    CHECK_IF_EQUAL( DualQuaterniond::make_translation( 1.0, 2.0, 3.0 ).log().dual().imaginary(), Vector3Dd( 0.5, 1.0, 1.5 ) );
+
+    // Non-unit DualQuaternions keep their norm in the scalar parts
+    DualQuaterniond scaled{ transforms[0] * 2.0 };
+
+    assert( approximately_equal_to( scaled.log().exp(), scaled ) );
+}
+
+void SmallAnglesKeepTheirPrecision()
+{
+    std::cout << __func__ << std::endl;
+
+    // The same tiny screw motion in float and double
+    for (double degrees : { 0.0001, 0.01, 1.0, 3.0, 22.0, 24.0 })
+    {
+        DualQuaternionf small{ Quaternionf::make_rotation( Degreef( float(degrees) ), Vector3Df::unit_x() ), Vector3Df{ 0.0f, 1.0f, 1.0f } };
+        DualQuaterniond precise{ Quaterniond::make_rotation( Degreed( degrees ), Vector3Dd::unit_x() ), Vector3Dd{ 0.0, 1.0, 1.0 } };
+        DualQuaternionf logarithm{ small.log() };
+        DualQuaterniond precise_logarithm{ precise.log() };
+
+        CHECK_IF_EQUAL( logarithm.real().i(), float( precise_logarithm.real().i() ), 0.00001f );
+        CHECK_IF_EQUAL( logarithm.dual().i(), float( precise_logarithm.dual().i() ), 0.00001f );
+        CHECK_IF_EQUAL( logarithm.dual().j(), float( precise_logarithm.dual().j() ), 0.00001f );
+        CHECK_IF_EQUAL( logarithm.dual().k(), float( precise_logarithm.dual().k() ), 0.00001f );
+        assert( approximately_equal_to( logarithm.exp(), small, 0.00001f ) );
+    }
+}
+
+void PowScalesTheScrewMotion()
+{
+    std::cout << __func__ << std::endl;
+
+    DualQuaterniond rotation{ DualQuaterniond::make_rotation( Quaterniond::make_rotation( 90.0_deg, Vector3Dd::unit_z() ) ) };
+    DualQuaterniond screw{ DualQuaterniond::make_translation( 0.0, 0.0, 4.0 ) * rotation };
+    DualQuaterniond half{ screw.pow( 0.5 ) };
+
+    assert( approximately_equal_to( half * half, screw ) );
+    assert( approximately_equal_to( screw.pow( 1.0 ), screw ) );
+    assert( approximately_equal_to( screw.pow( 0.0 ), DualQuaterniond::identity() ) );
+    CHECK_IF_EQUAL( half.rotation(), Quaterniond::make_rotation( 45.0_deg, Vector3Dd::unit_z() ) );
+    CHECK_IF_EQUAL( half.translation(), Vector3Dd( 0.0, 0.0, 2.0 ) );
+    assert( approximately_equal_to( screw.pow( -1.0 ), screw.conjugate() ) );
+}
+
 /** Run all of the unit tests in this namespace
  * 
  */
@@ -358,6 +447,10 @@ void Run()
     VerifyOriginRepresentation();
     TestTranslations();
     TestRotations();
+    ConcatenatingTransformsAppliesThemInOrder();
+    LogAndExpAreInverses();
+    SmallAnglesKeepTheirPrecision();
+    PowScalesTheScrewMotion();
 
     std::cout << "PASSED!" << std::endl;
 }
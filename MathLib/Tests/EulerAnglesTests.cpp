@@ -0,0 +1,297 @@
+#include "EulerAnglesTests.hpp"
+#include "math/EulerAngles.hpp"
+#include "math/Checks.hpp"
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <numbers>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+/** @file
+ * 
+ *  @hideincludegraph
+ */
+
+/** @defgroup EulerAnglesTests Euler Angles Unit Tests
+ * 
+ *  Here are all the unit tests used to exercise the conversions to and from Euler angles
+ * 
+ *  @ingroup UnitTests
+ * 
+ *  @{
+ */
+
+/** Contains the unit tests for Euler angles
+ * 
+ */
+namespace EulerAnglesTests
+{
+
+using namespace Math;
+
+/** Calls @p check with a @c std::integral_constant for each of the 12 EulerOrders */
+template <class Check>
+static void ForEveryOrder(Check &&check)
+{
+    [&check]<std::size_t... N>(std::index_sequence<N...>)
+    {
+        (check( std::integral_constant<EulerOrder, static_cast<EulerOrder>( N )>{} ), ...);
+    }( std::make_index_sequence<12>{} );
+}
+
+static Vector3Dd Axis(const unsigned axis)
+{
+    return Vector3Dd{ double(axis == 0), double(axis == 1), double(axis == 2) };
+}
+
+/** How far apart two rotations are, treating q and -q as the same */
+static double Error(const Quaterniond &result, const Quaterniond &expected)
+{
+    return std::min( (result - expected).magnitude(), (result + expected).magnitude() );
+}
+
+static float Error(const Quaternionf &result, const Quaternionf &expected)
+{
+    return std::min( (result - expected).magnitude(), (result + expected).magnitude() );
+}
+
+void MatchesTheProductOfAxisRotations()
+{
+    std::cout << __func__ << std::endl;
+
+    const EulerAnglesd angles{ Radiand{ 0.3 }, Radiand{ -1.1 }, Radiand{ 2.5 } };
+
+    ForEveryOrder( [&angles](auto order)
+        {
+            constexpr auto    axes = euler_axes( order );
+            const Quaterniond expected{ Quaterniond::make_rotation( angles.third, Axis( axes[2] ) ) *
+                                        Quaterniond::make_rotation( angles.second, Axis( axes[1] ) ) *
+                                        Quaterniond::make_rotation( angles.first, Axis( axes[0] ) ) };
+
+            CHECK_IF_EQUAL( from_euler<order>( angles ), expected, 1e-12 );
+            assert( from_euler<order>( angles ).isUnit() );
+        } );
+
+    // A quarter turn about x takes y to z, and then one about y takes z to x
+    const Quaterniond rotation{ from_euler<EulerOrder::XYZ>( Radiand{ std::numbers::pi / 2 }, Radiand{ std::numbers::pi / 2 }, Radiand{} ) };
+
+    CHECK_IF_EQUAL( (rotation * Quaterniond::encode_point( Vector3Dd::unit_y() ) * rotation.conjugate()).imaginary(), Vector3Dd::unit_x(), 1e-12 );
+}
+
+void RoundTripsForEveryOrder()
+{
+    std::cout << __func__ << std::endl;
+
+    ForEveryOrder( [](auto order)
+        {
+            // The middle angle is kept in the range to_euler() returns
+            const double middle_offset = is_proper_euler( order ) ? std::numbers::pi / 2 : 0.0;
+
+            for (double first = -3.0; first < 3.1; first += 0.75)
+            {
+                for (double second = -1.5; second < 1.55; second += 0.5)
+                {
+                    for (double third = -3.0; third < 3.1; third += 1.5)
+                    {
+                        const EulerAnglesd angles{ Radiand{ first }, Radiand{ second + middle_offset }, Radiand{ third } };
+                        const EulerAnglesd result{ to_euler<order>( from_euler<order>( angles ) ) };
+
+                        CHECK_IF_EQUAL( result.first.value(), angles.first.value(), 1e-9f );
+                        CHECK_IF_EQUAL( result.second.value(), angles.second.value(), 1e-9f );
+                        CHECK_IF_EQUAL( result.third.value(), angles.third.value(), 1e-9f );
+                    }
+                }
+            }
+        } );
+}
+
+void AnyRotationRoundTrips()
+{
+    std::cout << __func__ << std::endl;
+
+    ForEveryOrder( [](auto order)
+        {
+            for (int n = 0; n < 50; ++n)
+            {
+                const Quaterniond rotation{ Quaterniond{ std::cos( n * 1.3 ), std::sin( n * 0.7 ), std::cos( n * 2.9 ), std::sin( n * 0.2 + 1.0 ) }.normalized() };
+                const EulerAnglesd angles{ to_euler<order>( rotation ) };
+
+                assert( std::abs( angles.first.value() ) <= std::numbers::pi );
+                assert( std::abs( angles.third.value() ) <= std::numbers::pi );
+                if constexpr ( is_proper_euler( order ) )
+                    assert( angles.second.value() >= 0.0 && angles.second.value() <= std::numbers::pi );
+                else
+                    assert( std::abs( angles.second.value() ) <= std::numbers::pi / 2 );
+
+                CHECK_IF_ZERO( Error( from_euler<order>( angles ), rotation ), 1e-12f );
+            }
+        } );
+}
+
+void GimbalLockPutsTheWholeTurnInTheThirdAngle()
+{
+    std::cout << __func__ << std::endl;
+
+    ForEveryOrder( [](auto order)
+        {
+            const double locks[] = { is_proper_euler( order ) ? 0.0 : -std::numbers::pi / 2,
+                                     is_proper_euler( order ) ? std::numbers::pi : std::numbers::pi / 2 };
+
+            for (const double lock : locks)
+            {
+                const Quaterniond  rotation{ from_euler<order>( Radiand{ 0.4 }, Radiand{ lock }, Radiand{ -1.2 } ) };
+                const EulerAnglesd angles{ to_euler<order>( rotation ) };
+
+                CHECK_IF_ZERO( angles.first.value(), 1e-12f );
+                CHECK_IF_EQUAL( angles.second.value(), lock, 1e-6f );
+                assert( !std::isnan( angles.third.value() ) );
+                CHECK_IF_ZERO( Error( from_euler<order>( angles ), rotation ), 1e-6f );
+            }
+        } );
+}
+
+void NearlyLockedRotationsRoundTripInFloat()
+{
+    std::cout << __func__ << std::endl;
+
+    ForEveryOrder( [](auto order)
+        {
+            const float locks[] = { is_proper_euler( order ) ? 0.0f : -std::numbers::pi_v<float> / 2,
+                                    is_proper_euler( order ) ? std::numbers::pi_v<float> : std::numbers::pi_v<float> / 2 };
+
+            for (const float lock : locks)
+            {
+                // Still a real rotation of the first angle, which mustn't be folded into the third
+                for (const float offset : { 5e-4f, -5e-4f })
+                {
+                    const Quaternionf rotation{ from_euler<order>( Radianf{ 0.4f }, Radianf{ lock + offset }, Radianf{ -1.2f } ) };
+
+                    CHECK_IF_ZERO( Error( from_euler<order>( to_euler<order>( rotation ) ), rotation ), 2e-6f );
+                }
+
+                // Locked up to rounding still puts the whole turn in the third angle
+                const Quaternionf locked{ from_euler<order>( Radianf{ 0.4f }, Radianf{ lock }, Radianf{ -1.2f } ) };
+
+                CHECK_IF_ZERO( to_euler<order>( locked ).first.value(), 0.0f );
+                CHECK_IF_ZERO( Error( from_euler<order>( to_euler<order>( locked ) ), locked ), 2e-6f );
+            }
+        } );
+}
+
+void BatchesMatchTheSingleConversions()
+{
+    std::cout << __func__ << std::endl;
+
+    std::vector<EulerAnglesf> angles;
+
+    for (int n = 0; n < 37; ++n)
+        angles.push_back( EulerAnglesf{ Radianf{ std::sin( n * 1.1f ) * 3.0f }, Radianf{ std::cos( n * 0.3f ) }, Radianf{ n * 0.17f - 3.0f } } );
+
+    std::vector<Quaternionf>  rotations( angles.size() );
+    std::vector<EulerAnglesf> round_trip( angles.size() );
+
+    from_euler<EulerOrder::ZYX>( std::span<const EulerAnglesf>{ angles }, std::span<Quaternionf>{ rotations } );
+    to_euler<EulerOrder::ZYX>( std::span<const Quaternionf>{ rotations }, std::span<EulerAnglesf>{ round_trip } );
+
+    for (std::size_t n = 0; n < angles.size(); ++n)
+    {
+        CHECK_IF_EQUAL( rotations[n], from_euler<EulerOrder::ZYX>( angles[n] ), 0.0f );
+        CHECK_IF_EQUAL( round_trip[n].first.value(), angles[n].first.value(), 0.0005f );
+        CHECK_IF_EQUAL( round_trip[n].second.value(), angles[n].second.value(), 0.0005f );
+        CHECK_IF_EQUAL( round_trip[n].third.value(), angles[n].third.value(), 0.0005f );
+    }
+}
+
+/** Converts @p angles to and from QuaternionArrays and checks every result against the single conversions */
+template <EulerOrder Order, class Policy, class T>
+static void CheckArraysMatch(const std::vector<EulerAngles<T>> &angles)
+{
+    std::vector<T> first, second, third;
+
+    for (const EulerAngles<T> &angle : angles)
+    {
+        first.push_back( angle.first.value() );
+        second.push_back( angle.second.value() );
+        third.push_back( angle.third.value() );
+    }
+
+    std::vector<T> w( angles.size() ), i( angles.size() ), j( angles.size() ), k( angles.size() );
+    std::vector<T> round_trip_first( angles.size() ), round_trip_second( angles.size() ), round_trip_third( angles.size() );
+
+    from_euler<Order, Policy>( EulerAngleArrays<const T>{ first, second, third }, QuaternionArrays<T>{ w, i, j, k } );
+    to_euler<Order, Policy>( QuaternionArrays<const T>{ w, i, j, k }, EulerAngleArrays<T>{ round_trip_first, round_trip_second, round_trip_third } );
+
+    for (std::size_t n = 0; n < angles.size(); ++n)
+    {
+        const Quaternion<T>  rotation{ from_euler<Order, Policy>( angles[n] ) };
+        const EulerAngles<T> round_trip{ to_euler<Order, Policy>( rotation ) };
+
+        assert( w[n] == rotation.w() && i[n] == rotation.i() && j[n] == rotation.j() && k[n] == rotation.k() );
+        assert( round_trip_first[n] == round_trip.first.value() );
+        assert( round_trip_second[n] == round_trip.second.value() );
+        assert( round_trip_third[n] == round_trip.third.value() );
+    }
+}
+
+void ArraysMatchTheSingleConversions()
+{
+    std::cout << __func__ << std::endl;
+
+    std::vector<EulerAnglesf> angles;
+
+    for (int n = 0; n < 37; ++n)
+        angles.push_back( EulerAnglesf{ Radianf{ std::sin( n * 1.1f ) * 3.0f }, Radianf{ std::cos( n * 0.3f ) }, Radianf{ n * 0.17f - 3.0f } } );
+
+    // Locked, so that the selects for gimbal lock are taken too
+    angles.push_back( EulerAnglesf{ Radianf{ 0.4f }, Radianf{ std::numbers::pi_v<float> / 2 }, Radianf{ -1.2f } } );
+    angles.push_back( EulerAnglesf{ Radianf{ 0.4f }, Radianf{ 0.0f }, Radianf{ -1.2f } } );
+
+    std::vector<EulerAnglesd> angles_d;
+
+    for (const EulerAnglesf &angle : angles)
+        angles_d.push_back( EulerAnglesd{ Radiand{ angle.first.value() }, Radiand{ angle.second.value() }, Radiand{ angle.third.value() } } );
+
+    CheckArraysMatch<EulerOrder::ZYX, StandardMath>( angles );
+    CheckArraysMatch<EulerOrder::ZYX, fast::MediumPrecision>( angles );
+    CheckArraysMatch<EulerOrder::ZXZ, fast::LowPrecision>( angles );
+    CheckArraysMatch<EulerOrder::XYZ, fast::HighPrecision>( angles_d );
+}
+
+void ConversionsWorkInConstantExpressions()
+{
+    std::cout << __func__ << std::endl;
+
+    constexpr Quaterniond  rotation{ from_euler<EulerOrder::ZYX>( Radiand{ 0.1 }, Radiand{ 0.2 }, Radiand{ 0.3 } ) };
+    constexpr EulerAnglesd angles{ to_euler<EulerOrder::ZYX>( rotation ) };
+
+    static_assert( rotation.isUnit() );
+    static_assert( approximately_equal_to( angles.first.value(), 0.1, 1e-14 ) );
+    static_assert( approximately_equal_to( angles.second.value(), 0.2, 1e-14 ) );
+    static_assert( approximately_equal_to( angles.third.value(), 0.3, 1e-14 ) );
+}
+/// @}
+
+/** Run all of the unit tests in this namespace
+ * 
+ */
+void Run()
+{
+    std::cout << "Running Euler Angles Tests..." << std::endl;
+
+    MatchesTheProductOfAxisRotations();
+    RoundTripsForEveryOrder();
+    AnyRotationRoundTrips();
+    GimbalLockPutsTheWholeTurnInTheThirdAngle();
+    NearlyLockedRotationsRoundTripInFloat();
+    BatchesMatchTheSingleConversions();
+    ArraysMatchTheSingleConversions();
+    ConversionsWorkInConstantExpressions();
+
+    std::cout << "PASSED!" << std::endl;
+}
+
+}
+/// @}
\ No newline at end of file
@@ -0,0 +1,242 @@
+#include "FastMathTests.hpp"
+#include "math/FastMath.hpp"
+#include "math/Quaternion.hpp"
+#include "math/RotationIntegration.hpp"
+#include "math/Trigonometric.hpp"
+#include "math/Conversions.hpp"
+#include "math/Checks.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <numbers>
+#include <vector>
+
+
+/** @file
+ * 
+ *  @hideincludegraph
+ */
+
+/** @defgroup FastMathTests Fast Math Unit Tests
+ * 
+ *  Here are all the unit tests used to exercise the approximate elementary functions and the math policies
+ * 
+ *  @ingroup UnitTests
+ * 
+ *  @{
+ */
+
+/** Contains the unit tests for Math::fast and the math policies
+ * 
+ */
+namespace FastMathTests
+{
+
+using namespace Math;
+using namespace Math::Literals;
+
+/** Measures the largest errors of the approximations at precision @p P against the standard library */
+template <fast::Precision P>
+static void CheckErrorBounds(double trig_bound, double acos_bound, double atan2_bound, double rsqrt_bound)
+{
+    double trig_error = 0.0, acos_error = 0.0, atan2_error = 0.0, rsqrt_error = 0.0;
+
+    for (double x = -20.0; x <= 20.0; x += 0.001)
+    {
+        double sine, cosine;
+
+        fast::sincos<P>( x, sine, cosine );
+        trig_error = std::max( { trig_error, std::abs( sine - std::sin( x ) ), std::abs( cosine - std::cos( x ) ) } );
+        assert( fast::sin<P>( x ) == sine && fast::cos<P>( x ) == cosine );
+    }
+    for (double x = -1.0; x <= 1.0; x += 0.0001)
+        acos_error = std::max( acos_error, std::abs( fast::acos<P>( x ) - std::acos( x ) ) );
+    for (double angle = -3.14; angle <= 3.14; angle += 0.001)
+    {
+        for (double length : { 0.01, 1.0, 250.0 })
+        {
+            double y{ length * std::sin( angle ) }, x{ length * std::cos( angle ) };
+
+            atan2_error = std::max( atan2_error, std::abs( fast::atan2<P>( y, x ) - std::atan2( y, x ) ) );
+        }
+    }
+    for (double x = 0.001; x <= 1000.0; x *= 1.01)
+        rsqrt_error = std::max( rsqrt_error, std::abs( fast::rsqrt<P>( x ) * std::sqrt( x ) - 1.0 ) );
+
+    assert( trig_error <= trig_bound );
+    assert( acos_error <= acos_bound );
+    assert( atan2_error <= atan2_bound );
+    assert( rsqrt_error <= rsqrt_bound );
+}
+
+void ApproximationsAreWithinTheirErrorBounds()
+{
+    std::cout << __func__ << std::endl;
+
+    CheckErrorBounds<fast::Precision::Low>( 2e-3, 4e-4, 7e-4, 2e-3 );
+    CheckErrorBounds<fast::Precision::Medium>( 1e-5, 5e-6, 2e-5, 5e-6 );
+    CheckErrorBounds<fast::Precision::High>( 3e-8, 2e-8, 4e-8, 1e-9 );
+
+    // High precision is as good as the standard library for floats
+    for (float x = -10.0f; x <= 10.0f; x += 0.01f)
+    {
+        CHECK_IF_EQUAL( fast::sin<fast::Precision::High>( x ), std::sin( x ), 5e-7f );
+        CHECK_IF_EQUAL( fast::cos<fast::Precision::High>( x ), std::cos( x ), 5e-7f );
+    }
+}
+
+void Atan2FollowsTheStandardConventions()
+{
+    std::cout << __func__ << std::endl;
+
+    for (double y : { 0.0, -0.0, 1.0, -1.0, 3.0 })
+    {
+        for (double x : { 0.0, -0.0, 1.0, -1.0, -3.0 })
+            CHECK_IF_EQUAL( fast::atan2<fast::Precision::High>( y, x ), std::atan2( y, x ), 1e-7 );
+    }
+
+    CHECK_IF_EQUAL( fast::acos<fast::Precision::High>( 1.0f ), 0.0f );
+    CHECK_IF_EQUAL( fast::acos<fast::Precision::High>( -1.0f ), std::numbers::pi_v<float> );
+    CHECK_IF_EQUAL( fast::sqrt<fast::Precision::High>( 0.0f ), 0.0f );
+    CHECK_IF_EQUAL( fast::sqrt<fast::Precision::High>( 2.0f ), std::sqrt( 2.0f ) );
+    assert( fast::sqrt<fast::Precision::Medium>( 0.0f ) == 0.0f && fast::sqrt<fast::Precision::High>( 0.0 ) == 0.0 );
+    assert( fast::acos<fast::Precision::Low>( 1.0000001f ) == 0.0f ); // Just outside of the domain after rounding
+}
+
+void SpanVersionsMatchTheScalarVersions()
+{
+    std::cout << __func__ << std::endl;
+
+    std::vector<float> input;
+    std::vector<float> other;
+
+    for (int i = 0; i < 37; ++i)
+    {
+        input.push_back( std::cos( i * 0.37f ) );
+        other.push_back( 0.1f + i * 0.2f );
+    }
+
+    std::vector<float> first( input.size() ), second( input.size() );
+
+    fast::sincos<fast::Precision::Low, float>( input, first, second );
+    for (std::size_t i = 0; i < input.size(); ++i)
+        assert( first[i] == fast::sin<fast::Precision::Low>( input[i] ) && second[i] == fast::cos<fast::Precision::Low>( input[i] ) );
+
+    fast::sin<fast::Precision::Medium, float>( input, first );
+    fast::cos<fast::Precision::Medium, float>( input, second );
+    for (std::size_t i = 0; i < input.size(); ++i)
+        assert( first[i] == fast::sin<fast::Precision::Medium>( input[i] ) && second[i] == fast::cos<fast::Precision::Medium>( input[i] ) );
+
+    fast::acos<fast::Precision::High, float>( input, first );
+    fast::atan2<fast::Precision::High, float>( input, other, second );
+    for (std::size_t i = 0; i < input.size(); ++i)
+        assert( first[i] == fast::acos<fast::Precision::High>( input[i] ) && second[i] == fast::atan2<fast::Precision::High>( input[i], other[i] ) );
+
+    fast::rsqrt<fast::Precision::Medium, float>( other, first );
+    for (std::size_t i = 0; i < input.size(); ++i)
+        assert( first[i] == fast::rsqrt<fast::Precision::Medium>( other[i] ) );
+
+    // Signed zeros pick the quadrant, as with std::atan2
+    const std::vector<double> y{ 0.0, -0.0, 0.0, -0.0, 1.5, -2.5 };
+    const std::vector<double> x{ 0.0, 0.0, -0.0, -0.0, -0.0, 3.0 };
+    std::vector<double>       angles( y.size() );
+
+    fast::atan2<fast::Precision::High, double>( y, x, angles );
+    for (std::size_t i = 0; i < y.size(); ++i)
+        assert( angles[i] == fast::atan2<fast::Precision::High>( y[i], x[i] ) && std::signbit( angles[i] ) == std::signbit( y[i] ) );
+}
+
+void PoliciesAreChosenPerCallSite()
+{
+    std::cout << __func__ << std::endl;
+
+    Vector3Df   axis{ 1.0f, 2.0f, -2.0f };
+    Quaternionf begin{ Quaternionf::make_rotation( 10.0_deg_f, axis ) };
+    Quaternionf end{ Quaternionf::make_rotation( 130.0_deg_f, Vector3Df::unit_y() ) };
+
+    CHECK_IF_EQUAL( Quaternionf::make_rotation<fast::HighPrecision>( 75.0_deg_f, axis ), Quaternionf::make_rotation( 75.0_deg_f, axis ) );
+    CHECK_IF_EQUAL( Quaternionf::make_rotation<fast::LowPrecision>( 75.0_deg_f, 1.0f, 2.0f, -2.0f ), Quaternionf::make_rotation( 75.0_deg_f, axis ), 3e-3f );
+    CHECK_IF_EQUAL( begin.pow<fast::MediumPrecision>( 0.4f ), begin.pow( 0.4f ), 1e-4f );
+    CHECK_IF_EQUAL( slerp<fast::HighPrecision>( begin, end, 0.7f ), slerp( begin, end, 0.7f ) );
+
+    CHECK_IF_EQUAL( unnormalized_sinc<fast::HighPrecision>( 0.3f ), unnormalized_sinc( 0.3f ) );
+    CHECK_IF_EQUAL( normalized_sinc<fast::MediumPrecision>( 2.5 ), normalized_sinc( 2.5 ), 1e-5 );
+
+    Quaterniond rotation{ Quaterniond::make_rotation( 20.0_deg, Vector3Dd::unit_z() ) };
+    Vector3Dd   velocity{ 0.3, -2.0, 1.5 };
+
+    CHECK_IF_EQUAL( (integrate_rotation<RotationIntegrator::ExponentialMap, fast::HighPrecision>( rotation, velocity, 0.1 )),
+                    integrate_rotation<RotationIntegrator::ExponentialMap>( rotation, velocity, 0.1 ), 1e-7 );
+}
+
+void CompileTimeVersionsMatchTheStandardLibrary()
+{
+    std::cout << __func__ << std::endl;
+
+    for (double x = -50.0; x <= 50.0; x += 0.37)
+    {
+        double sine, cosine;
+
+        compile_time::sincos( x, sine, cosine );
+        CHECK_IF_EQUAL( sine, std::sin( x ), 1e-15 );
+        CHECK_IF_EQUAL( cosine, std::cos( x ), 1e-15 );
+        CHECK_IF_EQUAL( compile_time::atan2( x, 3.0 ), std::atan2( x, 3.0 ), 1e-15 );
+        CHECK_IF_EQUAL( compile_time::atan2( -3.0, x ), std::atan2( -3.0, x ), 1e-15 );
+        CHECK_IF_EQUAL( compile_time::sqrt( std::abs( x ) ), std::sqrt( std::abs( x ) ), 1e-15 );
+        CHECK_IF_EQUAL( compile_time::acos( x / 50.0 ), std::acos( x / 50.0 ), 1e-15 );
+        assert( compile_time::floor( x ) == std::floor( x ) && compile_time::nearbyint( x ) == std::nearbyint( x ) );
+        CHECK_IF_EQUAL( compile_time::sin( float( x ) ), std::sin( float( x ) ), 1e-7f );
+    }
+
+    // Angles of many turns keep their relative precision, even close to zeros of the sine and cosine
+    for (double x : { 355.0, std::nextafter( 1000.0 * std::numbers::pi, 0.0 ), -102943.0, 1e8 * std::numbers::pi / 2 })
+    {
+        double sine, cosine;
+
+        compile_time::sincos( x, sine, cosine );
+        CHECK_IF_EQUAL( sine / std::sin( x ), 1.0, 1e-15 );
+        CHECK_IF_EQUAL( cosine / std::cos( x ), 1.0, 1e-15 );
+    }
+
+    assert( compile_time::nearbyint( 2.5 ) == 2.0 && compile_time::nearbyint( -3.5 ) == -4.0 );
+    assert( compile_time::sqrt( 1e300 ) == std::sqrt( 1e300 ) && compile_time::sqrt( 1e-300 ) == std::sqrt( 1e-300 ) );
+    assert( std::isnan( compile_time::sqrt( -1.0 ) ) && std::isnan( compile_time::acos( 1.5f ) ) );
+}
+
+void StandardMathWorksInConstantExpressions()
+{
+    std::cout << __func__ << std::endl;
+
+    static_assert( StandardMath::sqrt( 2.0 ) == std::numbers::sqrt2 );
+    static_assert( approximately_equal_to( StandardMath::sin( std::numbers::pi / 6.0 ), 0.5, 1e-15 ) );
+    static_assert( approximately_equal_to( StandardMath::acos( 0.5f ), std::numbers::pi_v<float> / 3.0f ) );
+    static_assert( approximately_equal_to( StandardMath::atan2( -1.0, -1.0 ), -0.75 * std::numbers::pi, 1e-15 ) );
+    static_assert( approximately_equal_to( StandardMath::rsqrt( 4.0f ), 0.5f ) );
+    static_assert( approximately_equal_to( unnormalized_sinc( 0.5 ), 0.958851077208406, 1e-15 ) );
+    static_assert( normalized_sinc( 0.0f ) == 1.0f );
+
+    // The same calls at run time go to the standard library
+    volatile double two{ 2.0 };
+
+    assert( StandardMath::sqrt( two ) == std::sqrt( two ) );
+}
+
+/** Run all of the unit tests in this namespace
+ * 
+ */
+void Run()
+{
+    std::cout << "Running Fast Math Tests..." << std::endl;
+
+    ApproximationsAreWithinTheirErrorBounds();
+    Atan2FollowsTheStandardConventions();
+    SpanVersionsMatchTheScalarVersions();
+    PoliciesAreChosenPerCallSite();
+    CompileTimeVersionsMatchTheStandardLibrary();
+    StandardMathWorksInConstantExpressions();
+
+    std::cout << "PASSED!" << std::endl;
+}
+}
+/// @}
\ No newline at end of file
@@ -162,6 +162,131 @@ void ConstructSkeleton()
     PrintHierarchy(skeleton);
 }
 
+void FindingANodeByName()
+{
+    std::cout << __func__ << std::endl;
+
+    HierarchicalCoordinateSystemf world;
+
+    std::shared_ptr<SceneNodef> skeleton{ GenerateHierarchicalSkeleton(world) };
+    std::shared_ptr<SceneNodef> left_hand{ world.findNode( "left_hand" ) };
+
+    assert( world.findNode( "waist" ) == skeleton );
+    assert( left_hand );
+    assert( left_hand->name() == "left_hand" );
+    assert( left_hand->parent().lock()->name() == "left_lower_arm" );
+    assert( !world.findNode( "tail" ) );
+    assert( !world.findNode( "" ) ); // Unnamed nodes are not indexed
+
+    // Lookup with a std::string_view that is not null-terminated
+    std::string_view names{ "torso_1torso_2" };
+
+    assert( world.findNode( names.substr( 0, 7 ) )->name() == "torso_1" );
+    assert( world.findNode( names.substr( 7 ) )->name() == "torso_2" );
+
+    // Names don't have to be unique
+    world.findNode( "left_hand" )->createChildNode( Vector3Df::zero(), Quaternionf::identity(), "finger" );
+    world.findNode( "right_hand" )->createChildNode( Vector3Df::zero(), Quaternionf::identity(), "finger" );
+
+    SceneNodeList<float> fingers{ world.findNodes( "finger" ) };
+
+    assert( fingers.size() == 2 );
+    assert( fingers[0]->parent().lock()->name() == "left_hand" );
+    assert( fingers[1]->parent().lock()->name() == "right_hand" );
+    assert( world.root().registry().size() == 18 );
+}
+
+void FindingANodeByPath()
+{
+    std::cout << __func__ << std::endl;
+
+    HierarchicalCoordinateSystemf world;
+
+    GenerateHierarchicalSkeleton(world);
+
+    std::shared_ptr<SceneNodef> left_foot{ world.findNode( "left_foot" ) };
+
+    assert( world.findPath( "waist/left_upper_leg/left_lower_leg/left_foot" ) == left_foot );
+    assert( world.findPath( "/waist/left_upper_leg/left_lower_leg/left_foot/" ) == left_foot );
+    assert( world.findPath( "waist//left_upper_leg/left_lower_leg/left_foot" ) == left_foot );
+    assert( world.findPath( "waist" ) == world.findNode( "waist" ) );
+    assert( world.findPath( "" ).get() == &world.root() );
+    assert( world.findPath( "/" ).get() == &world.root() );
+
+    assert( !world.findPath( "left_upper_leg/left_lower_leg/left_foot" ) ); // Has to start at the root
+    assert( !world.findPath( "waist/right_upper_leg/left_lower_leg/left_foot" ) );
+    assert( !world.findPath( "waist/left_upper_leg/left_foot" ) );
+    assert( !world.findPath( "waist/left_upper_leg/left_lower_leg/left_toe" ) );
+
+    // Same leaf name under different parents
+    world.findNode( "left_hand" )->createChildNode( Vector3Df::zero(), Quaternionf::identity(), "thumb" );
+    world.findNode( "right_hand" )->createChildNode( Vector3Df::zero(), Quaternionf::identity(), "thumb" );
+
+    std::shared_ptr<SceneNodef> right_thumb{ world.findPath( "waist/torso_1/torso_2/torso_3/right_upper_arm/right_lower_arm/right_hand/thumb" ) };
+
+    assert( right_thumb );
+    assert( right_thumb->parent().lock()->name() == "right_hand" );
+}
+
+void NameIndexStaysInSync()
+{
+    std::cout << __func__ << std::endl;
+
+    HierarchicalCoordinateSystemf world;
+
+    std::shared_ptr<SceneNodef> skeleton{ GenerateHierarchicalSkeleton(world) };
+
+    // Renaming
+    {
+        std::shared_ptr<SceneNodef> head{ world.findNode( "torso_3" )->createChildNode( Vector3Df::zero(), Quaternionf::identity(), "neck" ) };
+
+        assert( world.findNode( "neck" ) == head );
+
+        head->setName( "head" );
+
+        assert( head->name() == "head" );
+        assert( !world.findNode( "neck" ) );
+        assert( world.findNode( "head" ) == head );
+        assert( world.findPath( "waist/torso_1/torso_2/torso_3/head" ) == head );
+    }
+
+    // Detaching moves the whole subtree out of the index
+    {
+        std::shared_ptr<SceneNodef> left_upper_leg{ world.findNode( "left_upper_leg" ) };
+        std::size_t                 indexed_before{ world.root().registry().size() };
+
+        skeleton->detachChild( left_upper_leg );
+
+        assert( !world.findNode( "left_upper_leg" ) );
+        assert( !world.findNode( "left_lower_leg" ) );
+        assert( !world.findNode( "left_foot" ) );
+        assert( world.findNode( "right_foot" ) );
+        assert( world.root().registry().size() == indexed_before - 3 );
+
+        // ...and into an index of its own
+        assert( left_upper_leg->registry().size() == 3 );
+        assert( left_upper_leg->registry().findFirst( "left_foot" ) );
+
+        // Attaching puts it back
+        skeleton->attachChild( left_upper_leg );
+
+        assert( world.findNode( "left_upper_leg" ) == left_upper_leg );
+        assert( world.findNode( "left_foot" ) );
+        assert( world.root().registry().size() == indexed_before );
+    }
+
+    // Destroyed nodes are removed
+    {
+        std::size_t indexed_before{ world.root().registry().size() };
+
+        world.root().detachChild( skeleton );
+        skeleton.reset();
+
+        assert( world.root().registry().empty() );
+        assert( indexed_before == 17 ); // The skeleton and its head
+    }
+}
+
 /** Run all of the unit tests in this namespace
  * 
  */
@@ -173,6 +298,9 @@ void Run()
     CreatingAChildAddsToTheNodesChildren();
     ConvertingALocalCoordinateToAGlobalCoordinate();
     ConstructSkeleton();
+    FindingANodeByName();
+    FindingANodeByPath();
+    NameIndexStaysInSync();
 
     std::cout << "PASSED!" << std::endl;
 }
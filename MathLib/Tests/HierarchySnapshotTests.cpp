@@ -0,0 +1,198 @@
+#include "HierarchySnapshotTests.hpp"
+#include "math/HierarchySnapshot.hpp"
+#include "math/Conversions.hpp"
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+
+/** @file
+ * 
+ *  @hideincludegraph
+ */
+
+/** @defgroup HierarchySnapshotTests HierarchySnapshot Unit Tests
+ * 
+ *  Here are all the unit tests used to exercise the hierarchy snapshot format
+ * 
+ *  @ingroup UnitTests
+ * 
+ *  @{
+ */
+
+/** Contains the unit tests for the hierarchy snapshot format
+ * 
+ */
+namespace HierarchySnapshotTests
+{
+
+using namespace Math;
+using namespace Math::Literals;
+
+static void GenerateArm(HierarchicalCoordinateSystemf &world)
+{
+    std::shared_ptr<SceneNodef> shoulder{ world.root().createChildNode( { 0.0f, 1.5f, 0.0f }, Quaternionf::make_rotation( 30.0_deg_f, Vector3Df::unit_z() ), "shoulder" ) };
+    std::shared_ptr<SceneNodef> upper_arm{ shoulder->createChildNode( { 0.3f, 0.0f, 0.0f }, Quaternionf::make_rotation( 45.0_deg_f, Vector3Df::unit_y() ), "arm" ) };
+    std::shared_ptr<SceneNodef> lower_arm{ upper_arm->createChildNode( { 0.3f, 0.0f, 0.0f }, Quaternionf::make_rotation( -20.0_deg_f, Vector3Df::unit_x() ), "arm" ) };
+    std::shared_ptr<SceneNodef> hand{ lower_arm->createChildNode( { 0.25f, 0.0f, 0.0f }, Quaternionf::identity(), "hand" ) };
+
+    shoulder->createChildNode( { 0.0f, 0.2f, 0.0f }, Quaternionf::identity() ); // Unnamed
+    hand->createChildNode( { 0.1f, 0.0f, 0.0f }, Quaternionf::identity(), "finger" );
+    hand->createChildNode( { 0.1f, 0.0f, 0.02f }, Quaternionf::identity(), "finger" );
+}
+
+void SnapshotContainsEveryNodeInPreOrder()
+{
+    std::cout << __func__ << std::endl;
+
+    HierarchicalCoordinateSystemf world;
+
+    GenerateArm( world );
+
+    std::vector<std::byte>                       bytes{ make_hierarchy_snapshot( world ) };
+    std::optional<HierarchySnapshotView<float>> view{ HierarchySnapshotView<float>::make( bytes ) };
+
+    assert( view );
+    assert( view->size() == 8 ); // The root and 7 nodes
+    assert( view->nameCount() == 5 ); // "", "shoulder", "arm", "hand" and "finger"
+
+    const char *expected_names[] = { "", "shoulder", "arm", "arm", "hand", "finger", "finger", "" };
+    const int   expected_parents[] = { -1, 0, 1, 2, 3, 4, 4, 1 };
+
+    for (std::size_t i = 0; i < view->size(); ++i)
+    {
+        assert( view->name( i ) == expected_names[i] );
+        assert( view->parent( i ) == expected_parents[i] );
+    }
+
+    assert( approximately_equal_to( view->transform( 1 ), world.findNode( "shoulder" )->coordinate_system() ) );
+    assert( approximately_equal_to( view->transform( 4 ), world.findNode( "hand" )->coordinate_system() ) );
+}
+
+void WorldTransformsMatchTheHierarchy()
+{
+    std::cout << __func__ << std::endl;
+
+    HierarchicalCoordinateSystemf world;
+
+    GenerateArm( world );
+
+    std::vector<std::byte>           bytes{ make_hierarchy_snapshot( world ) };
+    HierarchySnapshotView<float>     view{ *HierarchySnapshotView<float>::make( bytes ) };
+    std::vector<DualQuaternionf>     world_transforms( view.size() );
+
+    view.worldTransforms( world_transforms );
+
+    assert( approximately_equal_to( world_transforms[4], world.findNode( "hand" )->concatenatedTransforms() ) );
+    assert( approximately_equal_to( world_transforms[6], world.findNodes( "finger" )[1]->concatenatedTransforms() ) );
+}
+
+void InvalidSnapshotsAreRejected()
+{
+    std::cout << __func__ << std::endl;
+
+    HierarchicalCoordinateSystemf world;
+
+    GenerateArm( world );
+
+    std::vector<std::byte> bytes{ make_hierarchy_snapshot( world ) };
+
+    assert( !HierarchySnapshotView<double>::make( bytes ) ); // Wrong scalar type
+    assert( !HierarchySnapshotView<float>::make( std::span<const std::byte>{ bytes }.first( bytes.size() - 1 ) ) ); // Truncated
+    assert( !HierarchySnapshotView<float>::make( {} ) );
+
+    // Corrupts one entry of a section and checks that the snapshot is rejected
+    auto rejects = [&bytes](auto section_offset, std::size_t index, auto value)
+        {
+            HierarchySnapshotHeader header;
+
+            std::memcpy( &header, bytes.data(), sizeof(header) );
+
+            std::vector<std::byte> corrupt{ bytes };
+
+            std::memcpy( corrupt.data() + header.*section_offset + sizeof(value) * index, &value, sizeof(value) );
+            return !HierarchySnapshotView<float>::make( corrupt );
+        };
+
+    assert( HierarchySnapshotView<float>::make( bytes ) );
+    assert( rejects( &HierarchySnapshotHeader::parents_offset, 0, std::int32_t{ 0 } ) );   // The root has a parent
+    assert( rejects( &HierarchySnapshotHeader::parents_offset, 3, std::int32_t{ -1 } ) );  // A second root
+    assert( rejects( &HierarchySnapshotHeader::parents_offset, 3, std::int32_t{ 3 } ) );   // Its own parent
+    assert( rejects( &HierarchySnapshotHeader::parents_offset, 3, std::int32_t{ 5 } ) );   // A parent after the child
+    assert( rejects( &HierarchySnapshotHeader::parents_offset, 3, std::int32_t{ 100 } ) ); // Out of range
+    assert( rejects( &HierarchySnapshotHeader::name_ids_offset, 2, std::uint32_t{ 5 } ) ); // Past the name table
+    assert( rejects( &HierarchySnapshotHeader::name_offsets_offset, 1, std::uint32_t{ 9 } ) ); // "shoulder" would have a negative length
+
+    // Trusted views only check the header and the sizes of the sections
+    assert( HierarchySnapshotView<float>::makeTrusted( bytes ) );
+    assert( !HierarchySnapshotView<double>::makeTrusted( bytes ) );
+    assert( !HierarchySnapshotView<float>::makeTrusted( std::span<const std::byte>{ bytes }.first( bytes.size() - 1 ) ) );
+
+    bytes[0] = std::byte{ 'X' };
+
+    assert( !HierarchySnapshotView<float>::make( bytes ) ); // Bad magic
+}
+
+void SaveAndLoadMappedFile()
+{
+    std::cout << __func__ << std::endl;
+
+    std::filesystem::path file_name{ std::filesystem::temp_directory_path() / "MathLibHierarchySnapshotTest.bin" };
+
+    {
+        HierarchicalCoordinateSystemf world;
+
+        GenerateArm( world );
+
+        assert( save_hierarchy_snapshot( world, file_name ) );
+    }
+
+    {
+        std::optional<MappedHierarchySnapshot<float>> snapshot{ MappedHierarchySnapshot<float>::open( file_name ) };
+
+        assert( snapshot );
+        assert( (*snapshot)->size() == 8 );
+        assert( (*snapshot)->name( 4 ) == "hand" );
+        assert( MappedHierarchySnapshot<float>::openTrusted( file_name ) );
+
+        // Turn it back into a live hierarchy
+        HierarchicalCoordinateSystemf reloaded;
+        HierarchicalCoordinateSystemf original;
+
+        GenerateArm( original );
+        snapshot->view().instantiate( reloaded );
+
+        std::shared_ptr<SceneNodef> reloaded_hand{ reloaded.findPath( "shoulder/arm/arm/hand" ) };
+
+        assert( reloaded_hand );
+        assert( reloaded.findNodes( "finger" ).size() == 2 );
+        assert( reloaded.root().children().front()->children().size() == 2 );
+        assert( approximately_equal_to( reloaded_hand->concatenatedTransforms(), original.findNode( "hand" )->concatenatedTransforms() ) );
+        CHECK_IF_EQUAL( reloaded.findNodes( "finger" )[1]->localToWorld( Vector3Df::zero() ),
+                        original.findNodes( "finger" )[1]->localToWorld( Vector3Df::zero() ) );
+    }
+
+    std::filesystem::remove( file_name );
+
+    assert( !MappedHierarchySnapshot<float>::open( file_name ) ); // No longer exists
+    assert( !MappedHierarchySnapshot<float>::openTrusted( file_name ) );
+}
+
+/** Run all of the unit tests in this namespace
+ * 
+ */
+void Run()
+{
+    std::cout << "Running HierarchySnapshot Tests..." << std::endl;
+
+    SnapshotContainsEveryNodeInPreOrder();
+    WorldTransformsMatchTheHierarchy();
+    InvalidSnapshotsAreRejected();
+    SaveAndLoadMappedFile();
+
+    std::cout << "PASSED!" << std::endl;
+}
+}
+/// @}
\ No newline at end of file
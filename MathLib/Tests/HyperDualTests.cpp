@@ -0,0 +1,153 @@
+#include "HyperDualTests.hpp"
+#include "math/HyperDual.hpp"
+#include "math/HyperDualN.hpp"
+#include "math/Dual.hpp"
+#include "math/Checks.hpp"
+#include <cassert>
+#include <cmath>
+#include <iostream>
+
+
+/** @file
+ * 
+ *  @hideincludegraph
+ */
+
+/** @defgroup HyperDualTests Hyper-Dual Number Unit Tests
+ * 
+ *  Here are all the unit tests used to exercise the HyperDual class
+ * 
+ *  @ingroup UnitTests
+ * 
+ *  @{
+ */
+
+/** Contains the unit tests for HyperDual
+ * 
+ */
+namespace HyperDualTests
+{
+
+using namespace Math;
+
+/** Compares the second derivative carried through @p function with a central difference of the first derivatives */
+template <class Function>
+static void CheckSecondDerivative(Function function, double x)
+{
+    const double h = 1e-6;
+    HyperDuald   result{ function( HyperDuald::variable( x ) ) };
+    double       first{ function( Duald{ x, 1.0 } ).dual };
+    double       central_difference{ (function( Duald{ x + h, 1.0 } ).dual - function( Duald{ x - h, 1.0 } ).dual) / (2.0 * h) };
+
+    CHECK_IF_EQUAL( result.real, function( Duald{ x } ).real );
+    CHECK_IF_EQUAL( result.e1, first );
+    CHECK_IF_EQUAL( result.e2, first );
+    CHECK_IF_EQUAL( result.e12, central_difference, 1e-4f );
+}
+
+void ArithmeticFollowsTheProductRule()
+{
+    std::cout << __func__ << std::endl;
+
+    HyperDuald x{ HyperDuald::variable( 3.0 ) };
+
+    // x^3 / (x + 1)
+    HyperDuald y{ x * x * x / (x + 1.0) };
+
+    CHECK_IF_EQUAL( y.real, 27.0 / 4.0 );
+    CHECK_IF_EQUAL( y.e1, (2.0 * 27.0 + 3.0 * 9.0) / 16.0 );
+    CHECK_IF_EQUAL( y.e12, (6.0 * 9.0 + 6.0 * 3.0) / 16.0 - 2.0 * (2.0 * 27.0 + 3.0 * 9.0) / 64.0 );
+
+    // Different seeds give the mixed partial derivative of x * y^2
+    HyperDuald a{ 2.0, 1.0, 0.0, 0.0 };
+    HyperDuald b{ 5.0, 0.0, 1.0, 0.0 };
+
+    CHECK_IF_EQUAL( (a * b * b).e12, 2.0 * 5.0 );
+    CHECK_IF_EQUAL( (2.0 - a / b).real, 2.0 - 0.4 );
+    assert( a < b && a > 1.0 && -a < 0.0 );
+}
+
+void FunctionsCarryTheirSecondDerivatives()
+{
+    std::cout << __func__ << std::endl;
+
+    for (double x : { 0.3, 0.7 })
+    {
+        CheckSecondDerivative( [](auto v) { return sqrt( v ); }, x );
+        CheckSecondDerivative( [](auto v) { return cbrt( v ); }, x );
+        CheckSecondDerivative( [](auto v) { return pow( v, 3.5 ); }, x );
+        CheckSecondDerivative( [](auto v) { return pow( 2.0, v ); }, x );
+        CheckSecondDerivative( [](auto v) { return pow( v, v ); }, x );
+        CheckSecondDerivative( [](auto v) { return hypot( v, v * v - 1.0 ); }, x );
+        CheckSecondDerivative( [](auto v) { return exp( v ); }, x );
+        CheckSecondDerivative( [](auto v) { return log( v ); }, x );
+        CheckSecondDerivative( [](auto v) { return log2( v ); }, x );
+        CheckSecondDerivative( [](auto v) { return log10( v ); }, x );
+        CheckSecondDerivative( [](auto v) { return sin( v ); }, x );
+        CheckSecondDerivative( [](auto v) { return cos( v ); }, x );
+        CheckSecondDerivative( [](auto v) { return tan( v ); }, x );
+        CheckSecondDerivative( [](auto v) { return asin( v ); }, x );
+        CheckSecondDerivative( [](auto v) { return acos( v ); }, x );
+        CheckSecondDerivative( [](auto v) { return atan( v ); }, x );
+        CheckSecondDerivative( [](auto v) { return atan2( v * v, 1.0 - v ); }, x );
+        CheckSecondDerivative( [](auto v) { return sinh( v ); }, x );
+        CheckSecondDerivative( [](auto v) { return cosh( v ); }, x );
+        CheckSecondDerivative( [](auto v) { return tanh( v ); }, x );
+        CheckSecondDerivative( [](auto v) { return abs( 0.5 - v ); }, x );
+
+        // Compositions use the chain rule
+        CheckSecondDerivative( [](auto v) { return sin( exp( v ) * v ) / sqrt( v + 1.0 ); }, x );
+    }
+
+    // Whole powers are smooth at zero
+    CHECK_IF_EQUAL( pow( HyperDuald::variable( 0.0 ), 1.0 ).e12, 0.0 );
+    CHECK_IF_EQUAL( pow( HyperDuald::variable( 0.0 ), 2.0 ).e12, 2.0 );
+}
+
+void EachLaneOfAHyperDualNMatchesAHyperDual()
+{
+    std::cout << __func__ << std::endl;
+
+    auto function = [](auto x, auto y)
+        {
+            return hypot( x, y ) * atan2( y, x ) + pow( x, y ) / (y + 3.0) - abs( sin( x * y ) ) + 2.0 * exp( -x );
+        };
+
+    const double x = 0.8;
+    const double y = 1.3;
+
+    // The first part seeds x and the second parts seed x and y
+    HyperDualNd<2> x_n{ x };
+    HyperDualNd<2> y_n{ y };
+
+    x_n.e1    = 1.0;
+    x_n.e2[0] = 1.0;
+    y_n.e2[1] = 1.0;
+
+    const HyperDualNd<2> result{ function( x_n, y_n ) };
+    const HyperDuald     xx{ function( HyperDuald{ x, 1.0, 1.0, 0.0 }, HyperDuald{ y } ) };
+    const HyperDuald     xy{ function( HyperDuald{ x, 1.0, 0.0, 0.0 }, HyperDuald{ y, 0.0, 1.0, 0.0 } ) };
+
+    CHECK_IF_EQUAL( result.real, xx.real );
+    CHECK_IF_EQUAL( result.e1, xx.e1 );
+    CHECK_IF_EQUAL( result.e2[0], xx.e2 );
+    CHECK_IF_EQUAL( result.e2[1], xy.e2 );
+    CHECK_IF_EQUAL( result.e12[0], xx.e12 );
+    CHECK_IF_EQUAL( result.e12[1], xy.e12 );
+}
+
+/** Run all of the unit tests in this namespace
+ * 
+ */
+void Run()
+{
+    std::cout << "Running Hyper-Dual Number Tests..." << std::endl;
+
+    ArithmeticFollowsTheProductRule();
+    FunctionsCarryTheirSecondDerivatives();
+    EachLaneOfAHyperDualNMatchesAHyperDual();
+
+    std::cout << "PASSED!" << std::endl;
+}
+}
+/// @}
\ No newline at end of file
@@ -0,0 +1,279 @@
+#include "InverseKinematicsTests.hpp"
+#include "math/InverseKinematics.hpp"
+#include "math/Conversions.hpp"
+#include <cassert>
+#include <iostream>
+#include <numbers>
+#include <vector>
+
+
+/** @file
+ * 
+ *  @hideincludegraph
+ */
+
+/** @defgroup InverseKinematicsTests Inverse Kinematics Unit Tests
+ * 
+ *  Here are all the unit tests used to exercise the IKChain class
+ * 
+ *  @ingroup UnitTests
+ * 
+ *  @{
+ */
+
+/** Contains the unit tests for IKChain
+ * 
+ */
+namespace InverseKinematicsTests
+{
+
+using namespace Math;
+using namespace Math::Literals;
+
+/** An arm of three bones, each one long, that points along x from @p base
+ *
+ *  @return The shoulder, elbow, wrist and hand nodes
+ */
+static std::vector<std::shared_ptr<SceneNoded>> MakeArm(const std::shared_ptr<SceneNoded> &base)
+{
+    std::vector<std::shared_ptr<SceneNoded>> arm{ base->createChildNode( Vector3Dd::zero() ).lock() };
+
+    for (int bone = 0; bone < 3; ++bone)
+        arm.push_back( arm.back()->createChildNode( Vector3Dd::unit_x() ).lock() );
+    return arm;
+}
+
+/** The angle of a joint about @p axis away from the identity */
+static double HingeAngle(const Quaterniond &rotation, const Vector3Dd &axis)
+{
+    return 2.0 * std::atan2( dot( rotation.imaginary(), axis ), rotation.w() );
+}
+
+void EveryMethodReachesAReachableTarget()
+{
+    std::cout << __func__ << std::endl;
+
+    const Vector3Dd target{ 1.5, 1.5, 0.5 };
+
+    for (IKMethod method : { IKMethod::CyclicCoordinateDescent, IKMethod::FABRIK, IKMethod::DampedLeastSquares })
+    {
+        auto     root = SceneNoded::make();
+        auto     arm = MakeArm( root );
+        IKChaind chain{ arm.front(), arm.back() };
+        const IKResult<double> result{ chain.solve( target, { .method = method, .max_iterations = 100, .tolerance = 1e-6 } ) };
+
+        assert( chain.jointCount() == 3 );
+        assert( result.reached );
+        assert( result.iterations > 0 );
+        assert( result.distance <= 1e-6 );
+
+        // The nodes were updated
+        CHECK_IF_EQUAL( arm.back()->localToWorld( Vector3Dd::zero() ), target, 1e-5 );
+        CHECK_IF_EQUAL( chain.endEffectorPosition(), target, 1e-5 );
+    }
+}
+
+void ATargetThatIsAlreadyReachedTakesNoIterations()
+{
+    std::cout << __func__ << std::endl;
+
+    auto     root = SceneNoded::make();
+    auto     arm = MakeArm( root );
+    IKChaind chain{ arm.front(), arm.back() };
+    const IKResult<double> result{ chain.solve( { 3.0, 0.0, 0.0 } ) };
+
+    assert( result.reached );
+    assert( result.iterations == 0 );
+    CHECK_IF_EQUAL( chain.rotation( 1 ), Quaterniond::identity() );
+}
+
+void AnUnreachableTargetStretchesTheChainTowardsIt()
+{
+    std::cout << __func__ << std::endl;
+
+    for (IKMethod method : { IKMethod::CyclicCoordinateDescent, IKMethod::FABRIK })
+    {
+        auto     root = SceneNoded::make();
+        auto     arm = MakeArm( root );
+        IKChaind chain{ arm.front(), arm.back() };
+        const IKResult<double> result{ chain.solve( { 0.0, 10.0, 0.0 }, { .method = method, .max_iterations = 50 } ) };
+
+        assert( !result.reached );
+        CHECK_IF_EQUAL( result.distance, 7.0, 1e-3 );
+        CHECK_IF_EQUAL( chain.endEffectorPosition(), Vector3Dd{ 0.0, 3.0, 0.0 }, 1e-2 );
+    }
+}
+
+void TheChainFollowsTheTransformOfItsParent()
+{
+    std::cout << __func__ << std::endl;
+
+    auto root = SceneNoded::make();
+    auto body = root->createChildNode( { 5.0, -2.0, 1.0 }, Quaterniond::make_rotation( 90.0_deg, Vector3Dd::unit_z() ) ).lock();
+    auto arm = MakeArm( body );
+    IKChaind chain{ arm.front(), arm.back() };
+
+    // At rest the hand is at (5, 1, 1), pointing along the rotated x axis
+    CHECK_IF_EQUAL( arm.back()->localToWorld( Vector3Dd::zero() ), Vector3Dd{ 5.0, 1.0, 1.0 }, 1e-6 );
+
+    const Vector3Dd        target{ 6.0, 0.0, 2.0 };
+    const IKResult<double> result{ chain.solve( target, { .method = IKMethod::FABRIK, .max_iterations = 100, .tolerance = 1e-6 } ) };
+
+    assert( result.reached );
+    CHECK_IF_EQUAL( arm.back()->localToWorld( Vector3Dd::zero() ), target, 1e-5 );
+}
+
+void HingesStayWithinTheirLimits()
+{
+    std::cout << __func__ << std::endl;
+
+    const double limit = std::numbers::pi / 6.0;
+
+    for (IKMethod method : { IKMethod::CyclicCoordinateDescent, IKMethod::FABRIK, IKMethod::DampedLeastSquares })
+    {
+        auto     root = SceneNoded::make();
+        auto     arm = MakeArm( root );
+        IKChaind chain{ arm.front(), arm.back() };
+
+        for (std::size_t joint = 0; joint < chain.jointCount(); ++joint)
+            chain.setLimit( joint, IKJointLimit<double>::hinge( Vector3Dd::unit_z(), Radiand{ -limit }, Radiand{ limit } ) );
+
+        // Curling all the way back is out of the range of the hinges
+        chain.solve( { -1.0, 0.5, 0.0 }, { .method = method, .max_iterations = 50 } );
+
+        for (std::size_t joint = 0; joint < chain.jointCount(); ++joint)
+        {
+            const Quaterniond &rotation{ chain.rotation( joint ) };
+
+            assert( rotation.isUnit() );
+            assert( std::abs( HingeAngle( rotation, Vector3Dd::unit_z() ) ) <= limit + 1e-9 );
+            CHECK_IF_ZERO( rotation.i(), 1e-9f );
+            CHECK_IF_ZERO( rotation.j(), 1e-9f );
+        }
+
+        // The hand stays in the plane of the hinges
+        CHECK_IF_ZERO( chain.endEffectorPosition().z, 1e-9f );
+    }
+}
+
+void BallJointsStayWithinTheirLimits()
+{
+    std::cout << __func__ << std::endl;
+
+    const double limit = std::numbers::pi / 8.0;
+    auto         root = SceneNoded::make();
+    auto         arm = MakeArm( root );
+    IKChaind     chain{ arm.front(), arm.back() };
+
+    for (std::size_t joint = 0; joint < chain.jointCount(); ++joint)
+        chain.setLimit( joint, IKJointLimit<double>::ball( Radiand{ limit } ) );
+
+    const IKResult<double> result{ chain.solve( { 0.0, 1.0, 1.0 }, { .max_iterations = 50 } ) };
+
+    assert( !result.reached );
+    for (std::size_t joint = 0; joint < chain.jointCount(); ++joint)
+        assert( chain.rotation( joint ).angle().value() <= limit + 1e-9 );
+}
+
+void LimitsAreRelativeToTheRestRotation()
+{
+    std::cout << __func__ << std::endl;
+
+    auto root = SceneNoded::make();
+    auto shoulder = root->createChildNode( Vector3Dd::zero(), Quaterniond::make_rotation( 90.0_deg, Vector3Dd::unit_z() ) ).lock();
+    auto hand = shoulder->createChildNode( Vector3Dd::unit_x() ).lock();
+    IKChaind chain{ shoulder, hand };
+
+    chain.setLimit( 0, IKJointLimit<double>::hinge( Vector3Dd::unit_z(), Radiand{ 0.0 }, Radiand{ std::numbers::pi / 2.0 } ) );
+
+    // From pointing along y the hinge can only turn towards -x
+    chain.solve( { 1.0, 0.0, 0.0 } );
+    CHECK_IF_EQUAL( chain.endEffectorPosition(), Vector3Dd::unit_y(), 1e-6 );
+
+    const IKResult<double> result{ chain.solve( { -1.0, 0.0, 0.0 } ) };
+
+    assert( result.reached );
+}
+
+void StartingFromThePreviousSolutionTakesFewerIterations()
+{
+    std::cout << __func__ << std::endl;
+
+    auto     root = SceneNoded::make();
+    auto     arm = MakeArm( root );
+    IKChaind chain{ arm.front(), arm.back() };
+    const IKSettings<double> settings{ .method = IKMethod::DampedLeastSquares, .max_iterations = 200, .tolerance = 1e-6 };
+
+    assert( chain.solve( { 1.0, 2.0, 0.5 }, settings ).reached );
+
+    // Something else, like an animation, puts the arm back to its rest pose
+    for (std::size_t joint = 0; joint < chain.jointCount(); ++joint)
+        arm[joint]->setCoordinateSystem( DualQuaterniond::make_coordinate_system( Quaterniond::identity(), joint == 0 ? 0.0 : 1.0, 0.0, 0.0 ) );
+
+    // The target only moved a little since the last frame
+    IKChaind cold_chain{ arm.front(), arm.back() };
+    const IKResult<double> cold{ cold_chain.solve( { 1.05, 2.0, 0.5 }, settings ) };
+    const IKResult<double> warm{ chain.solve( { 1.05, 2.0, 0.5 }, settings ) };
+
+    assert( cold.reached );
+    assert( warm.reached );
+    assert( warm.iterations < cold.iterations );
+}
+
+void BatchedSolvesMatchIndividualSolves()
+{
+    std::cout << __func__ << std::endl;
+
+    const std::size_t                        count = 8;
+    std::vector<std::shared_ptr<SceneNoded>> roots;
+    std::vector<IKChaind>                    chains;
+    std::vector<Vector3Dd>                   targets;
+    std::vector<IKResult<double>>            results( count );
+    const IKSettings<double>                 settings{ .method = IKMethod::FABRIK, .max_iterations = 100, .tolerance = 1e-6 };
+
+    for (std::size_t character = 0; character < count; ++character)
+    {
+        auto root = roots.emplace_back( SceneNoded::make() );
+        auto arm = MakeArm( root );
+
+        chains.emplace_back( arm.front(), arm.back() );
+        targets.push_back( Vector3Dd{ 1.0, 0.25 * static_cast<double>( character ), 1.0 } );
+    }
+
+    solve_ik_chains<double>( chains, targets, settings, results );
+
+    for (std::size_t character = 0; character < count; ++character)
+    {
+        auto     arm = MakeArm( SceneNoded::make() );
+        IKChaind chain{ arm.front(), arm.back() };
+        const IKResult<double> result{ chain.solve( targets[character], settings ) };
+
+        assert( results[character].reached );
+        assert( results[character].iterations == result.iterations );
+        CHECK_IF_EQUAL( chains[character].endEffectorPosition(), chain.endEffectorPosition(), 1e-12 );
+    }
+}
+/// @}
+
+/** Run all of the unit tests in this namespace
+ * 
+ */
+void Run()
+{
+    std::cout << "Running Inverse Kinematics Tests..." << std::endl;
+
+    EveryMethodReachesAReachableTarget();
+    ATargetThatIsAlreadyReachedTakesNoIterations();
+    AnUnreachableTargetStretchesTheChainTowardsIt();
+    TheChainFollowsTheTransformOfItsParent();
+    HingesStayWithinTheirLimits();
+    BallJointsStayWithinTheirLimits();
+    LimitsAreRelativeToTheRestRotation();
+    StartingFromThePreviousSolutionTakesFewerIterations();
+    BatchedSolvesMatchIndividualSolves();
+
+    std::cout << "PASSED!" << std::endl;
+}
+
+}
+/// @}
\ No newline at end of file
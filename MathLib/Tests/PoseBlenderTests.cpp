@@ -0,0 +1,190 @@
+#include "PoseBlenderTests.hpp"
+#include "math/PoseBlender.hpp"
+#include "math/Conversions.hpp"
+#include <cassert>
+#include <iostream>
+#include <vector>
+
+
+/** @file
+ * 
+ *  @hideincludegraph
+ */
+
+/** @defgroup PoseBlenderTests PoseBlender Unit Tests
+ * 
+ *  Here are all the unit tests used to exercise the PoseBlender class
+ * 
+ *  @ingroup UnitTests
+ * 
+ *  @{
+ */
+
+/** Contains the unit tests for PoseBlender
+ * 
+ */
+namespace PoseBlenderTests
+{
+
+using namespace Math;
+using namespace Math::Literals;
+
+/** A pose where every bone is rotated by @p angle about @p axis and moved by @p offset */
+static std::vector<DualQuaternionf> GeneratePose(std::size_t bone_count, Degreef angle, Vector3Df axis, Vector3Df offset)
+{
+    return std::vector<DualQuaternionf>( bone_count, DualQuaternionf{ Quaternionf::make_rotation( angle, axis ), offset } );
+}
+
+void ASinglePoseIsUnchanged()
+{
+    std::cout << __func__ << std::endl;
+
+    std::vector<DualQuaternionf> pose{ GeneratePose( 4, 33.0_deg_f, Vector3Df{ 1.0f, 2.0f, 3.0f }.normalized(), { 1.0f, -2.0f, 0.5f } ) };
+    std::vector<DualQuaternionf> output( 4 );
+    PoseBlenderf                 blender{ 4 };
+
+    blender.addPose( pose, 0.25f );
+    blender.blend( output );
+
+    for (std::size_t bone = 0; bone < 4; ++bone)
+    {
+        assert( approximately_equal_to( output[bone], pose[bone] ) );
+        CHECK_IF_EQUAL( blender.totalWeight( bone ), 0.25f );
+    }
+}
+
+void PosesAreBlendedByWeight()
+{
+    std::cout << __func__ << std::endl;
+
+    std::vector<DualQuaternionf> rest{ GeneratePose( 3, 0.0_deg_f, Vector3Df::unit_z(), { 0.0f, 0.0f, 0.0f } ) };
+    std::vector<DualQuaternionf> turned{ GeneratePose( 3, 90.0_deg_f, Vector3Df::unit_z(), { 0.0f, 0.0f, 0.0f } ) };
+    std::vector<DualQuaternionf> moved{ GeneratePose( 3, 0.0_deg_f, Vector3Df::unit_z(), { 2.0f, 0.0f, 0.0f } ) };
+    std::vector<DualQuaternionf> output( 3 );
+    PoseBlenderf                 blender{ 3 };
+
+    blender.addPose( rest, 1.0f );
+    blender.addPose( turned, 1.0f );
+    blender.blend( output );
+    CHECK_IF_EQUAL( output[1].rotation(), Quaternionf::make_rotation( 45.0_deg_f, Vector3Df::unit_z() ) );
+
+    blender.reset();
+    blender.addPose( rest, 0.75f );
+    blender.addPose( moved, 0.25f );
+    blender.blend( output );
+    CHECK_IF_EQUAL( output[2].translation(), Vector3Df( 0.5f, 0.0f, 0.0f ) );
+    assert( output[2].is_unit() );
+
+    // The sign of a pose doesn't matter
+    std::vector<DualQuaternionf> negated_turned;
+
+    for (const DualQuaternionf &bone : turned)
+        negated_turned.push_back( bone * -1.0f );
+
+    blender.reset();
+    blender.addPose( rest, 1.0f );
+    blender.addPose( negated_turned, 1.0f );
+    blender.blend( output );
+
+    Quaternionf rotation{ output[0].rotation() };
+
+    if ( rotation.w() < 0.0f )
+        rotation = -rotation;
+    CHECK_IF_EQUAL( rotation, Quaternionf::make_rotation( 45.0_deg_f, Vector3Df::unit_z() ) );
+}
+
+void MasksLimitWhichBonesArePosed()
+{
+    std::cout << __func__ << std::endl;
+
+    std::vector<DualQuaternionf> legs{ GeneratePose( 4, 20.0_deg_f, Vector3Df::unit_x(), { 0.0f, 1.0f, 0.0f } ) };
+    std::vector<DualQuaternionf> wave{ GeneratePose( 4, 60.0_deg_f, Vector3Df::unit_y(), { 0.0f, 0.0f, 1.0f } ) };
+    std::vector<float>           upper_body{ 0.0f, 0.0f, 1.0f, 1.0f };
+    std::vector<DualQuaternionf> output( 4 );
+    PoseBlenderf                 blender{ 4 };
+
+    blender.addPose( legs, 1.0f );
+    blender.addPose( wave, 1.0f, upper_body );
+    blender.blend( output );
+
+    CHECK_IF_EQUAL( blender.totalWeight( 0 ), 1.0f );
+    CHECK_IF_EQUAL( blender.totalWeight( 3 ), 2.0f );
+    assert( approximately_equal_to( output[0], legs[0] ) );
+    assert( approximately_equal_to( output[1], legs[1] ) );
+    assert( !approximately_equal_to( output[2], legs[2] ) );
+
+    // Bones without any weight are left at the identity
+    PoseBlenderf only_upper{ 4 };
+
+    only_upper.addPose( wave, 1.0f, upper_body );
+    only_upper.blend( output );
+    assert( approximately_equal_to( output[0], DualQuaternionf{} ) );
+    assert( approximately_equal_to( output[3], wave[3] ) );
+}
+
+void AdditivePosesAreLayeredOnTop()
+{
+    std::cout << __func__ << std::endl;
+
+    std::vector<DualQuaternionf> base{ GeneratePose( 2, 90.0_deg_f, Vector3Df::unit_x(), { 1.0f, 0.0f, 0.0f } ) };
+    std::vector<DualQuaternionf> reference{ GeneratePose( 2, 10.0_deg_f, Vector3Df::unit_z(), { 0.0f, 0.0f, 0.0f } ) };
+    std::vector<DualQuaternionf> nod{ GeneratePose( 2, 40.0_deg_f, Vector3Df::unit_z(), { 0.0f, 0.0f, 0.0f } ) };
+    std::vector<DualQuaternionf> output( 2 );
+    PoseBlenderf                 blender{ 2 };
+
+    blender.addPose( base, 1.0f );
+    blender.addAdditivePose( nod, reference, 1.0f );
+    blender.blend( output );
+
+    assert( approximately_equal_to( output[0], base[0] * DualQuaternionf{ Quaternionf::make_rotation( 30.0_deg_f, Vector3Df::unit_z() ), Vector3Df{} } ) );
+
+    // Half of it
+    blender.reset();
+    blender.addPose( base, 1.0f );
+    blender.addAdditivePose( nod, reference, 0.5f );
+    blender.blend( output );
+
+    assert( approximately_equal_to( output[1], base[1] * DualQuaternionf{ Quaternionf::make_rotation( 15.0_deg_f, Vector3Df::unit_z() ), Vector3Df{} } ) );
+}
+
+void BlendsAreWrittenIntoTheHierarchy()
+{
+    std::cout << __func__ << std::endl;
+
+    HierarchicalCoordinateSystemf skeleton;
+    std::shared_ptr<SceneNodef>   hips{ skeleton.root().createChildNode( { 0.0f, 1.0f, 0.0f }, Quaternionf::identity(), "hips" ) };
+
+    hips->createChildNode( { 0.0f, 0.5f, 0.0f }, Quaternionf::identity(), "spine" );
+
+    std::vector<DualQuaternionf> a{ GeneratePose( 3, 0.0_deg_f, Vector3Df::unit_z(), { 0.0f, 1.0f, 0.0f } ) };
+    std::vector<DualQuaternionf> b{ GeneratePose( 3, 90.0_deg_f, Vector3Df::unit_z(), { 0.0f, 1.0f, 0.0f } ) };
+    PoseBlenderf                 blender{ 3 };
+    std::uint64_t                version_before{ skeleton.version() };
+
+    blender.addPose( a, 0.5f );
+    blender.addPose( b, 0.5f );
+    blender.apply( skeleton );
+
+    assert( skeleton.version() > version_before );
+    CHECK_IF_EQUAL( std::as_const( *skeleton.findNode( "spine" ) ).coordinate_system().rotation(),
+                    Quaternionf::make_rotation( 45.0_deg_f, Vector3Df::unit_z() ) );
+    CHECK_IF_EQUAL( std::as_const( *hips ).coordinate_system().translation(), Vector3Df( 0.0f, 1.0f, 0.0f ) );
+}
+
+/** Run all of the unit tests in this namespace
+ * 
+ */
+void Run()
+{
+    std::cout << "Running PoseBlender Tests..." << std::endl;
+
+    ASinglePoseIsUnchanged();
+    PosesAreBlendedByWeight();
+    MasksLimitWhichBonesArePosed();
+    AdditivePosesAreLayeredOnTop();
+    BlendsAreWrittenIntoTheHierarchy();
+
+    std::cout << "PASSED!" << std::endl;
+}
+}
+/// @}
\ No newline at end of file
@@ -0,0 +1,202 @@
+#include "QuaternionAverageTests.hpp"
+#include "math/QuaternionAverage.hpp"
+#include "math/Conversions.hpp"
+#include "math/Checks.hpp"
+#include <cassert>
+#include <iostream>
+#include <vector>
+
+
+/** @file
+ * 
+ *  @hideincludegraph
+ */
+
+/** @defgroup QuaternionAverageTests Quaternion Average Unit Tests
+ * 
+ *  Here are all the unit tests used to exercise the averaging of Quaternions and DualQuaternions
+ * 
+ *  @ingroup UnitTests
+ * 
+ *  @{
+ */
+
+/** Contains the unit tests for QuaternionAccumulator and DualQuaternionAccumulator
+ * 
+ */
+namespace QuaternionAverageTests
+{
+
+using namespace Math;
+using namespace Math::Literals;
+
+/** Rotations scattered around @p center by up to @p spread degrees, with every other one negated */
+static std::vector<Quaterniond> GenerateSamples(const Quaterniond &center, double spread)
+{
+    std::vector<Quaterniond> samples;
+
+    for (int i = 0; i < 24; ++i)
+    {
+        Vector3Dd   axis{ std::sin( i * 1.1 ), std::cos( i * 0.7 ), std::sin( i * 2.3 + 1.0 ) };
+        Quaterniond sample{ center * Quaterniond::make_rotation( Degreed( spread ), axis.normalized() ) };
+        Quaterniond mirror{ center * Quaterniond::make_rotation( Degreed( -spread ), axis.normalized() ) };
+
+        samples.push_back( (i % 2) ? -sample : sample );
+        samples.push_back( mirror );
+    }
+    return samples;
+}
+
+/** The sum of the squared dot products that markleyMean() maximizes */
+static double Closeness(const std::vector<Quaterniond> &samples, const Quaterniond &average)
+{
+    double total = 0.0;
+
+    for (const Quaterniond &sample : samples)
+        total += dot( sample, average ) * dot( sample, average );
+    return total;
+}
+
+void SymmetricSamplesAverageToTheirCenter()
+{
+    std::cout << __func__ << std::endl;
+
+    Quaterniond           center{ Quaterniond::make_rotation( 50.0_deg, Vector3Dd{ 1.0, 1.0, 0.0 }.normalized() ) };
+    QuaternionAccumulatord accumulator;
+
+    for (const Quaterniond &sample : GenerateSamples( center, 20.0 ))
+        accumulator.add( sample );
+
+    assert( accumulator.count() == 48 );
+    CHECK_IF_EQUAL( accumulator.totalWeight(), 48.0 );
+    CHECK_IF_EQUAL( accumulator.mean(), center );
+    CHECK_IF_EQUAL( accumulator.markleyMean(), center );
+}
+
+void WeightsAreRespected()
+{
+    std::cout << __func__ << std::endl;
+
+    QuaternionAccumulatord accumulator;
+    Quaterniond            turned{ Quaterniond::make_rotation( 90.0_deg, Vector3Dd::unit_z() ) };
+
+    accumulator.add( Quaterniond::identity(), 2.0 );
+    accumulator.add( -turned, 2.0 );
+    accumulator.add( Quaterniond::make_rotation( 160.0_deg, Vector3Dd::unit_x() ), 0.0 );
+
+    CHECK_IF_EQUAL( accumulator.mean(), Quaterniond::make_rotation( 45.0_deg, Vector3Dd::unit_z() ) );
+    CHECK_IF_EQUAL( accumulator.markleyMean(), Quaterniond::make_rotation( 45.0_deg, Vector3Dd::unit_z() ) );
+}
+
+void MarkleyMeanIsTheClosest()
+{
+    std::cout << __func__ << std::endl;
+
+    std::vector<Quaterniond> samples{ Quaterniond::identity(),
+                                      Quaterniond::make_rotation( 170.0_deg, Vector3Dd::unit_x() ),
+                                      Quaterniond::make_rotation( 120.0_deg, Vector3Dd::unit_y() ),
+                                      Quaterniond::make_rotation( 80.0_deg, Vector3Dd{ 0.0, 1.0, 1.0 }.normalized() ) };
+    QuaternionAccumulatord   accumulator;
+
+    for (const Quaterniond &sample : samples)
+        accumulator.add( sample );
+
+    Quaterniond markley{ accumulator.markleyMean() };
+
+    assert( markley.isUnit() );
+    assert( Closeness( samples, markley ) >= Closeness( samples, accumulator.mean() ) );
+
+    // Small changes to the average only make it worse
+    for (const Quaterniond &nudge : { Quaterniond::make_rotation( 1.0_deg, Vector3Dd::unit_x() ),
+                                      Quaterniond::make_rotation( 1.0_deg, Vector3Dd::unit_y() ),
+                                      Quaterniond::make_rotation( -1.0_deg, Vector3Dd::unit_z() ) })
+        assert( Closeness( samples, markley ) >= Closeness( samples, markley * nudge ) );
+}
+
+void MergingMatchesASingleAccumulator()
+{
+    std::cout << __func__ << std::endl;
+
+    std::vector<Quaterniond> samples{ GenerateSamples( Quaterniond::make_rotation( 100.0_deg, Vector3Dd::unit_y() ), 35.0 ) };
+    QuaternionAccumulatord   everything;
+    QuaternionAccumulatord   first_half;
+    QuaternionAccumulatord   second_half;
+
+    for (std::size_t i = 0; i < samples.size(); ++i)
+    {
+        everything.add( samples[i], double(i % 3 + 1) );
+        ((i < samples.size() / 2) ? first_half : second_half).add( (i % 4 == 1) ? -samples[i] : samples[i], double(i % 3 + 1) );
+    }
+
+    QuaternionAccumulatord empty;
+
+    empty.merge( second_half );
+    first_half.merge( empty );
+
+    assert( first_half.count() == everything.count() );
+    CHECK_IF_EQUAL( first_half.totalWeight(), everything.totalWeight() );
+    CHECK_IF_EQUAL( first_half.mean(), everything.mean() );
+    CHECK_IF_EQUAL( first_half.markleyMean(), everything.markleyMean() );
+}
+
+void DualQuaternionsAverageTheirTranslations()
+{
+    std::cout << __func__ << std::endl;
+
+    DualQuaternionAccumulatorf accumulator;
+    DualQuaternionAccumulatorf other;
+    Quaternionf                rotation{ Quaternionf::make_rotation( 30.0_deg_f, Vector3Df::unit_x() ) };
+
+    accumulator.add( DualQuaternionf{ rotation, Vector3Df{ 1.0f, 0.0f, 0.0f } } );
+    accumulator.add( DualQuaternionf{ rotation, Vector3Df{ 3.0f, 2.0f, 0.0f } } * -1.0f );
+    other.add( DualQuaternionf{ rotation, Vector3Df{ 2.0f, 4.0f, 6.0f } }, 2.0f );
+    accumulator.merge( other );
+
+    assert( accumulator.count() == 3 );
+    CHECK_IF_EQUAL( accumulator.mean().rotation(), rotation );
+    CHECK_IF_EQUAL( accumulator.mean().translation(), Vector3Df( 2.0f, 2.5f, 3.0f ) );
+    CHECK_IF_EQUAL( accumulator.markleyMean().rotation(), rotation );
+    CHECK_IF_EQUAL( accumulator.markleyMean().translation(), Vector3Df( 2.0f, 2.5f, 3.0f ) );
+}
+
+void ProductsOfNonCommutingTransformsAverageToTheirProduct()
+{
+    std::cout << __func__ << std::endl;
+
+    const Quaternionf     parent_rotation{ Quaternionf::make_rotation( 90.0_deg_f, Vector3Df::unit_z() ) };
+    const Quaternionf     child_rotation{ Quaternionf::make_rotation( 90.0_deg_f, Vector3Df::unit_x() ) };
+    const DualQuaternionf parent{ parent_rotation, Vector3Df{ 1.0f, 0.0f, 0.0f } };
+    const DualQuaternionf child{ child_rotation, Vector3Df{ 0.0f, 1.0f, 0.0f } };
+    const DualQuaternionf both{ parent * child };
+
+    DualQuaternionAccumulatorf accumulator;
+
+    accumulator.add( both );
+    accumulator.add( both * -1.0f, 2.0f );
+    accumulator.add( both, 0.5f );
+
+    // The child's (0, 1, 0) is turned into (-1, 0, 0) by the parent, which cancels the parent's own (1, 0, 0)
+    CHECK_IF_EQUAL( accumulator.mean().rotation(), parent_rotation * child_rotation );
+    CHECK_IF_EQUAL( accumulator.mean().translation(), Vector3Df( 0.0f, 0.0f, 0.0f ) );
+    CHECK_IF_EQUAL( accumulator.markleyMean().rotation(), parent_rotation * child_rotation );
+    CHECK_IF_EQUAL( accumulator.markleyMean().translation(), Vector3Df( 0.0f, 0.0f, 0.0f ) );
+}
+
+/** Run all of the unit tests in this namespace
+ * 
+ */
+void Run()
+{
+    std::cout << "Running Quaternion Average Tests..." << std::endl;
+
+    SymmetricSamplesAverageToTheirCenter();
+    WeightsAreRespected();
+    MarkleyMeanIsTheClosest();
+    MergingMatchesASingleAccumulator();
+    DualQuaternionsAverageTheirTranslations();
+    ProductsOfNonCommutingTransformsAverageToTheirProduct();
+
+    std::cout << "PASSED!" << std::endl;
+}
+}
+/// @}
\ No newline at end of file
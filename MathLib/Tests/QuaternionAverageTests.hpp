@@ -0,0 +1,6 @@
+#pragma once
+
+namespace QuaternionAverageTests
+{
+    void Run();
+}
\ No newline at end of file
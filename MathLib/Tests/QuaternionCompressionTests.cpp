@@ -0,0 +1,184 @@
+#include "QuaternionCompressionTests.hpp"
+#include "math/QuaternionCompression.hpp"
+#include "math/Conversions.hpp"
+#include <cassert>
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+
+/** @file
+ * 
+ *  @hideincludegraph
+ */
+
+/** @defgroup QuaternionCompressionTests Quaternion Compression Unit Tests
+ * 
+ *  Here are all the unit tests used to exercise the compression of Quaternions
+ * 
+ *  @ingroup UnitTests
+ * 
+ *  @{
+ */
+
+/** Contains the unit tests for Quaternion compression
+ * 
+ */
+namespace QuaternionCompressionTests
+{
+
+using namespace Math;
+using namespace Math::Literals;
+
+/** Generates rotations spread over many axes and angles, including the
+ *  awkward ones where two components have the same magnitude
+ */
+template <class T>
+static std::vector<Quaternion<T>> GenerateRotations()
+{
+    std::vector<Quaternion<T>> rotations{ Quaternion<T>::identity(),
+                                          Quaternion<T>::unit_i(),
+                                          Quaternion<T>{ T{-1}, T{}, T{}, T{} },
+                                          Quaternion<T>{ T{0.5}, T{-0.5}, T{0.5}, T{-0.5} },
+                                          Quaternion<T>{ T{1}, T{}, T{}, T{1} }.normalized() };
+
+    for (int axis = 0; axis < 24; ++axis)
+    {
+        Vector3D<T> direction{ T( std::sin( axis * 0.7 ) ), T( std::cos( axis * 1.3 ) ), T( axis % 5 ) - T{2} };
+
+        for (int angle = -360; angle <= 360; angle += 15)
+            rotations.push_back( Quaternion<T>::make_rotation( Degree<T>( T(angle) ), direction.normalized() ) );
+    }
+    return rotations;
+}
+
+template <class Format, class T>
+static void CheckRoundTrip()
+{
+    const T largest_error{ max_compression_error<Format, T>() };
+
+    for (const Quaternion<T> &original : GenerateRotations<T>())
+    {
+        Quaternion<T> decompressed{ decompress_quaternion<Format, T>( compress_quaternion<Format>( original ) ) };
+
+        assert( decompressed.isUnit() );
+
+        if ( dot( original, decompressed ) < T{0} )
+            decompressed = -decompressed;
+
+        assert( std::abs( decompressed.w() - original.w() ) <= largest_error );
+        assert( std::abs( decompressed.i() - original.i() ) <= largest_error );
+        assert( std::abs( decompressed.j() - original.j() ) <= largest_error );
+        assert( std::abs( decompressed.k() - original.k() ) <= largest_error );
+    }
+}
+
+void FormatsHaveTheExpectedSize()
+{
+    std::cout << __func__ << std::endl;
+
+    static_assert( sizeof( SmallestThree32::packed_type ) == 4 );
+    static_assert( sizeof( SmallestThree48::packed_type ) == 6 );
+    static_assert( sizeof( SmallestThree64::packed_type ) == 8 );
+
+    static_assert( max_compression_error<SmallestThree32>() < 0.0021f );
+    static_assert( max_compression_error<SmallestThree48>() < 0.000065f );
+    static_assert( max_compression_error<SmallestThree64, double>() < 0.0000021 );
+}
+
+void CompressedRotationsAreWithinTheMaximumError()
+{
+    std::cout << __func__ << std::endl;
+
+    CheckRoundTrip<SmallestThree32, float>();
+    CheckRoundTrip<SmallestThree48, float>();
+    CheckRoundTrip<SmallestThree32, double>();
+    CheckRoundTrip<SmallestThree48, double>();
+    CheckRoundTrip<SmallestThree64, double>();
+}
+
+void CompressingTheNegationGivesTheSameResult()
+{
+    std::cout << __func__ << std::endl;
+
+    Quaternionf rotation{ Quaternionf::make_rotation( 250.0_deg_f, Vector3Df{ 1.0f, -2.0f, 0.5f }.normalized() ) };
+
+    assert( compress_quaternion<SmallestThree32>( rotation ) == compress_quaternion<SmallestThree32>( -rotation ) );
+    assert( compress_quaternion<SmallestThree48>( rotation ) == compress_quaternion<SmallestThree48>( -rotation ) );
+}
+
+void BatchesMatchSingleQuaternions()
+{
+    std::cout << __func__ << std::endl;
+
+    std::vector<Quaternionf>                  rotations{ GenerateRotations<float>() };
+    std::vector<SmallestThree48::packed_type> packed( rotations.size() );
+    std::vector<Quaternionf>                  unpacked( rotations.size() );
+
+    compress_quaternions<SmallestThree48, float>( rotations, packed );
+    decompress_quaternions<SmallestThree48, float>( packed, unpacked );
+
+    for (std::size_t i = 0; i < rotations.size(); ++i)
+    {
+        assert( packed[i] == compress_quaternion<SmallestThree48>( rotations[i] ) );
+        assert( unpacked[i] == (decompress_quaternion<SmallestThree48, float>( packed[i] )) );
+    }
+}
+
+template <class Format, class T>
+static void CheckArraysMatchSingleQuaternions()
+{
+    std::vector<Quaternion<T>>                rotations{ GenerateRotations<T>() };
+    std::vector<T>                            w, i, j, k;
+    std::vector<typename Format::packed_type> packed( rotations.size() );
+
+    for (const Quaternion<T> &rotation : rotations)
+    {
+        w.push_back( rotation.w() );
+        i.push_back( rotation.i() );
+        j.push_back( rotation.j() );
+        k.push_back( rotation.k() );
+    }
+
+    compress_quaternions<Format, T>( QuaternionArrays<const T>{ w, i, j, k }, packed );
+
+    for (std::size_t n = 0; n < rotations.size(); ++n)
+        assert( packed[n] == compress_quaternion<Format>( rotations[n] ) );
+
+    std::fill( w.begin(), w.end(), T{} );
+    std::fill( i.begin(), i.end(), T{} );
+    std::fill( j.begin(), j.end(), T{} );
+    std::fill( k.begin(), k.end(), T{} );
+
+    decompress_quaternions<Format, T>( packed, QuaternionArrays<T>{ w, i, j, k } );
+
+    for (std::size_t n = 0; n < rotations.size(); ++n)
+        assert( (Quaternion<T>{ w[n], i[n], j[n], k[n] }) == (decompress_quaternion<Format, T>( packed[n] )) );
+}
+
+void ArraysMatchSingleQuaternions()
+{
+    std::cout << __func__ << std::endl;
+
+    CheckArraysMatchSingleQuaternions<SmallestThree32, float>();
+    CheckArraysMatchSingleQuaternions<SmallestThree48, float>();
+    CheckArraysMatchSingleQuaternions<SmallestThree64, double>();
+}
+
+/** Run all of the unit tests in this namespace
+ * 
+ */
+void Run()
+{
+    std::cout << "Running Quaternion Compression Tests..." << std::endl;
+
+    FormatsHaveTheExpectedSize();
+    CompressedRotationsAreWithinTheMaximumError();
+    CompressingTheNegationGivesTheSameResult();
+    BatchesMatchSingleQuaternions();
+    ArraysMatchSingleQuaternions();
+
+    std::cout << "PASSED!" << std::endl;
+}
+}
+/// @}
\ No newline at end of file
@@ -0,0 +1,6 @@
+#pragma once
+
+namespace QuaternionCompressionTests
+{
+    void Run();
+}
\ No newline at end of file
@@ -0,0 +1,167 @@
+#include "QuaternionSplineTests.hpp"
+#include "math/QuaternionSpline.hpp"
+#include "math/Conversions.hpp"
+#include "math/Checks.hpp"
+#include <cassert>
+#include <iostream>
+
+
+/** @file
+ * 
+ *  @hideincludegraph
+ */
+
+/** @defgroup QuaternionSplineTests QuaternionSpline Unit Tests
+ * 
+ *  Here are all the unit tests used to exercise the Quaternion splines
+ * 
+ *  @ingroup UnitTests
+ * 
+ *  @{
+ */
+
+/** Contains the unit tests for QuaternionSpline
+ * 
+ */
+namespace QuaternionSplineTests
+{
+
+using namespace Math;
+using namespace Math::Literals;
+
+static std::vector<Quaterniond> GenerateCameraRail()
+{
+    return { Quaterniond::identity(),
+             Quaterniond::make_rotation( 40.0_deg, Vector3Dd::unit_y() ),
+             Quaterniond::make_rotation( 70.0_deg, Vector3Dd{ 1.0, 1.0, 0.0 }.normalized() ),
+             Quaterniond::make_rotation( 30.0_deg, Vector3Dd::unit_x() ),
+             Quaterniond::make_rotation( -20.0_deg, Vector3Dd::unit_z() ) };
+}
+
+/** Makes sure that @p left and @p right are the same rotation */
+static void CheckSameRotation(Quaterniond left, const Quaterniond &right, double tolerance = 0.0001)
+{
+    if ( dot( left, right ) < 0.0 )
+        left = -left;
+    CHECK_IF_EQUAL( left, right, tolerance );
+}
+
+/** Estimates the angular velocity of @p spline at @p parameter from one side */
+static Vector3Dd AngularVelocity(const QuaternionSplined &spline, double parameter, double step)
+{
+    Quaterniond from{ spline.evaluate( parameter ) };
+    Quaterniond to{ spline.evaluate( parameter + step ) };
+
+    return (from.conjugate() * to).log().imaginary() * (2.0 / step);
+}
+
+void SplinesGoThroughTheirKeys()
+{
+    std::cout << __func__ << std::endl;
+
+    std::vector<Quaterniond> keys{ GenerateCameraRail() };
+
+    for (auto kind : { QuaternionSplined::Kind::Squad, QuaternionSplined::Kind::CatmullRom })
+    {
+        QuaternionSplined spline{ keys, kind };
+
+        for (std::size_t i = 0; i < keys.size(); ++i)
+            CheckSameRotation( spline.evaluate( double(i) ), keys[i] );
+
+        for (std::size_t i = 0; i + 1 < keys.size(); ++i)
+        {
+            CheckSameRotation( spline.evaluate( i, 0.0 ), keys[i] );
+            CheckSameRotation( spline.evaluate( i, 1.0 ), keys[i + 1] );
+        }
+
+        // Clamped at the ends
+        CheckSameRotation( spline.evaluate( -1.0 ), keys.front() );
+        CheckSameRotation( spline.evaluate( 10.0 ), keys.back() );
+    }
+}
+
+void EvenlySpacedKeysGiveAConstantSpin()
+{
+    std::cout << __func__ << std::endl;
+
+    std::vector<Quaterniond> keys;
+
+    for (int i = 0; i < 5; ++i)
+        keys.push_back( Quaterniond::make_rotation( Degreed( 30.0 * i ), Vector3Dd::unit_x() ) );
+
+    for (auto kind : { QuaternionSplined::Kind::Squad, QuaternionSplined::Kind::CatmullRom })
+    {
+        QuaternionSplined spline{ keys, kind };
+
+        // Away from the ends, where the tangent is one-sided
+        CheckSameRotation( spline.evaluate( 1.5 ), Quaterniond::make_rotation( 45.0_deg, Vector3Dd::unit_x() ) );
+        CheckSameRotation( spline.evaluate( 2.25 ), Quaterniond::make_rotation( 67.5_deg, Vector3Dd::unit_x() ) );
+    }
+}
+
+void AngularVelocityIsContinuousAtKeys()
+{
+    std::cout << __func__ << std::endl;
+
+    const double step = 0.0001;
+
+    for (auto kind : { QuaternionSplined::Kind::Squad, QuaternionSplined::Kind::CatmullRom })
+    {
+        QuaternionSplined spline{ GenerateCameraRail(), kind };
+
+        for (double key : { 1.0, 2.0, 3.0 })
+        {
+            Vector3Dd before{ AngularVelocity( spline, key - step, step ) };
+            Vector3Dd after{ AngularVelocity( spline, key, step ) };
+
+            CHECK_IF_EQUAL( before, after, 0.01 );
+        }
+    }
+}
+
+void KeysOnOppositeHemispheresTakeTheShortWay()
+{
+    std::cout << __func__ << std::endl;
+
+    std::vector<Quaterniond> keys{ GenerateCameraRail() };
+    std::vector<Quaterniond> flipped{ keys };
+
+    flipped[1] = -flipped[1];
+    flipped[3] = -flipped[3];
+
+    QuaternionSplined spline{ keys };
+    QuaternionSplined flipped_spline{ flipped };
+
+    for (double parameter = 0.0; parameter <= 4.0; parameter += 0.3)
+        CheckSameRotation( flipped_spline.evaluate( parameter ), spline.evaluate( parameter ) );
+}
+
+void FreeFunctionsMatchTheSpline()
+{
+    std::cout << __func__ << std::endl;
+
+    std::vector<Quaterniond> keys{ GenerateCameraRail() };
+    QuaternionSplined        spline{ keys, QuaternionSplined::Kind::Squad };
+    Quaterniond              control_1{ squad_control_point( keys[0], keys[1], keys[2] ) };
+    Quaterniond              control_2{ squad_control_point( keys[1], keys[2], keys[3] ) };
+
+    CheckSameRotation( squad( keys[1], keys[2], control_1, control_2, 0.3 ), spline.evaluate( 1.3 ) );
+}
+
+/** Run all of the unit tests in this namespace
+ * 
+ */
+void Run()
+{
+    std::cout << "Running QuaternionSpline Tests..." << std::endl;
+
+    SplinesGoThroughTheirKeys();
+    EvenlySpacedKeysGiveAConstantSpin();
+    AngularVelocityIsContinuousAtKeys();
+    KeysOnOppositeHemispheresTakeTheShortWay();
+    FreeFunctionsMatchTheSpline();
+
+    std::cout << "PASSED!" << std::endl;
+}
+}
+/// @}
\ No newline at end of file
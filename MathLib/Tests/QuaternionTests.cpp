@@ -3,8 +3,12 @@
 #include "math/Conversions.hpp"
 #include "math/Exponential.hpp"
 #include "math/Checks.hpp"
+#include "math/Dual.hpp"
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <iostream>
+#include <numbers>
 
 /** @file
  * 
@@ -606,6 +610,159 @@ void ExpAndLogAreInversesOfEachOther()
     CHECK_IF_EQUAL( exp( log(c) ), c );
 }
 
+void PowLogAndExpStayAccurateNearTheIdentity()
+{
+    std::cout << __func__ << std::endl;
+
+    Vector3Dd axis{ Vector3Dd{ 1.0, -2.0, 2.0 }.normalized() };
+
+    // Either side of the switch to the series expansions
+    for (double angle : { 0.0, 1e-9, 1e-5, 3e-4, 0.01, 0.1, 2.0 })
+    {
+        Quaterniond rotation{ Quaterniond::make_rotation( Radiand( angle ), axis ) };
+
+        CHECK_IF_EQUAL( rotation.log().w(), 0.0 );
+        CHECK_IF_EQUAL( rotation.log().imaginary(), axis * (0.5 * angle) );
+        CHECK_IF_EQUAL( exp( Quaterniond::make_pure( axis * (0.5 * angle) ) ), rotation );
+        CHECK_IF_EQUAL( rotation.pow( 3.0 ), Quaterniond::make_rotation( Radiand( 3.0 * angle ), axis ) );
+        CHECK_IF_EQUAL( rotation.pow( -0.25 ), Quaterniond::make_rotation( Radiand( -0.25 * angle ), axis ) );
+
+        // The relative precision of the angle is kept as well
+        if ( angle > 0.0 )
+            CHECK_IF_EQUAL( rotation.log().imaginary().magnitude() / (0.5 * angle), 1.0 );
+    }
+
+    for (float angle : { 1e-6f, 0.039f, 0.041f, 1.0f })
+    {
+        Quaternionf rotation{ Quaternionf::make_rotation( Radianf( angle ), Vector3Df::unit_x() ) };
+
+        CHECK_IF_EQUAL( rotation.log().imaginary().x / (0.5f * angle), 1.0f );
+        CHECK_IF_EQUAL( rotation.pow( 0.5f ).i() / std::sin( 0.25f * angle ), 1.0f );
+    }
+
+    // A rotation of a full turn has no axis, but still doesn't produce a NaN
+    assert( !Quaternionf{ -1.0f }.log().isNaN() );
+    assert( !Quaternionf{ -1.0f }.pow( 0.5f ).isNaN() );
+}
+
+void BatchedFunctionsMatchTheMemberFunctions()
+{
+    std::cout << __func__ << std::endl;
+
+    const Quaternionf input[] = { Quaternionf::identity(),
+                                  Quaternionf::make_rotation( 0.001_deg_f, Vector3Df::unit_y() ),
+                                  Quaternionf::make_rotation( 36.3_deg_f, Vector3Df::unit_y() ),
+                                  Quaternionf::make_rotation( 170.0_deg_f, Vector3Df{ 1.0f, 1.0f, 1.0f }.normalized() ) };
+    Quaternionf       output[4];
+
+    log_quaternions<float>( input, output );
+    for (std::size_t i = 0; i < 4; ++i)
+        CHECK_IF_EQUAL( output[i], input[i].log() );
+
+    exp_quaternions<float>( input, output );
+    for (std::size_t i = 0; i < 4; ++i)
+        CHECK_IF_EQUAL( output[i], input[i].exp() );
+
+    pow_quaternions<float>( input, 0.3f, output );
+    for (std::size_t i = 0; i < 4; ++i)
+        CHECK_IF_EQUAL( output[i], input[i].pow( 0.3f ) );
+
+    const Radianf   angles[] = { Radianf{ 0.0f }, Radianf{ 1.0f }, Radianf{ -2.5f }, Radianf{ 6.0f } };
+    const Vector3Df axes[] = { Vector3Df::unit_x(), Vector3Df{ 0.0f, 3.0f, 4.0f }, Vector3Df::unit_z(), Vector3Df{ 1.0f, 1.0f, -1.0f } };
+
+    make_rotations<StandardMath, float>( angles, axes, output );
+    for (std::size_t i = 0; i < 4; ++i)
+        CHECK_IF_EQUAL( output[i], Quaternionf::make_rotation( angles[i], axes[i] ) );
+
+    const Vector3Df directions[] = { Vector3Df::unit_z(), Vector3Df{ 0.0f, 3.0f, 4.0f }, Vector3Df{ -1.0f, 0.0f, 0.0f }, Vector3Df{ 1.0f, 1.0f, -1.0f } };
+
+    from_to_rotations<float>( axes, directions, output );
+    for (std::size_t i = 0; i < 4; ++i)
+        CHECK_IF_EQUAL( output[i], Quaternionf::from_to( axes[i], directions[i] ) );
+
+    look_rotations<float>( directions, Vector3Df::unit_y(), output );
+    for (std::size_t i = 0; i < 4; ++i)
+        CHECK_IF_EQUAL( output[i], Quaternionf::look_rotation( directions[i], Vector3Df::unit_y() ) );
+}
+
+static Vector3Dd Rotate(const Quaterniond &rotation, const Vector3Dd &point)
+{
+    return passively_rotate_encoded_point( rotation, Quaterniond::encode_point( point ) ).imaginary();
+}
+
+void FromToTurnsOneDirectionIntoTheOther()
+{
+    std::cout << __func__ << std::endl;
+
+    const Vector3Dd directions[] = { Vector3Dd::unit_x(), Vector3Dd::unit_y(), Vector3Dd{ 0.0, 0.0, -1.0 },
+                                     Vector3Dd{ 1.0, 2.0, 3.0 }, Vector3Dd{ -0.5, 0.0, 7.0 }, Vector3Dd{ 1e-3, -4.0, 0.25 } };
+
+    for (const Vector3Dd &from : directions)
+    {
+        for (const Vector3Dd &to : directions)
+        {
+            const Quaterniond rotation{ Quaterniond::from_to( from, to ) };
+
+            assert( rotation.isUnit() );
+            CHECK_IF_EQUAL( Rotate( rotation, from.normalized() ), to.normalized(), 1e-12 );
+
+            // The shortest rotation turns by the angle between them
+            CHECK_IF_EQUAL( rotation.angle().value(), std::acos( std::clamp( dot( from.normalized(), to.normalized() ), -1.0, 1.0 ) ), 1e-6f );
+        }
+
+        // Including to the opposite direction
+        const Quaterniond half_turn{ Quaterniond::from_to( from, from * -2.0 ) };
+
+        assert( half_turn.isUnit() );
+        CHECK_IF_EQUAL( Rotate( half_turn, from ), from * -1.0, 1e-12 );
+    }
+
+    CHECK_IF_EQUAL( Quaterniond::from_to( Vector3Dd{}, Vector3Dd::unit_x() ), Quaterniond::identity() );
+    CHECK_IF_EQUAL( Quaterniond::from_to( Vector3Dd::unit_x(), Vector3Dd::unit_x() * 3.0 ), Quaterniond::identity() );
+}
+
+void FromToHandlesNearlyOppositeDirections()
+{
+    std::cout << __func__ << std::endl;
+
+    const Vector3Df from{ 1.0f, 0.3f, -0.2f };
+
+    // Close enough to opposite that |from| |to| + from . to is mostly rounding error in float
+    for (float nudge : { 0.0f, 5e-7f, 1e-6f, 1e-5f, 1e-3f })
+    {
+        const Vector3Df   to{ -1.0f, -0.3f + nudge, 0.2f };
+        const Quaternionf rotation{ Quaternionf::from_to( from, to ) };
+
+        assert( rotation.isUnit() );
+        CHECK_IF_EQUAL( passively_rotate_encoded_point( rotation, Quaternionf::encode_point( from.normalized() ) ).imaginary(), to.normalized(), 2e-6f );
+    }
+}
+
+void LookRotationFacesForwardWithUpAbove()
+{
+    std::cout << __func__ << std::endl;
+
+    const Vector3Dd up{ Vector3Dd{ 0.1, 1.0, -0.2 } };
+
+    for (int n = 0; n < 40; ++n)
+    {
+        const Vector3Dd   forward{ std::cos( n * 1.3 ) * 2.0, std::sin( n * 0.7 ), std::cos( n * 2.9 + 0.5 ) };
+        const Quaterniond rotation{ Quaterniond::look_rotation( forward, up ) };
+
+        assert( rotation.isUnit() );
+        CHECK_IF_EQUAL( Rotate( rotation, Vector3Dd::unit_z() ), forward.normalized(), 1e-12 );
+
+        // The new x axis is level, and the new y axis leans towards up
+        CHECK_IF_ZERO( dot( Rotate( rotation, Vector3Dd::unit_x() ), up ), 1e-12f );
+        assert( dot( Rotate( rotation, Vector3Dd::unit_y() ), up ) > 0.0 );
+    }
+
+    // Looking straight along up only fixes the forward direction
+    CHECK_IF_EQUAL( Rotate( Quaterniond::look_rotation( up * -3.0, up ), Vector3Dd::unit_z() ), up.normalized() * -1.0, 1e-12 );
+    CHECK_IF_EQUAL( Quaterniond::look_rotation( Vector3Dd{}, up ), Quaterniond::identity() );
+    CHECK_IF_EQUAL( Quaterniond::look_rotation( Vector3Dd::unit_z() ), Quaterniond::identity() );
+}
+
 void TestSlerp()
 {
     std::cout << __func__ << std::endl;
@@ -662,6 +819,56 @@ void DivideByZeroProducesInf()
 
     assert( result.isInf() );
 }
+
+/** Verifies that a Quaternion of dual numbers carries the derivatives of a rotation
+ *
+ */
+void RotationsOfDualNumbersCarryTheirDerivatives()
+{
+    std::cout << __func__ << std::endl;
+
+    const double            angle = 0.4;
+    const Duald             theta{ angle, 1.0 }; // d/dtheta
+    const Quaternion<Duald> rotation{ Quaternion<Duald>::make_rotation( Radian<Duald>{ theta }, Vector3D<Duald>::unit_z() ) };
+    const Quaternion<Duald> rotated{ passively_rotate_encoded_point( rotation, Quaternion<Duald>::encode_point( Vector3D<Duald>::unit_x() ) ) };
+
+    assert( rotation.isUnit() );
+
+    // The point moves around the circle at unit speed
+    CHECK_IF_EQUAL( rotated.i().real,  std::cos( angle ), 1e-12f );
+    CHECK_IF_EQUAL( rotated.j().real,  std::sin( angle ), 1e-12f );
+    CHECK_IF_EQUAL( rotated.i().dual, -std::sin( angle ), 1e-12f );
+    CHECK_IF_EQUAL( rotated.j().dual,  std::cos( angle ), 1e-12f );
+    CHECK_IF_ZERO( rotated.k().dual, 1e-12f );
+
+    // And the angle of the rotation changes at the same rate as theta
+    CHECK_IF_EQUAL( rotation.angle().value().real, angle, 1e-12f );
+    CHECK_IF_EQUAL( rotation.angle().value().dual, 1.0, 1e-12f );
+    CHECK_IF_EQUAL( rotation.conjugate().k().dual, -0.5 * std::cos( angle / 2.0 ), 1e-12f );
+}
+
+/** Verifies that rotations can be computed at compile time, e.g. for tables of them
+ *
+ */
+void RotationsCanBeMadeAtCompileTime()
+{
+    std::cout << __func__ << std::endl;
+
+    constexpr Quaterniond quarter_turn{ Quaterniond::make_rotation( Radiand{ std::numbers::pi / 2.0 }, Vector3Dd::unit_z() ) };
+    constexpr Quaternionf rotations[] = { Quaternionf::make_rotation( 30.0_deg_f, Vector3Df{ 1.0f, 2.0f, 3.0f } ),
+                                          Quaternionf::make_rotation( 200.0_deg_f, Vector3Df::unit_x() ),
+                                          Quaternionf{ 1.0f, 2.0f, 3.0f, 4.0f }.normalized() };
+
+    static_assert( quarter_turn.isUnit() );
+    static_assert( approximately_equal_to( quarter_turn.w(), std::numbers::sqrt2 / 2.0, 1e-15 ) );
+    static_assert( approximately_equal_to( quarter_turn.angle().value(), std::numbers::pi / 2.0, 1e-15 ) );
+    static_assert( rotations[0].isUnit() && rotations[1].isUnit() && rotations[2].isUnit() );
+    static_assert( approximately_equal_to( rotations[1].angle().value(), 200.0f * std::numbers::pi_v<float> / 180.0f ) );
+
+    // And match the ones computed at run time
+    CHECK_IF_EQUAL( quarter_turn, Quaterniond::make_rotation( Radiand{ std::numbers::pi / 2.0 }, Vector3Dd::unit_z() ), 1e-15 );
+    CHECK_IF_EQUAL( rotations[0], Quaternionf::make_rotation( 30.0_deg_f, Vector3Df{ 1.0f, 2.0f, 3.0f } ), 1e-7f );
+}
 /// @}
 
 /** Run all of the unit tests in this namespace
@@ -711,10 +918,17 @@ void Run()
     TestPow();
     TestExp();
     ExpAndLogAreInversesOfEachOther();
+    PowLogAndExpStayAccurateNearTheIdentity();
+    BatchedFunctionsMatchTheMemberFunctions();
+    FromToTurnsOneDirectionIntoTheOther();
+    FromToHandlesNearlyOppositeDirections();
+    LookRotationFacesForwardWithUpAbove();
     TestSlerp();
     IsNaNIsTrueWhenAtLeastOneMemberIsNaN();
     IsInfIsTrueWhenAtLeastOneMemberIsInf();
     DivideByZeroProducesInf();
+    RotationsOfDualNumbersCarryTheirDerivatives();
+    RotationsCanBeMadeAtCompileTime();
 
     std::cout << "PASSED!" << std::endl;
 }
@@ -0,0 +1,158 @@
+#include "RotationIntegrationTests.hpp"
+#include "math/RotationIntegration.hpp"
+#include "math/Conversions.hpp"
+#include "math/Checks.hpp"
+#include <cassert>
+#include <iostream>
+#include <vector>
+
+
+/** @file
+ * 
+ *  @hideincludegraph
+ */
+
+/** @defgroup RotationIntegrationTests Rotation Integration Unit Tests
+ * 
+ *  Here are all the unit tests used to exercise the integration of angular velocities
+ * 
+ *  @ingroup UnitTests
+ * 
+ *  @{
+ */
+
+/** Contains the unit tests for rotation integration
+ * 
+ */
+namespace RotationIntegrationTests
+{
+
+using namespace Math;
+using namespace Math::Literals;
+
+/** Spins about @p axis at @p radians_per_second for one second in @p steps steps */
+template <RotationIntegrator Method>
+static Quaterniond Spin(Vector3Dd axis, double radians_per_second, int steps)
+{
+    Quaterniond rotation{ Quaterniond::identity() };
+
+    for (int n = 0; n < steps; ++n)
+        rotation = integrate_rotation<Method>( rotation, axis * radians_per_second, 1.0 / steps );
+    return rotation;
+}
+
+static double Error(const Quaterniond &result, const Quaterniond &expected)
+{
+    return std::min( (result - expected).magnitude(), (result + expected).magnitude() );
+}
+
+void MethodsConvergeToTheExactRotation()
+{
+    std::cout << __func__ << std::endl;
+
+    const Vector3Dd   axis{ Vector3Dd{ 1.0, 2.0, 2.0 }.normalized() };
+    const Quaterniond expected{ Quaterniond::make_rotation( Radiand( 3.0 ), axis ) };
+
+    CHECK_IF_EQUAL( Spin<RotationIntegrator::ExponentialMap>( axis, 3.0, 1 ), expected );
+    CHECK_IF_EQUAL( Spin<RotationIntegrator::ExponentialMap>( axis, 3.0, 7 ), expected );
+    CHECK_IF_EQUAL( Spin<RotationIntegrator::RungeKutta4>( axis, 3.0, 60 ), expected );
+
+    // Each method is more accurate than the one before it
+    double euler_error{ Error( Spin<RotationIntegrator::Euler>( axis, 3.0, 60 ), expected ) };
+    double runge_kutta_error{ Error( Spin<RotationIntegrator::RungeKutta4>( axis, 3.0, 60 ), expected ) };
+
+    assert( euler_error > 0.0001 );
+    assert( runge_kutta_error < euler_error );
+    assert( runge_kutta_error < 0.000001 );
+    assert( Spin<RotationIntegrator::Euler>( axis, 3.0, 60 ).isUnit() );
+
+    // Standing still
+    CHECK_IF_EQUAL( integrate_rotation<RotationIntegrator::ExponentialMap>( expected, Vector3Dd{}, 0.5 ), expected );
+}
+
+void ExponentialMapMatchesExp()
+{
+    std::cout << __func__ << std::endl;
+
+    Quaterniond start{ Quaterniond::make_rotation( 30.0_deg, Vector3Dd::unit_y() ) };
+    Vector3Dd   angular_velocity{ 0.3, -1.2, 2.0 };
+    double      time_step = 0.05;
+
+    CHECK_IF_EQUAL( integrate_rotation<RotationIntegrator::ExponentialMap>( start, angular_velocity, time_step ),
+                    exp( Quaterniond::make_pure( angular_velocity * (0.5 * time_step) ) ) * start );
+}
+
+void BodyFrameIsRotatedWorldFrame()
+{
+    std::cout << __func__ << std::endl;
+
+    // Tipped onto its side, spinning about its own Z axis is spinning about the world's -Y axis
+    Quaterniond on_its_side{ Quaterniond::make_rotation( 90.0_deg, Vector3Dd::unit_x() ) };
+    Quaterniond body{ integrate_rotation<RotationIntegrator::ExponentialMap>( on_its_side, Vector3Dd::unit_z(), 0.25, AngularVelocityFrame::Body ) };
+    Quaterniond world{ integrate_rotation<RotationIntegrator::ExponentialMap>( on_its_side, Vector3Dd( 0.0, -1.0, 0.0 ), 0.25 ) };
+
+    CHECK_IF_EQUAL( body, world );
+}
+
+template <RotationIntegrator Method, class Policy = StandardMath>
+static void CheckBatchMatches(AngularVelocityFrame frame)
+{
+    std::vector<float> w, i, j, k, x, y, z;
+
+    for (int n = 0; n < 37; ++n)
+    {
+        Quaternionf rotation{ Quaternionf::make_rotation( Degreef( 10.0f * n ), Vector3Df{ 1.0f, float(n % 3), -1.0f }.normalized() ) };
+
+        w.push_back( rotation.w() );
+        i.push_back( rotation.i() );
+        j.push_back( rotation.j() );
+        k.push_back( rotation.k() );
+        x.push_back( 0.1f * n );
+        y.push_back( (n == 0) ? 0.0f : ((n % 2) ? 3.0f : -2.0f) ); // The first one doesn't turn
+        z.push_back( 0.0f );
+    }
+
+    std::vector<float> w_before{ w }, i_before{ i }, j_before{ j }, k_before{ k };
+
+    integrate_rotations<Method, Policy>( QuaternionArrays<float>{ w, i, j, k }, Vector3DArrays<float>{ x, y, z }, 1.0f / 60.0f, frame );
+
+    for (std::size_t n = 0; n < w.size(); ++n)
+    {
+        Quaternionf single{ integrate_rotation<Method, Policy>( Quaternionf{ w_before[n], i_before[n], j_before[n], k_before[n] },
+                                                                Vector3Df{ x[n], y[n], z[n] },
+                                                                1.0f / 60.0f,
+                                                                frame ) };
+
+        CHECK_IF_EQUAL( Quaternionf( w[n], i[n], j[n], k[n] ), single, 0.00001f );
+    }
+}
+
+void BatchesMatchSingleRotations()
+{
+    std::cout << __func__ << std::endl;
+
+    for (AngularVelocityFrame frame : { AngularVelocityFrame::World, AngularVelocityFrame::Body })
+    {
+        CheckBatchMatches<RotationIntegrator::Euler>( frame );
+        CheckBatchMatches<RotationIntegrator::RungeKutta4>( frame );
+        CheckBatchMatches<RotationIntegrator::ExponentialMap>( frame );
+        CheckBatchMatches<RotationIntegrator::ExponentialMap, fast::MediumPrecision>( frame );
+    }
+}
+
+/** Run all of the unit tests in this namespace
+ * 
+ */
+void Run()
+{
+    std::cout << "Running Rotation Integration Tests..." << std::endl;
+
+    MethodsConvergeToTheExactRotation();
+    ExponentialMapMatchesExp();
+    BodyFrameIsRotatedWorldFrame();
+    BatchesMatchSingleRotations();
+
+    std::cout << "PASSED!" << std::endl;
+}
+}
+/// @}
\ No newline at end of file
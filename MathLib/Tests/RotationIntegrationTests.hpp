@@ -0,0 +1,6 @@
+#pragma once
+
+namespace RotationIntegrationTests
+{
+    void Run();
+}
\ No newline at end of file
@@ -0,0 +1,255 @@
+#include "SceneDeltaTests.hpp"
+#include "math/SceneDelta.hpp"
+#include "math/HierarchySnapshot.hpp"
+#include "math/Conversions.hpp"
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <initializer_list>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+
+/** @file
+ * 
+ *  @hideincludegraph
+ */
+
+/** @defgroup SceneDeltaTests SceneDelta Unit Tests
+ * 
+ *  Here are all the unit tests used to exercise the encoding of scene transform updates
+ * 
+ *  @ingroup UnitTests
+ * 
+ *  @{
+ */
+
+/** Contains the unit tests for the scene delta stream
+ * 
+ */
+namespace SceneDeltaTests
+{
+
+using namespace Math;
+using namespace Math::Literals;
+
+static void GenerateChain(HierarchicalCoordinateSystemf &world)
+{
+    std::shared_ptr<SceneNodef> base{ world.root().createChildNode( { 0.0f, 1.0f, 0.0f }, Quaternionf::make_rotation( 10.0_deg_f, Vector3Df::unit_y() ), "base" ) };
+    std::shared_ptr<SceneNodef> middle{ base->createChildNode( { 0.5f, 0.0f, 0.0f }, Quaternionf::make_rotation( 20.0_deg_f, Vector3Df::unit_z() ), "middle" ) };
+
+    middle->createChildNode( { 0.5f, 0.0f, 0.0f }, Quaternionf::make_rotation( 30.0_deg_f, Vector3Df::unit_x() ), "tip" );
+    base->createChildNode( { -0.5f, 0.0f, 0.0f }, Quaternionf::identity(), "counterweight" );
+}
+
+static void CheckMatches(const HierarchicalCoordinateSystemf &sender, const HierarchicalCoordinateSystemf &receiver, float tolerance)
+{
+    for (const char *name : { "base", "middle", "tip", "counterweight" })
+    {
+        const DualQuaternionf &sent{ std::as_const( *sender.findNode( name ) ).coordinate_system() };
+        const DualQuaternionf &received{ std::as_const( *receiver.findNode( name ) ).coordinate_system() };
+
+        CHECK_IF_EQUAL( received.rotation(), sent.rotation(), tolerance );
+        CHECK_IF_EQUAL( received.translation(), sent.translation(), tolerance );
+    }
+}
+
+void ModifyingATransformUpdatesTheVersion()
+{
+    std::cout << __func__ << std::endl;
+
+    HierarchicalCoordinateSystemf world;
+
+    GenerateChain( world );
+
+    std::shared_ptr<SceneNodef> tip{ world.findNode( "tip" ) };
+    std::uint64_t               version_before{ world.version() };
+
+    assert( tip->version() <= version_before );
+    assert( std::as_const( *tip ).coordinate_system().rotation() == Quaternionf::make_rotation( 30.0_deg_f, Vector3Df::unit_x() ) );
+    assert( world.version() == version_before ); // Reading doesn't count as a change
+    assert( tip->coordinate_system().rotation() == Quaternionf::make_rotation( 30.0_deg_f, Vector3Df::unit_x() ) );
+    assert( world.version() == version_before ); // Not even through a non-const node
+
+    tip->setCoordinateSystem( DualQuaternionf{ Quaternionf::identity(), Vector3Df{ 1.0f, 0.0f, 0.0f } } );
+
+    assert( world.version() > version_before );
+    assert( tip->version() == world.version() );
+    assert( world.findNode( "middle" )->version() <= version_before );
+
+    // Edits made in place are recorded by markChanged()
+    std::shared_ptr<SceneNodef> middle{ world.findNode( "middle" ) };
+
+    middle->coordinate_system() = middle->coordinate_system() * DualQuaternionf::make_translation( 0.0f, 1.0f, 0.0f );
+    assert( middle->version() <= version_before );
+
+    middle->markChanged();
+    assert( middle->version() == world.version() && middle->version() > tip->version() );
+}
+
+void OnlyChangedNodesAreEncoded()
+{
+    std::cout << __func__ << std::endl;
+
+    HierarchicalCoordinateSystemf sender;
+
+    GenerateChain( sender );
+
+    // Everything counts as changed since version 0
+    std::vector<std::byte> everything;
+    std::uint64_t          version{ encode_scene_delta( sender, 0, everything ) };
+
+    assert( version == sender.version() );
+
+    std::vector<std::byte> nothing;
+
+    assert( encode_scene_delta( sender, version, nothing ) == version );
+    assert( nothing.size() < everything.size() );
+
+    sender.findNode( "tip" )->setCoordinateSystem( DualQuaternionf{ Quaternionf::make_rotation( 75.0_deg_f, Vector3Df::unit_x() ), Vector3Df{ 0.5f, 0.25f, 0.0f } } );
+
+    std::vector<std::byte> one_node;
+
+    assert( encode_scene_delta( sender, version, one_node ) > version );
+    assert( one_node.size() > nothing.size() );
+    assert( one_node.size() < everything.size() );
+    assert( one_node.size() <= nothing.size() + 1 + 6 + 3 * 3 ); // Index, rotation and translation
+}
+
+void ApplyingDeltasReproducesTheSender()
+{
+    std::cout << __func__ << std::endl;
+
+    HierarchicalCoordinateSystemf sender;
+    HierarchicalCoordinateSystemf receiver;
+
+    GenerateChain( sender );
+
+    // Start the receiver off with the same structure
+    std::vector<std::byte> snapshot{ make_hierarchy_snapshot( sender ) };
+
+    HierarchySnapshotView<float>::make( snapshot )->instantiate( receiver );
+
+    std::uint64_t             sent_version{ sender.version() };
+    SceneDeltaDecoder<float>  decoder{ receiver, sent_version };
+    std::vector<std::byte>    log;
+
+    // A few ticks of changes, logged back to back
+    for (int tick = 1; tick <= 3; ++tick)
+    {
+        sender.findNode( "middle" )->setCoordinateSystem( DualQuaternionf{ Quaternionf::make_rotation( Degreef( 20.0f * tick ), Vector3Df::unit_z() ), Vector3Df{ 0.5f, 0.01f * tick, 0.0f } } );
+        sender.findNode( "tip" )->setCoordinateSystem( DualQuaternionf{ Quaternionf::make_rotation( Degreef( -35.0f * tick ), Vector3Df{ 1.0f, 1.0f, 0.0f } ), Vector3Df{ 0.5f, 0.0f, -0.1f * tick } } );
+        sent_version = encode_scene_delta( sender, sent_version, log, 0.0001f );
+    }
+
+    // Replay the log
+    std::span<const std::byte> remaining{ log };
+    int                        messages = 0;
+
+    while ( !remaining.empty() )
+    {
+        std::optional<std::size_t> used{ decoder.apply( remaining ) };
+
+        assert( used );
+        remaining = remaining.subspan( *used );
+        ++messages;
+    }
+
+    assert( messages == 3 );
+    assert( decoder.version() == sent_version );
+    assert( !decoder.apply( log ) ); // Already applied
+    CheckMatches( sender, receiver, 0.0002f );
+    CHECK_IF_EQUAL( receiver.findNode( "tip" )->localToWorld( Vector3Df::unit_x() ),
+                    sender.findNode( "tip" )->localToWorld( Vector3Df::unit_x() ),
+                    0.001f );
+}
+
+void MalformedMessagesAreRejected()
+{
+    std::cout << __func__ << std::endl;
+
+    HierarchicalCoordinateSystemf sender;
+    HierarchicalCoordinateSystemf receiver;
+
+    GenerateChain( sender );
+
+    std::vector<std::byte> message;
+
+    encode_scene_delta( sender, 0, message );
+
+    SceneDeltaDecoder<float> decoder{ receiver }; // Only has a root, so the indices are out of range
+
+    assert( !decoder.apply( message ) );
+    assert( !decoder.apply( std::span<const std::byte>{ message }.first( 5 ) ) ); // Truncated
+    assert( !decoder.apply( {} ) );
+
+    message[0] = std::byte{ 0 };
+
+    assert( !decoder.apply( message ) ); // Wrong tag
+
+    // Hand-made messages for a receiver with the same structure as the sender
+    HierarchicalCoordinateSystemf same_structure;
+
+    GenerateChain( same_structure );
+
+    SceneDeltaDecoder<float> other_decoder{ same_structure };
+    const DualQuaternionf    base_before{ std::as_const( *same_structure.findNode( "base" ) ).coordinate_system() };
+
+    auto make_message = [](std::uint64_t since_version, float precision, std::initializer_list<std::uint64_t> gaps)
+        {
+            using namespace SceneDeltaEncoding;
+
+            std::vector<std::byte> bytes{ message_tag };
+
+            write_varint( bytes, since_version );
+            write_varint( bytes, since_version + 1 );
+            write_little_endian( bytes, std::bit_cast<std::uint32_t>( precision ), 4 );
+            write_varint( bytes, gaps.size() );
+
+            for (std::uint64_t gap : gaps)
+            {
+                write_varint( bytes, gap );
+                write_little_endian( bytes, pack_smallest_three<rotation_bits_per_component>( Quaternionf::identity() ), rotation_bytes );
+                write_varint( bytes, zigzag( 3 ) );
+                write_varint( bytes, 0 );
+                write_varint( bytes, 0 );
+            }
+            return bytes;
+        };
+
+    assert( !other_decoder.apply( make_message( 0, 0.5f, { 1, std::uint64_t{1} << 63 } ) ) );    // Would wrap the index around to negative
+    assert( !other_decoder.apply( make_message( 0, 0.5f, { 1, ~std::uint64_t{0} } ) ) );
+    assert( !other_decoder.apply( make_message( 0, 0.5f, { 1, 3 } ) ) );                          // One past the last node
+    assert( !other_decoder.apply( make_message( 0, 0.0f, { 1 } ) ) );
+    assert( !other_decoder.apply( make_message( 0, -0.5f, { 1 } ) ) );
+    assert( !other_decoder.apply( make_message( 0, std::numeric_limits<float>::quiet_NaN(), { 1 } ) ) );
+    assert( !other_decoder.apply( make_message( 0, std::numeric_limits<float>::infinity(), { 1 } ) ) );
+    assert( !other_decoder.apply( make_message( 5, 0.5f, { 1 } ) ) ); // Doesn't follow on from version 0
+
+    // None of the rejected messages changed anything, not even the ones whose first node was fine
+    assert( other_decoder.version() == 0 );
+    CHECK_IF_EQUAL( std::as_const( *same_structure.findNode( "base" ) ).coordinate_system().translation(), base_before.translation() );
+
+    assert( other_decoder.apply( make_message( 0, 0.5f, { 1, 2 } ) ) );
+    assert( other_decoder.version() == 1 );
+    CHECK_IF_EQUAL( std::as_const( *same_structure.findNode( "base" ) ).coordinate_system().translation(), Vector3Df( 1.5f, 0.0f, 0.0f ) );
+    assert( !other_decoder.apply( make_message( 0, 0.5f, { 1 } ) ) ); // Repeated
+}
+
+/** Run all of the unit tests in this namespace
+ * 
+ */
+void Run()
+{
+    std::cout << "Running SceneDelta Tests..." << std::endl;
+
+    ModifyingATransformUpdatesTheVersion();
+    OnlyChangedNodesAreEncoded();
+    ApplyingDeltasReproducesTheSender();
+    MalformedMessagesAreRejected();
+
+    std::cout << "PASSED!" << std::endl;
+}
+}
+/// @}
\ No newline at end of file
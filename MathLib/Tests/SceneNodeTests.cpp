@@ -2,6 +2,9 @@
 #include "math/SceneNode.hpp"
 #include "math/Quaternion.hpp"
 #include "math/Conversions.hpp"
+#include "math/AutomaticDifferentiation.hpp"
+#include <cmath>
+#include <span>
 #include <cassert>
 #include <iostream>
 
@@ -123,6 +126,97 @@ void AttachChild()
     assert(  child_node->parent().lock() == node );
 }
 
+/** Verify that the names of SceneNodes are interned in the registry of their hierarchy
+ * 
+ */
+void NamesAreInterned()
+{
+    std::cout << __func__ << std::endl;
+
+    std::shared_ptr<SceneNodef> node = SceneNodef::make();
+    std::shared_ptr<SceneNodef> left{ node->createChildNode( Vector3Df::zero(), Quaternionf::identity(), "arm" ) };
+    std::shared_ptr<SceneNodef> right{ node->createChildNode( Vector3Df::zero(), Quaternionf::identity(), "arm" ) };
+    std::shared_ptr<SceneNodef> hand{ left->createChildNode( Vector3Df::zero(), Quaternionf::identity(), "hand" ) };
+
+    assert( node->name().empty() );
+    assert( node->nameId() == SceneNodeRegistry<float>::empty_name() );
+    assert( left->name() == "arm" );
+    assert( left->nameId() == right->nameId() ); // Same name, same id
+    assert( left->nameId() != hand->nameId() );
+    assert( &node->registry() == &hand->registry() ); // The whole tree shares one registry
+    assert( node->registry().nameCount() == 3 ); // "", "arm" and "hand"
+    assert( node->registry().name( hand->nameId() ) == "hand" );
+
+    right->setName( "hand" );
+
+    assert( right->nameId() == hand->nameId() );
+    assert( node->registry().nameCount() == 3 );
+
+    // Detaching re-interns the name in the registry of the detached subtree
+    node->detachChild( left );
+
+    assert( &left->registry() != &node->registry() );
+    assert( left->name() == "arm" );
+    assert( hand->name() == "hand" );
+    assert( left->registry().nameCount() == 3 );
+    assert( left->registry().findFirst( "hand" ) == hand.get() );
+
+    // "arm" went with the last node using it, and its id is reused by the next new name
+    assert( node->registry().nameCount() == 2 ); // "" and "hand"
+    assert( !node->registry().idOf( "arm" ) );
+
+    std::shared_ptr<SceneNodef> leg{ node->createChildNode( Vector3Df::zero(), Quaternionf::identity(), "leg" ) };
+
+    assert( node->registry().nameIdLimit() == 3 );
+    assert( leg->name() == "leg" && right->name() == "hand" );
+
+    // The name outlives the hierarchy it came from
+    node.reset();
+    right.reset();
+
+    assert( left->name() == "arm" );
+}
+
+/** Verifies that the Jacobian of a point with respect to the joint angles comes out of localToWorld()
+ *
+ *  The hierarchy is built with dual numbers in place of the floating-point scalar.
+ */
+void LocalToWorldDifferentiatesWithRespectToJointAngles()
+{
+    std::cout << __func__ << std::endl;
+
+    // A planar arm with a shoulder and an elbow that turn about z, and links 2 and 1 long
+    auto arm_tip = [](std::span<const DualNd<2>> angles, std::span<DualNd<2>> tip)
+        {
+            using Scalar = DualNd<2>;
+
+            auto root      = SceneNode<Scalar>::make();
+            auto upper_arm = root->createChildNode( Vector3D<Scalar>::zero(),
+                                                    Quaternion<Scalar>::make_rotation( Radian<Scalar>{ angles[0] }, Vector3D<Scalar>::unit_z() ) ).lock();
+            auto forearm   = upper_arm->createChildNode( { Scalar{2.0}, Scalar{}, Scalar{} },
+                                                         Quaternion<Scalar>::make_rotation( Radian<Scalar>{ angles[1] }, Vector3D<Scalar>::unit_z() ) ).lock();
+            const Vector3D<Scalar> world_tip{ forearm->localToWorld( { Scalar{1.0}, Scalar{}, Scalar{} } ) };
+
+            tip[0] = world_tip.x;
+            tip[1] = world_tip.y;
+            tip[2] = world_tip.z;
+        };
+    const double shoulder = 0.3;
+    const double elbow    = 0.7;
+    const double angles[] = { shoulder, elbow };
+    double       matrix[6];
+
+    jacobian<2>( arm_tip, std::span<const double>{ angles }, std::span<double>{ matrix } );
+
+    // x = 2 cos(shoulder) + cos(shoulder + elbow) and y = 2 sin(shoulder) + sin(shoulder + elbow)
+    CHECK_IF_EQUAL( matrix[0], -2.0 * std::sin( shoulder ) - std::sin( shoulder + elbow ), 1e-9f );
+    CHECK_IF_EQUAL( matrix[1], -std::sin( shoulder + elbow ), 1e-9f );
+    CHECK_IF_EQUAL( matrix[2],  2.0 * std::cos( shoulder ) + std::cos( shoulder + elbow ), 1e-9f );
+    CHECK_IF_EQUAL( matrix[3],  std::cos( shoulder + elbow ), 1e-9f );
+    CHECK_IF_ZERO( matrix[4], 1e-9f );
+    CHECK_IF_ZERO( matrix[5], 1e-9f );
+}
+
 /** Run all of the unit tests in this namespace
  * 
  */
@@ -134,6 +228,8 @@ void Run()
     CanCreateChildNode();
     DetachChild();
     AttachChild();
+    NamesAreInterned();
+    LocalToWorldDifferentiatesWithRespectToJointAngles();
 
     std::cout << "PASSED!" << std::endl;
 }
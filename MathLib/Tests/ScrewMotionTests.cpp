@@ -0,0 +1,174 @@
+#include "ScrewMotionTests.hpp"
+#include "math/ScrewMotion.hpp"
+#include "math/Conversions.hpp"
+#include "math/Checks.hpp"
+#include <cassert>
+#include <iostream>
+#include <vector>
+
+
+/** @file
+ * 
+ *  @hideincludegraph
+ */
+
+/** @defgroup ScrewMotionTests Screw Motion Unit Tests
+ * 
+ *  Here are all the unit tests used to exercise screw motions and sclerp()
+ * 
+ *  @ingroup UnitTests
+ * 
+ *  @{
+ */
+
+/** Contains the unit tests for screw motions
+ * 
+ */
+namespace ScrewMotionTests
+{
+
+using namespace Math;
+using namespace Math::Literals;
+
+/** A rotation of @p angle about the line through @p point along @p axis, followed by sliding @p slide along it */
+static DualQuaterniond MakeScrew(Degreed angle, Vector3Dd axis, Vector3Dd point, double slide)
+{
+    return DualQuaterniond::make_translation( axis * slide ) *
+           DualQuaterniond::make_translation( point ) *
+           DualQuaterniond::make_rotation( Quaterniond::make_rotation( angle, axis ) ) *
+           DualQuaterniond::make_translation( point * -1.0 );
+}
+
+void ScrewParametersRoundTrip()
+{
+    std::cout << __func__ << std::endl;
+
+    DualQuaterniond   transform{ MakeScrew( 70.0_deg, Vector3Dd{ 0.0, 1.0, 1.0 }.normalized(), { 2.0, 0.0, -1.0 }, 0.75 ) };
+    ScrewParameters   screw{ to_screw_parameters( transform ) };
+
+    CHECK_IF_EQUAL( screw.angle, Radiand( 70.0_deg ).value() );
+    CHECK_IF_EQUAL( screw.pitch, 0.75 );
+    CHECK_IF_EQUAL( screw.axis, Vector3Dd{ 0.0, 1.0, 1.0 }.normalized() );
+    CHECK_IF_EQUAL( dot( screw.axis, screw.moment ), 0.0 );
+    assert( approximately_equal_to( from_screw_parameters( screw ), transform ) );
+
+    // Pure translations and the identity have no rotation to find an axis from
+    ScrewParameters slide{ to_screw_parameters( DualQuaterniond::make_translation( 0.0, 0.0, -3.0 ) ) };
+
+    CHECK_IF_EQUAL( slide.angle, 0.0 );
+    CHECK_IF_EQUAL( slide.pitch, 3.0 );
+    CHECK_IF_EQUAL( slide.axis, Vector3Dd( 0.0, 0.0, -1.0 ) );
+    assert( approximately_equal_to( from_screw_parameters( to_screw_parameters( DualQuaterniond::identity() ) ), DualQuaterniond::identity() ) );
+}
+
+void SclerpFollowsTheScrew()
+{
+    std::cout << __func__ << std::endl;
+
+    const Vector3Dd axis{ Vector3Dd{ 1.0, -1.0, 0.5 }.normalized() };
+    const Vector3Dd point{ 0.5, 2.0, -1.0 };
+    DualQuaterniond begin{ MakeScrew( 10.0_deg, axis, point, 0.0 ) };
+    DualQuaterniond end{ MakeScrew( 130.0_deg, axis, point, 3.0 ) };
+
+    assert( approximately_equal_to( sclerp( begin, end, 0.0 ), begin ) );
+    assert( approximately_equal_to( sclerp( begin, end, 1.0 ), end ) );
+
+    // Constant velocity along the screw
+    for (double percent : { 0.1, 0.25, 0.5, 0.8 })
+        assert( approximately_equal_to( sclerp( begin, end, percent ), MakeScrew( Degreed( 10.0 + 120.0 * percent ), axis, point, 3.0 * percent ) ) );
+
+    // The sign of the end doesn't change the path
+    assert( approximately_equal_to( sclerp( begin, end * -1.0, 0.5 ), MakeScrew( 70.0_deg, axis, point, 1.5 ) ) );
+
+    // A pure translation moves in a straight line
+    DualQuaterniond moved{ sclerp( DualQuaterniond::identity(), DualQuaterniond::make_translation( 4.0, 0.0, 2.0 ), 0.25 ) };
+
+    CHECK_IF_EQUAL( moved.translation(), Vector3Dd( 1.0, 0.0, 0.5 ) );
+    CHECK_IF_EQUAL( moved.rotation(), Quaterniond::identity() );
+}
+
+void BatchesMatchSingleSamples()
+{
+    std::cout << __func__ << std::endl;
+
+    ScrewInterpolation<float>    path{ DualQuaternionf{ Quaternionf::identity(), Vector3Df{ 1.0f, 0.0f, 0.0f } },
+                                       DualQuaternionf{ Quaternionf::make_rotation( 90.0_deg_f, Vector3Df::unit_z() ), Vector3Df{ 0.0f, 1.0f, 1.0f } } };
+    std::vector<float>           percents{ 0.0f, 0.125f, 0.5f, 0.9f, 1.0f };
+    std::vector<DualQuaternionf> samples( percents.size() );
+
+    path( percents, samples );
+
+    for (std::size_t i = 0; i < percents.size(); ++i)
+        assert( approximately_equal_to( samples[i], path( percents[i] ) ) );
+
+    CHECK_IF_EQUAL( samples.back().translation(), Vector3Df( 0.0f, 1.0f, 1.0f ) );
+    CHECK_IF_EQUAL( samples[2].rotation(), Quaternionf::make_rotation( 45.0_deg_f, Vector3Df::unit_z() ) );
+}
+
+void MotionsBetweenNonCommutingRotationsKeepTheirTranslation()
+{
+    std::cout << __func__ << std::endl;
+
+    // Rotations about different axes don't commute, so the order of every product matters here
+    const Quaterniond begin_rotation{ Quaterniond::make_rotation( 90.0_deg, Vector3Dd::unit_z() ) };
+    const Quaterniond end_rotation{ Quaterniond::make_rotation( 90.0_deg, Vector3Dd::unit_x() ) };
+    const Vector3Dd   begin_translation{ 1.0, 0.0, 0.0 };
+    const Vector3Dd   end_translation{ 0.0, 1.0, 2.0 };
+    DualQuaterniond   begin{ DualQuaterniond::make_coordinate_system( begin_rotation, begin_translation.x, begin_translation.y, begin_translation.z ) };
+    DualQuaterniond   end{ DualQuaterniond::make_coordinate_system( end_rotation, end_translation.x, end_translation.y, end_translation.z ) };
+
+    // The motion from begin to end, in begin's frame, worked out without multiplying DualQuaternions
+    const Quaterniond relative_rotation{ begin_rotation.conjugate() * end_rotation };
+    const Vector3Dd   relative_translation{ passively_rotate_encoded_point( begin_rotation.conjugate(), Quaterniond::encode_point( end_translation - begin_translation ) ).imaginary() };
+
+    ScrewInterpolation<double> path{ begin, end };
+
+    CHECK_IF_EQUAL( path.screw().angle, relative_rotation.angle().value() );
+    CHECK_IF_EQUAL( path.screw().axis, relative_rotation.imaginary().normalized() );
+    CHECK_IF_EQUAL( path.screw().pitch, dot( path.screw().axis, relative_translation ) );
+
+    CHECK_IF_EQUAL( path( 1.0 ).translation(), end_translation );
+    CHECK_IF_EQUAL( path( 1.0 ).rotation(), end_rotation );
+    CHECK_IF_EQUAL( path( 0.5 ).rotation(), begin_rotation * relative_rotation.pow( 0.5 ) );
+
+    // Half of the motion, done twice, is all of it
+    const DualQuaterniond half{ begin.conjugate() * path( 0.5 ) };
+
+    assert( approximately_equal_to( begin * half * half, end ) );
+}
+
+void SmallRotationsAreKept()
+{
+    std::cout << __func__ << std::endl;
+
+    // Far below the square root of the machine epsilon of float
+    const Radianf         angle{ 1e-4f };
+    const Vector3Df       axis{ Vector3Df{ 0.3f, -1.0f, 0.4f }.normalized() };
+    const DualQuaternionf end{ DualQuaternionf::make_coordinate_system( Quaternionf::make_rotation( angle, axis ), 1.5f, -0.7f, 2.0f ) };
+
+    ScrewInterpolation<float> path{ DualQuaternionf::identity(), end };
+
+    CHECK_IF_EQUAL( path.screw().angle, angle.value(), 1e-9f );
+    assert( approximately_equal_to( path.screw().axis, axis, 1e-3f ) );
+    assert( approximately_equal_to( path( 1.0f ), end, 1e-6f ) );
+    assert( approximately_equal_to( path( 1.0f ).translation(), end.translation(), 1e-5f ) );
+    assert( approximately_equal_to( path( 0.5f ).rotation(), Quaternionf::make_rotation( Radianf{ 0.5e-4f }, axis ), 1e-6f ) );
+}
+
+/** Run all of the unit tests in this namespace
+ * 
+ */
+void Run()
+{
+    std::cout << "Running Screw Motion Tests..." << std::endl;
+
+    ScrewParametersRoundTrip();
+    SclerpFollowsTheScrew();
+    BatchesMatchSingleSamples();
+    MotionsBetweenNonCommutingRotationsKeepTheirTranslation();
+    SmallRotationsAreKept();
+
+    std::cout << "PASSED!" << std::endl;
+}
+}
+/// @}
\ No newline at end of file
@@ -0,0 +1,6 @@
+#pragma once
+
+namespace ScrewMotionTests
+{
+    void Run();
+}
\ No newline at end of file
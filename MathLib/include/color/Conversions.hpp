@@ -5,6 +5,7 @@
 #include "math/Vector3D.hpp"
 #include "math/Vector4D.hpp"
 #include "math/Functions.hpp"
+#include <algorithm>
 #include <concepts>
 #include <limits>
 #include <type_traits>
@@ -36,7 +37,7 @@ constexpr T min(const RGB<T> &input)
 template <class T>
 constexpr T min(const UnitRGB<T> &input)
 {
-    return std::fmin( std::fmin( input.red(), input.green() ), input.blue() );
+    return std::min( std::min( input.red(), input.green() ), input.blue() );
 }
 
 template <class T>
@@ -53,11 +54,11 @@ constexpr T max(const RGB<T> &input)
 template <class T>
 constexpr T max(const UnitRGB<T> &input)
 {
-    return std::fmax( std::fmax( input.red(), input.green() ), input.blue() );
+    return std::max( std::max( input.red(), input.green() ), input.blue() );
 }
 
 template <std::floating_point T>
-HSV<T> ToHSV(const UnitRGB<T> &input)
+constexpr HSV<T> ToHSV(const UnitRGB<T> &input)
 {
     assert( input.isNormalized() );
 
@@ -95,11 +96,8 @@ HSV<T> ToHSV(const UnitRGB<T> &input)
     else
         hue = T{4.0} + gc - rc;
 
-    // Let hue be possibly negative
-    hue = std::fmod( hue / T{6.0}, T{1.0} );
-
-    // But make hue be 0 - 360 upon return...
-    return HSV<T>{ Math::Degree<T>(hue * Math::Degree<T>::modulus()).modulo(), saturation, v };
+    // Hue is in [-1, 5] sixths of a turn here, and modulo() makes it 0 - 360
+    return HSV<T>{ Math::Degree<T>(hue / T{6.0} * Math::Degree<T>::modulus()).modulo(), saturation, v };
 #else
     // https://web.archive.org/web/20200207113336/http://lolengine.net/blog/2013/07/27/rgb-to-hsv-in-glsl
     using namespace Math;
@@ -120,7 +118,7 @@ HSV<T> ToHSV(const UnitRGB<T> &input)
 }
 
 template <std::floating_point T>
-UnitRGB<T> ToRGB(const HSV<T> &input_hsv)
+constexpr UnitRGB<T> ToRGB(const HSV<T> &input_hsv)
 {
     // https://stackoverflow.com/questions/3018313/algorithm-to-convert-rgb-to-hsv-and-hsv-to-rgb-in-range-0-255-for-both
 #if 1
@@ -203,7 +201,7 @@ UnitRGB<T> ToRGB(const HSV<T> &input_hsv)
 }
 
 template <std::floating_point T>
-HSL<T> ToHSL(const HSV<T> &input_hsv)
+constexpr HSL<T> ToHSL(const HSV<T> &input_hsv)
 {
     // https://en.wikipedia.org/wiki/HSL_and_HSV (HSV to HSL)
     // 
@@ -220,7 +218,7 @@ HSL<T> ToHSL(const HSV<T> &input_hsv)
 }
 
 template <std::floating_point T>
-HSV<T> ToHSV(const HSL<T> &input_hsl)
+constexpr HSV<T> ToHSV(const HSL<T> &input_hsl)
 {
     // https://en.wikipedia.org/wiki/HSL_and_HSV (HSV to HSL)
     // 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "math/Angle.hpp"
+#include "math/ApproximatelyEqualTo.hpp"
 #include <cassert>
 #include <limits>
 #include <cstdint>
@@ -100,9 +101,9 @@ protected:
 template <class T>
 constexpr bool approximately_equal_to(const BasicRGB<T> &value_to_test, const BasicRGB<T> &value_it_should_be, const float tolerance = 0.0002f)
 {
-    return approximately_equal_to(value_to_test.red(), value_it_should_be.red(), tolerance) &&
-           approximately_equal_to(value_to_test.green(), value_it_should_be.green(), tolerance) &&
-           approximately_equal_to(value_to_test.blue(), value_it_should_be.blue(), tolerance) ;
+    return Math::approximately_equal_to(value_to_test.red(), value_it_should_be.red(), tolerance) &&
+           Math::approximately_equal_to(value_to_test.green(), value_it_should_be.green(), tolerance) &&
+           Math::approximately_equal_to(value_to_test.blue(), value_it_should_be.blue(), tolerance) ;
 }
 /// @}
 
@@ -244,9 +245,9 @@ protected:
 template <class T>
 constexpr bool approximately_equal_to(const BasicUnitRGB<T> &value_to_test, const BasicUnitRGB<T> &value_it_should_be, const float tolerance = 0.0002f)
 {
-    return approximately_equal_to(value_to_test.red(), value_it_should_be.red(), tolerance) &&
-           approximately_equal_to(value_to_test.green(), value_it_should_be.green(), tolerance) &&
-           approximately_equal_to(value_to_test.blue(), value_it_should_be.blue(), tolerance) ;
+    return Math::approximately_equal_to(value_to_test.red(), value_it_should_be.red(), tolerance) &&
+           Math::approximately_equal_to(value_to_test.green(), value_it_should_be.green(), tolerance) &&
+           Math::approximately_equal_to(value_to_test.blue(), value_it_should_be.blue(), tolerance) ;
 }
 /// @}
 
@@ -384,21 +385,10 @@ public:
 
     constexpr enum Color hueColor() const
     {
-        const Math::Degree<value_type> mod = _hue.modulo();
+        // The colors are in order around the hue circle, 60 degrees apart
+        const int slice = static_cast<int>( Math::wrap_360( _hue ).value() / value_type{60.0} );
 
-        if ( _isInBoundsUpTo( mod.value(), 0.0, 60.0 ) )
-            return Red;
-        else if ( _isInBoundsUpTo( mod.value(), 60.0, 120.0 ) )
-            return Yellow;
-        else if ( _isInBoundsUpTo( mod.value(), 120.0, 180.0 ) )
-            return Green;
-        else if ( _isInBoundsUpTo( mod.value(), 180.0, 240.0 ) )
-            return Cyan;
-        else if ( _isInBoundsUpTo( mod.value(), 240.0, 300.0 ) )
-            return Blue;
-
-        // It must be in range 300 - 360
-        return Magenta;
+        return static_cast<enum Color>( (slice < Magenta) ? slice : Magenta );
     }
 
     constexpr void hue(const Math::Degree<value_type> input)
@@ -459,9 +449,9 @@ protected:
 template <class T>
 constexpr bool approximately_equal_to(const BasicHSV<T> &value_to_test, const BasicHSV<T> &value_it_should_be, const float tolerance = 0.0002f)
 {
-    return approximately_equal_to(value_to_test.hue().value(), value_it_should_be.hue().valuee(), tolerance) &&
-           approximately_equal_to(value_to_test.saturation(), value_it_should_be.saturation(), tolerance) &&
-           approximately_equal_to(value_to_test.value(), value_it_should_be.value(), tolerance);
+    return Math::approximately_equal_to(value_to_test.hue().value(), value_it_should_be.hue().value(), tolerance) &&
+           Math::approximately_equal_to(value_to_test.saturation(), value_it_should_be.saturation(), tolerance) &&
+           Math::approximately_equal_to(value_to_test.value(), value_it_should_be.value(), tolerance);
 }
 /// @}
 
@@ -565,21 +555,10 @@ public:
 
     constexpr enum Color hueColor() const
     {
-        const Math::Degree<value_type> mod = _hue.modulo();
-
-        if ( _isInBoundsUpTo( mod.value(), 0.0, 60.0 ) )
-            return Red;
-        else if ( _isInBoundsUpTo( mod.value(), 60.0, 120.0 ) )
-            return Yellow;
-        else if ( _isInBoundsUpTo( mod.value(), 120.0, 180.0 ) )
-            return Green;
-        else if ( _isInBoundsUpTo( mod.value(), 180.0, 240.0 ) )
-            return Cyan;
-        else if ( _isInBoundsUpTo( mod.value(), 240.0, 300.0 ) )
-            return Blue;
+        // The colors are in order around the hue circle, 60 degrees apart
+        const int slice = static_cast<int>( Math::wrap_360( _hue ).value() / value_type{60.0} );
 
-        // It must be in range 300 - 360
-        return Magenta;
+        return static_cast<enum Color>( (slice < Magenta) ? slice : Magenta );
     }
 
     constexpr void hue(const Math::Degree<value_type> input)
@@ -640,9 +619,9 @@ protected:
 template <class T>
 constexpr bool approximately_equal_to(const BasicHSL<T> &value_to_test, const BasicHSL<T> &value_it_should_be, const float tolerance = 0.0002f)
 {
-    return approximately_equal_to(value_to_test.hue().value(), value_it_should_be.hue().valuee(), tolerance) &&
-           approximately_equal_to(value_to_test.saturation(), value_it_should_be.saturation(), tolerance) &&
-           approximately_equal_to(value_to_test.lightness(), value_it_should_be.lightness(), tolerance);
+    return Math::approximately_equal_to(value_to_test.hue().value(), value_it_should_be.hue().value(), tolerance) &&
+           Math::approximately_equal_to(value_to_test.saturation(), value_it_should_be.saturation(), tolerance) &&
+           Math::approximately_equal_to(value_to_test.lightness(), value_it_should_be.lightness(), tolerance);
 }
 /// @}
 
@@ -0,0 +1,347 @@
+#pragma once
+
+#include "math/Dual.hpp"
+#include <algorithm>
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+/** @file
+ *
+ *  Contains the definitions of the AdjointTape and Adjoint classes, for reverse mode
+ *  automatic differentiation
+ *
+ *  @hideincludegraph
+ */
+
+namespace Math
+{
+
+template <class T> class Adjoint;
+
+/** Records the operations on Adjoint numbers so that their gradients can be found afterwards
+ *
+ *  Every operation on a variable adds a node to the tape holding the indices of its (at most
+ *  two) operands and its partial derivatives with respect to them.  Going back over the tape
+ *  once, from the output to the inputs, gives the partial derivatives of the output with
+ *  respect to every input (reverse mode automatic differentiation).  That costs a small
+ *  multiple of evaluating the function no matter how many inputs there are, where forward
+ *  mode costs one evaluation per input.
+ *
+ *  The nodes live in one buffer that is only ever appended to.  Clearing or rewinding the
+ *  tape keeps its memory, so a tape that is reused across the iterations of an optimizer
+ *  stops allocating after the first one.
+ *
+ *  A checkpoint marks a position on the tape.  Propagating back to a checkpoint and then
+ *  rewinding to it drops everything recorded after it, while the adjoints of what was
+ *  recorded before it keep what was propagated to them.  A cost function that is a sum of
+ *  many terms can then be differentiated one term at a time, with a tape that only ever
+ *  holds the inputs and a single term.
+ *
+ *  Node 0 is a sink that constants refer to with a partial derivative of zero, so going back
+ *  over the tape has no branches.
+ *
+ *  @note A tape isn't thread safe, so use one per thread
+ *
+ *  @headerfile "math/AdjointTape.hpp"
+ *
+ *  @ingroup AutomaticDifferentiation
+ */
+template <class T>
+class AdjointTape
+{
+public:
+    using Checkpoint = std::size_t; ///< A position on the tape
+
+    AdjointTape() : _nodes( 1 ) { }
+
+    /// Reserves room for @p node_count nodes up front
+    explicit AdjointTape(const std::size_t node_count) : AdjointTape()
+    {
+        _nodes.reserve( node_count );
+        _adjoints.reserve( node_count );
+    }
+
+    AdjointTape(const AdjointTape &) = delete; ///< The variables refer to the tape by address
+    AdjointTape &operator =(const AdjointTape &) = delete;
+
+    /// The number of nodes recorded, including the sink
+    std::size_t size() const { return _nodes.size(); }
+
+    /// The number of nodes there is room for without allocating
+    std::size_t capacity() const { return _nodes.capacity(); }
+
+    /** @name Recording
+     *  @{
+     */
+    /// Creates an input variable with the given @p value
+    Adjoint<T> variable(const T value)
+    {
+        const std::uint32_t index{ static_cast<std::uint32_t>( _nodes.size() ) };
+
+        // Refers to itself so that going back over the tape hands its adjoint back to it
+        return Adjoint<T>{ value, record( index, T{1}, 0, T{0} ), this };
+    }
+
+    /** Creates an input variable for each of @p values
+     *
+     *  @return The variables, which stay valid until the next call
+     */
+    std::span<const Adjoint<T>> variables(std::span<const T> values)
+    {
+        _variables.clear();
+        for (const T value : values)
+            _variables.push_back( variable( value ) );
+        return _variables;
+    }
+
+    /** Adds a node to the tape
+     *
+     *  @return The index of the new node
+     *
+     *  @note Used by the Adjoint operations.  Unused operands are the sink, node 0.
+     */
+    std::uint32_t record(const std::uint32_t first, const T first_partial, const std::uint32_t second, const T second_partial)
+    {
+        assert( _nodes.size() < std::numeric_limits<std::uint32_t>::max() );
+
+        _nodes.push_back( Node{ { first, second }, { first_partial, second_partial } } );
+        return static_cast<std::uint32_t>( _nodes.size() - 1 );
+    }
+
+    /// Removes all the nodes, keeping the memory for reuse
+    void clear() { rewind( 1 ); }
+
+    /// Where the tape is now
+    Checkpoint checkpoint() const { return _nodes.size(); }
+
+    /** Removes the nodes recorded after @p position, along with their adjoints
+     *
+     *  @note Variables created after @p position must not be used again
+     */
+    void rewind(const Checkpoint position)
+    {
+        assert( position >= 1 && position <= _nodes.size() );
+
+        _nodes.resize( position );
+        _adjoints.resize( std::min( _adjoints.size(), position ) );
+    }
+    /// @}
+
+    /** @name Propagation
+     *  @{
+     */
+    /** Adds the partial derivatives of @p output to the adjoints of everything it depends on
+     *
+     *  @param output The result to differentiate
+     *  @param stop   Only the nodes from here on are gone over.  Their adjoints are passed on
+     *                to their operands, even those recorded before @p stop.
+     *
+     *  @note The adjoints of the variables add up over calls until clearAdjoints() is called.
+     *        Those of the intermediate results are used up.
+     */
+    void propagate(const Adjoint<T> &output, const Checkpoint stop = 1)
+    {
+        assert( output.tape == this || output.tape == nullptr );
+        assert( stop >= 1 && stop <= _nodes.size() );
+
+        _adjoints.resize( _nodes.size(), T{0} );
+        _adjoints[output.index] += T{1};
+
+        for (std::size_t n = _nodes.size(); n-- > stop;)
+        {
+            const Node &node{ _nodes[n] };
+            const T     adjoint{ _adjoints[n] };
+
+            _adjoints[n] = T{0};
+            _adjoints[node.operands[0]] += adjoint * node.partials[0];
+            _adjoints[node.operands[1]] += adjoint * node.partials[1];
+        }
+        _adjoints[0] = T{0};
+    }
+
+    /// Sets all the adjoints back to zero
+    void clearAdjoints() { std::fill( _adjoints.begin(), _adjoints.end(), T{0} ); }
+
+    /// The partial derivative of what was propagated with respect to @p variable
+    T adjoint(const Adjoint<T> &variable) const
+    {
+        assert( variable.tape == this || variable.tape == nullptr );
+
+        return (variable.index < _adjoints.size()) ? _adjoints[variable.index] : T{0};
+    }
+    /// @}
+private:
+    struct Node
+    {
+        std::uint32_t operands[2];
+        T             partials[2];
+    };
+
+    std::vector<Node>       _nodes;
+    std::vector<T>          _adjoints;
+    std::vector<Adjoint<T>> _variables;
+};
+
+
+/** A number that records the operations on it to an AdjointTape
+ *
+ *  Variables are created by AdjointTape::variable() and anything computed from them is
+ *  recorded to the same tape.  Everything else, including default-constructed Adjoints,
+ *  is a constant, which isn't recorded.
+ *
+ *  It has the same functions as the Dual numbers and works as the scalar of Vector3D,
+ *  Quaternion and DualQuaternion.  Comparisons only look at the values, so code that
+ *  branches on them takes the same path as it would with plain numbers.
+ *
+ *  @headerfile "math/AdjointTape.hpp"
+ *
+ *  @ingroup AutomaticDifferentiation
+ */
+template <class T>
+class Adjoint : public DualFunctions<Adjoint<T>, T>
+{
+public:
+    using value_type = T;
+
+    Adjoint() = default;
+    explicit constexpr Adjoint(const T value) : real(value) { } ///< Constructs a constant
+    constexpr Adjoint(const T value, const std::uint32_t node, AdjointTape<T> *const recorded_on) : real(value), index(node), tape(recorded_on) { }
+
+    /** @name Element Access
+     *  @{
+     */
+    T               real{};            ///< The value
+    std::uint32_t   index = 0;         ///< The node of the tape that computed it, or 0 for a constant
+    AdjointTape<T> *tape  = nullptr;   ///< The tape it was recorded to, or @c nullptr for a constant
+    /// @}
+
+    /** @name Chain Rule
+     *
+     *  Used by the DualFunctions to record functions of Adjoints
+     *
+     *  @{
+     */
+    /// The result of a function with the given @p value and @p derivative at @c real
+    Adjoint<T> chain(const T &value, const T &derivative) const
+    {
+        if ( !tape )
+            return Adjoint<T>{ value };
+        return Adjoint<T>{ value, tape->record( index, derivative, 0, T{0} ), tape };
+    }
+
+    /// The result of a function of @p x and @p y with the given @p value and partial derivatives at their real parts
+    static Adjoint<T> chain(const Adjoint<T> &x, const Adjoint<T> &y, const T &value, const T &dx, const T &dy)
+    {
+        assert( !x.tape || !y.tape || x.tape == y.tape );
+
+        AdjointTape<T> *const tape{ x.tape ? x.tape : y.tape };
+
+        if ( !tape )
+            return Adjoint<T>{ value };
+        return Adjoint<T>{ value, tape->record( x.index, dx, y.index, dy ), tape };
+    }
+    /// @}
+
+    /** @name Operators
+     *  @{
+     */
+    Adjoint<T> &operator +=(const Adjoint<T> &other) { return *this = *this + other; }
+    Adjoint<T> &operator -=(const Adjoint<T> &other) { return *this = *this - other; }
+    Adjoint<T> &operator *=(const Adjoint<T> &other) { return *this = *this * other; }
+    Adjoint<T> &operator /=(const Adjoint<T> &other) { return *this = *this / other; }
+
+    Adjoint<T> &operator +=(const T scalar) { return *this = *this + scalar; }
+    Adjoint<T> &operator -=(const T scalar) { return *this = *this - scalar; }
+    Adjoint<T> &operator *=(const T scalar) { return *this = *this * scalar; }
+    Adjoint<T> &operator /=(const T scalar) { return *this = *this / scalar; }
+    /// @}
+private:
+
+    /** @name Global Operators
+     *
+     *  @relates Adjoint
+     *
+     *  @{
+     */
+    friend Adjoint<T> operator -(const Adjoint<T> &input) { return input.chain( -input.real, T{-1} ); }
+
+    friend Adjoint<T> operator +(const Adjoint<T> &left, const Adjoint<T> &right) { return chain( left, right, left.real + right.real, T{1}, T{1} ); }
+    friend Adjoint<T> operator -(const Adjoint<T> &left, const Adjoint<T> &right) { return chain( left, right, left.real - right.real, T{1}, T{-1} ); }
+    friend Adjoint<T> operator *(const Adjoint<T> &left, const Adjoint<T> &right) { return chain( left, right, left.real * right.real, right.real, left.real ); }
+    friend Adjoint<T> operator /(const Adjoint<T> &left, const Adjoint<T> &right)
+    {
+        const T inverse{ T{1} / right.real };
+        const T quotient{ left.real * inverse };
+
+        return chain( left, right, quotient, inverse, -quotient * inverse );
+    }
+
+    friend Adjoint<T> operator +(const Adjoint<T> &left, const T right) { return left.chain( left.real + right, T{1} ); }
+    friend Adjoint<T> operator -(const Adjoint<T> &left, const T right) { return left.chain( left.real - right, T{1} ); }
+    friend Adjoint<T> operator *(const Adjoint<T> &left, const T right) { return left.chain( left.real * right, right ); }
+    friend Adjoint<T> operator /(const Adjoint<T> &left, const T right) { return left * (T{1} / right); }
+
+    friend Adjoint<T> operator +(const T left, const Adjoint<T> &right) { return right.chain( left + right.real, T{1} ); }
+    friend Adjoint<T> operator -(const T left, const Adjoint<T> &right) { return right.chain( left - right.real, T{-1} ); }
+    friend Adjoint<T> operator *(const T left, const Adjoint<T> &right) { return right.chain( left * right.real, left ); }
+    friend Adjoint<T> operator /(const T left, const Adjoint<T> &right)
+    {
+        const T quotient{ left / right.real };
+
+        return right.chain( quotient, -quotient / right.real );
+    }
+
+    friend constexpr bool operator ==(const Adjoint<T> &left, const Adjoint<T> &right) { return left.real == right.real; }
+    friend constexpr bool operator ==(const Adjoint<T> &left, const T right) { return left.real == right; }
+
+    friend constexpr auto operator <=>(const Adjoint<T> &left, const Adjoint<T> &right) { return left.real <=> right.real; }
+    friend constexpr auto operator <=>(const Adjoint<T> &left, const T right) { return left.real <=> right; }
+    /// @}
+
+    /** @addtogroup Equality
+     *
+     *  @relates Adjoint
+     *
+     *  @{
+     */
+    /// Compares the values to within @p tolerance.  The derivatives are only known after propagating.
+    friend constexpr bool approximately_equal_to(const Adjoint<T> &value_to_test,
+                                                 const Adjoint<T> &value_it_should_be,
+                                                 const real_type_t<T> tolerance = real_type_t<T>{0.0002})
+    {
+        return approximately_equal_to( value_to_test.real, value_it_should_be.real, tolerance );
+    }
+    /// @}  {Equality}
+};
+
+/** Lets an Adjoint be used as a scalar
+ *
+ *  @relates Adjoint
+ */
+template <class T>
+struct scalar_traits<Adjoint<T>>
+{
+    using real_type = real_type_t<T>;
+
+    constexpr static bool is_scalar = is_scalar_v<T>;
+
+    constexpr static real_type value(const Adjoint<T> &input) { return value_of( input.real ); }
+};
+
+
+/** @name Type Aliases
+ *
+ *  @relates Adjoint
+ *
+ *  @{
+ */
+using Adjointf = Adjoint<float>;
+using Adjointd = Adjoint<double>;
+/// @}
+
+}
\ No newline at end of file
@@ -1,6 +1,16 @@
 #pragma once
 
 #include "math/Functions.hpp"
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <span>
+#include <type_traits>
 
 /** @file
  *  
@@ -29,28 +39,28 @@ public:
     /** @name Element Access
      *  @{
      */
-    T value() const { return _value; }
+    constexpr T value() const { return _value; }
     /// @}
 
-    Radian<T>& operator +=(const Radian other)
+    constexpr Radian<T>& operator +=(const Radian other)
     {
         _value += other._value;
         return *this;
     }
 
-    Radian<T>& operator -=(const Radian other)
+    constexpr Radian<T>& operator -=(const Radian other)
     {
         _value -= other._value;
         return *this;
     }
 
-    Radian<T>& operator *=(const Radian other)
+    constexpr Radian<T>& operator *=(const Radian other)
     {
         _value *= other._value;
         return *this;
     }
 
-    Radian<T>& operator /=(const Radian other)
+    constexpr Radian<T>& operator /=(const Radian other)
     {
         _value /= other._value;
         return *this;
@@ -63,11 +73,11 @@ public:
      * 
      *  @{
      */
-    constexpr std::strong_ordering operator <=>(const Radian<T> other) const
+    constexpr auto operator <=>(const Radian<T> other) const
     {
         return _value <=> other._value;
     }
-    constexpr std::strong_ordering operator <=>(const T other) const
+    constexpr auto operator <=>(const T other) const
     {
         return _value <=> other;
     }
@@ -124,27 +134,27 @@ private:
      * 
      *  @{
      */
-    friend Radian<T> operator +(const Radian<T> left, const Radian<T> right)
+    friend constexpr Radian<T> operator +(const Radian<T> left, const Radian<T> right)
     {
         return Radian<T>{ left.value() + right.value() };
     }
 
-    friend Radian<T> operator -(const Radian<T> left, const Radian<T> right)
+    friend constexpr Radian<T> operator -(const Radian<T> left, const Radian<T> right)
     {
         return Radian<T>{ left.value() - right.value() };
     }
 
-    friend Radian<T> operator *(const Radian<T> left, const Radian<T> right)
+    friend constexpr Radian<T> operator *(const Radian<T> left, const Radian<T> right)
     {
         return Radian<T>{ left.value() * right.value() };
     }
 
-    friend Radian<T> operator /(const Radian<T> left, const Radian<T> right)
+    friend constexpr Radian<T> operator /(const Radian<T> left, const Radian<T> right)
     {
         return Radian<T>{ left.value() / right.value() };
     }
 
-    friend Radian<T> operator -(const Radian<T> input)
+    friend constexpr Radian<T> operator -(const Radian<T> input)
     {
         return Radian{ -input.value() };
     }
@@ -169,62 +179,62 @@ public:
     explicit constexpr Degree(const T value) : _value(value) { }
     constexpr Degree(const Radian<T> value) : _value( RadiansToDegrees(value.value()) ) { }
 
-    operator Radian<T>() { return Radian<T>{DegreesToRadians(_value)}; }
+    constexpr operator Radian<T>() const { return Radian<T>{DegreesToRadians(_value)}; }
 
     static constexpr Degree<T> zero() { return Degree<T>(); }
 
     /** @name Element Access
      *  @{
      */
-    T value() const { return _value; }
+    constexpr T value() const { return _value; }
     /// @}
 
     /** @name Operators
      *  @{
      */
-    Degree<T> operator +=(const Degree<T> other)
+    constexpr Degree<T> &operator +=(const Degree<T> other)
     {
         _value += other.value();
         return *this;
     }
 
-    Degree<T> operator +=(const T other)
+    constexpr Degree<T> &operator +=(const T other)
     {
         _value += other;
         return *this;
     }
 
-    Degree<T> &operator -=(const Degree<T> other)
+    constexpr Degree<T> &operator -=(const Degree<T> other)
     {
         _value -= other.value();
         return *this;
     }
 
-    Degree<T> &operator -=(const T other)
+    constexpr Degree<T> &operator -=(const T other)
     {
         _value -= other;
         return *this;
     }
 
-    Degree<T> &operator *=(const Degree<T> other)
+    constexpr Degree<T> &operator *=(const Degree<T> other)
     {
         _value *= other.value();
         return *this;
     }
 
-    Degree<T> &operator *=(const T other)
+    constexpr Degree<T> &operator *=(const T other)
     {
         _value *= other;
         return *this;
     }
 
-    Degree<T> &operator /=(const Degree<T> other)
+    constexpr Degree<T> &operator /=(const Degree<T> other)
     {
         _value /= other.value();
         return *this;
     }
 
-    Degree<T> &operator /=(const T other)
+    constexpr Degree<T> &operator /=(const T other)
     {
         _value /= other;
         return *this;
@@ -238,11 +248,11 @@ public:
      * 
      *  @{
      */
-    constexpr std::strong_ordering operator <=>(const Degree<T> other) const
+    constexpr auto operator <=>(const Degree<T> other) const
     {
         return _value <=> other._value;
     }
-    constexpr std::strong_ordering operator <=>(const T other) const
+    constexpr auto operator <=>(const T other) const
     {
         return _value <=> other;
     }
@@ -271,10 +281,8 @@ public:
 
     constexpr Degree<T> modulo() const
     {
-        T modded;
-
         // Make in range of 0 - 360
-        return Degree{ (0.0 <= (modded = std::fmod( _value, modulus() )) ? modded : modulus() + modded) };
+        return wrap_360( *this );
     }
 private:
     T _value{};
@@ -307,47 +315,47 @@ private:
      * 
      *  @{
      */
-    friend Degree<T> operator +(const Degree<T> left, const Degree<T> right)
+    friend constexpr Degree<T> operator +(const Degree<T> left, const Degree<T> right)
     {
         return Degree<T>{ left.value() + right.value() };
     }
 
-    friend Degree<T> operator -(const Degree<T> left, const Degree<T> right)
+    friend constexpr Degree<T> operator -(const Degree<T> left, const Degree<T> right)
     {
         return Degree<T>{ left.value() - right.value() };
     }
 
-    friend Degree<T> operator *(const Degree<T> left, const Degree<T> right)
+    friend constexpr Degree<T> operator *(const Degree<T> left, const Degree<T> right)
     {
         return Degree<T>{ left.value() * right.value() };
     }
 
-    friend Degree<T> operator /(const Degree<T> left, const Degree<T> right)
+    friend constexpr Degree<T> operator /(const Degree<T> left, const Degree<T> right)
     {
         return Degree<T>{ left.value() / right.value() };
     }
 
-    friend Degree<T> operator +(const Degree<T> left, const T right)
+    friend constexpr Degree<T> operator +(const Degree<T> left, const T right)
     {
         return Degree<T>{ left.value() + right };
     }
 
-    friend Degree<T> operator -(const Degree<T> left, const T right)
+    friend constexpr Degree<T> operator -(const Degree<T> left, const T right)
     {
         return Degree<T>{ left.value() - right };
     }
 
-    friend Degree<T> operator *(const Degree<T> left, const T right)
+    friend constexpr Degree<T> operator *(const Degree<T> left, const T right)
     {
         return Degree<T>{ left.value() * right };
     }
 
-    friend Degree<T> operator /(const Degree<T> left, const T right)
+    friend constexpr Degree<T> operator /(const Degree<T> left, const T right)
     {
         return Degree<T>{ left.value() / right };
     }
 
-    friend Degree<T> operator -(const Degree<T> input)
+    friend constexpr Degree<T> operator -(const Degree<T> input)
     {
         return Degree{ -input.value() };
     }
@@ -355,6 +363,461 @@ private:
 };
 
 
+/** The sine and cosine of the same angle
+ *
+ *  @headerfile "math/Angle.hpp"
+ */
+template <class T>
+struct SineCosine
+{
+    T sin{};
+    T cos{};
+};
+
+/** @addtogroup Trigonometry
+ *
+ *  @{
+ */
+
+/** Computes the sine and cosine of @p angle together
+ *
+ *  The two share one range reduction: with StandardMath compilers combine the two calls
+ *  into the C library's @c sincos, and the approximations in Math::fast reduce the angle
+ *  once for both.
+ *
+ *  @tparam Policy Supplies the trigonometry (see @ref MathPolicies)
+ */
+template <class Policy = StandardMath, class T>
+constexpr SineCosine<T> sincos(const Radian<T> angle)
+{
+    SineCosine<T> output;
+
+    Policy::sincos( angle.value(), output.sin, output.cos );
+    return output;
+}
+
+/// @copydoc sincos(const Radian<T>)
+template <class Policy = StandardMath, class T>
+constexpr SineCosine<T> sincos(const Degree<T> angle)
+{
+    return sincos<Policy>( Radian<T>{ DegreesToRadians( angle.value() ) } );
+}
+
+/** Computes the sines and cosines of many angles
+ *
+ *  @pre @p sines and @p cosines have room for as many values as @p angles
+ */
+template <class Policy = StandardMath, class T>
+void sincos(std::span<const Radian<T>> angles, std::span<T> sines, std::span<T> cosines)
+{
+    assert( sines.size() >= angles.size() && cosines.size() >= angles.size() );
+
+    const std::size_t count = angles.size();
+
+    for (std::size_t i = 0; i < count; ++i)
+        Policy::sincos( angles[i].value(), sines[i], cosines[i] );
+}
+/// @}  {Trigonometry}
+
+
+/** @addtogroup AngleWrapping Angle Wrapping
+ *
+ *  Brings angles back into a single turn without calling @c fmod
+ *
+ *  The number of whole turns is rounded from the angle times the reciprocal of a turn and
+ *  then taken off with remove_turns().  For radians that uses Cody-Waite reduction:
+ *  @f$ 2\pi @f$ is split into parts with so few bits that multiplying them by the number of
+ *  turns is exact, and the rest, so that the result stays accurate to the precision of @p T
+ *  even for angles of many turns.  360 degrees is already exact.
+ *
+ *  | Function        | Range                |
+ *  | --------------- | -------------------- |
+ *  | wrap_two_pi     | @f$ [0, 2\pi) @f$    |
+ *  | wrap_pi         | @f$ [-\pi, \pi) @f$  |
+ *  | wrap_360        | [0, 360)             |
+ *  | wrap_180        | [-180, 180)          |
+ *
+ *  There are no branches, so the batched functions can be vectorized.
+ *
+ *  @{
+ */
+
+/// Wraps @p angle into @f$ [0, 2\pi) @f$
+template <class T>
+constexpr Radian<T> wrap_two_pi(const Radian<T> angle)
+{
+    using std::floor;
+
+    constexpr T two_pi{ T{2} * std::numbers::pi_v<T> };
+    constexpr T turns_per_radian{ T{0.5} * std::numbers::inv_pi_v<T> };
+
+    const T turns{ angle.value() * turns_per_radian };
+    T       wrapped{ remove_turns( angle.value(), std::is_constant_evaluated() ? compile_time::floor( turns ) : floor( turns ) ) };
+
+    // Rounding can leave it just outside of the range
+    wrapped += (wrapped < T{0}) ? two_pi : T{0};
+    wrapped -= (wrapped >= two_pi) ? two_pi : T{0};
+    return Radian<T>{ wrapped };
+}
+
+/// Wraps @p angle into @f$ [-\pi, \pi) @f$
+template <class T>
+constexpr Radian<T> wrap_pi(const Radian<T> angle)
+{
+    using std::nearbyint;
+
+    constexpr T pi{ std::numbers::pi_v<T> };
+    constexpr T turns_per_radian{ T{0.5} * std::numbers::inv_pi_v<T> };
+
+    const T turns{ angle.value() * turns_per_radian };
+    T       wrapped{ remove_turns( angle.value(), std::is_constant_evaluated() ? compile_time::nearbyint( turns ) : nearbyint( turns ) ) };
+
+    wrapped += (wrapped < -pi) ? T{2} * pi : T{0};
+    wrapped -= (wrapped >= pi) ? T{2} * pi : T{0};
+    return Radian<T>{ wrapped };
+}
+
+/// Wraps @p angle into [0, 360)
+template <class T>
+constexpr Degree<T> wrap_360(const Degree<T> angle)
+{
+    using std::floor;
+
+    const T turns{ angle.value() / T{360} };
+    T       wrapped{ angle.value() - (std::is_constant_evaluated() ? compile_time::floor( turns ) : floor( turns )) * T{360} };
+
+    wrapped += (wrapped < T{0}) ? T{360} : T{0};
+    wrapped -= (wrapped >= T{360}) ? T{360} : T{0};
+    return Degree<T>{ wrapped };
+}
+
+/// Wraps @p angle into [-180, 180)
+template <class T>
+constexpr Degree<T> wrap_180(const Degree<T> angle)
+{
+    using std::nearbyint;
+
+    const T turns{ angle.value() / T{360} };
+    T       wrapped{ angle.value() - (std::is_constant_evaluated() ? compile_time::nearbyint( turns ) : nearbyint( turns )) * T{360} };
+
+    wrapped += (wrapped < T{-180}) ? T{360} : T{0};
+    wrapped -= (wrapped >= T{180}) ? T{360} : T{0};
+    return Degree<T>{ wrapped };
+}
+
+/** The smallest angle to turn by to get from @p from to @p to
+ *
+ *  @return An angle in @f$ [-\pi, \pi) @f$, positive when turning the positive way
+ */
+template <class T>
+constexpr Radian<T> shortest_angle_difference(const Radian<T> from, const Radian<T> to)
+{
+    return wrap_pi( to - from );
+}
+
+/** The smallest angle to turn by to get from @p from to @p to
+ *
+ *  @return An angle in [-180, 180), positive when turning the positive way
+ */
+template <class T>
+constexpr Degree<T> shortest_angle_difference(const Degree<T> from, const Degree<T> to)
+{
+    return wrap_180( to - from );
+}
+
+/** @name Batched Wrapping
+ *
+ *  The same as wrapping each element in turn
+ *
+ *  @pre @p output has room for as many angles as @p input
+ *
+ *  @{
+ */
+template <class T>
+void wrap_two_pi(std::span<const Radian<T>> input, std::span<Radian<T>> output)
+{
+    assert( output.size() >= input.size() );
+
+    const std::size_t count = input.size();
+
+    for (std::size_t i = 0; i < count; ++i)
+        output[i] = wrap_two_pi( input[i] );
+}
+
+template <class T>
+void wrap_pi(std::span<const Radian<T>> input, std::span<Radian<T>> output)
+{
+    assert( output.size() >= input.size() );
+
+    const std::size_t count = input.size();
+
+    for (std::size_t i = 0; i < count; ++i)
+        output[i] = wrap_pi( input[i] );
+}
+
+template <class T>
+void wrap_360(std::span<const Degree<T>> input, std::span<Degree<T>> output)
+{
+    assert( output.size() >= input.size() );
+
+    const std::size_t count = input.size();
+
+    for (std::size_t i = 0; i < count; ++i)
+        output[i] = wrap_360( input[i] );
+}
+
+template <class T>
+void wrap_180(std::span<const Degree<T>> input, std::span<Degree<T>> output)
+{
+    assert( output.size() >= input.size() );
+
+    const std::size_t count = input.size();
+
+    for (std::size_t i = 0; i < count; ++i)
+        output[i] = wrap_180( input[i] );
+}
+
+/// @pre @p to is the same size as @p from
+template <class T>
+void shortest_angle_difference(std::span<const Radian<T>> from, std::span<const Radian<T>> to, std::span<Radian<T>> output)
+{
+    assert( to.size() == from.size() && output.size() >= from.size() );
+
+    const std::size_t count = from.size();
+
+    for (std::size_t i = 0; i < count; ++i)
+        output[i] = shortest_angle_difference( from[i], to[i] );
+}
+
+/// @pre @p to is the same size as @p from
+template <class T>
+void shortest_angle_difference(std::span<const Degree<T>> from, std::span<const Degree<T>> to, std::span<Degree<T>> output)
+{
+    assert( to.size() == from.size() && output.size() >= from.size() );
+
+    const std::size_t count = from.size();
+
+    for (std::size_t i = 0; i < count; ++i)
+        output[i] = shortest_angle_difference( from[i], to[i] );
+}
+/// @}
+/// @}  {AngleWrapping}
+
+
+/** Class that stores an angle as a fixed-point fraction of a turn
+ *
+ *  A binary angle (BAM) spreads one turn over every value of the unsigned @p Integer, so
+ *  a 16 bit angle has steps of 360 / 65536 degrees and a 32 bit one steps of about 84
+ *  nano-degrees.  Adding and subtracting them wraps around through integer overflow for
+ *  free, and they take half (or a quarter) of the memory of a Degree<float> or
+ *  Radian<double>.
+ *
+ *  Converting to Radian<double> or Degree<double> and back gives the same angle again.
+ *  The sine and cosine are read from a table of 1024 values with linear interpolation in
+ *  between, which is accurate to about @f$ 5 \times 10^{-6} @f$.
+ *
+ *  @headerfile "math/Angle.hpp"
+ */
+template <class Integer>
+class BinaryAngle
+{
+public:
+    static_assert( std::is_unsigned_v<Integer> && std::numeric_limits<Integer>::digits <= 32 );
+
+    using value_type = Integer;
+
+    constexpr static unsigned bits = std::numeric_limits<Integer>::digits; ///< The number of bits in a turn
+
+    constexpr BinaryAngle() = default;
+    explicit constexpr BinaryAngle(const Integer value) : _value(value) { }
+
+    /// Converts to the nearest step, wrapping @p angle into a single turn
+    template <class T>
+    explicit constexpr BinaryAngle(const Radian<T> angle) : _value( fromTurns( wrap_two_pi( angle ).value() * (T{0.5} * std::numbers::inv_pi_v<T>) ) ) { }
+
+    /// @copydoc BinaryAngle(const Radian<T>)
+    template <class T>
+    explicit constexpr BinaryAngle(const Degree<T> angle) : _value( fromTurns( wrap_360( angle ).value() / T{360} ) ) { }
+
+    template <class T>
+    explicit constexpr operator Radian<T>() const { return Radian<T>{ T(_value) * (T{2} * std::numbers::pi_v<T> / stepsPerTurn<T>()) }; }
+
+    template <class T>
+    explicit constexpr operator Degree<T>() const { return Degree<T>{ T(_value) * (T{360} / stepsPerTurn<T>()) }; }
+
+    constexpr static BinaryAngle<Integer> zero() { return BinaryAngle<Integer>{}; }
+    constexpr static BinaryAngle<Integer> quarter_turn() { return BinaryAngle<Integer>{ Integer( Integer{1} << (bits - 2) ) }; }
+    constexpr static BinaryAngle<Integer> half_turn() { return BinaryAngle<Integer>{ Integer( Integer{1} << (bits - 1) ) }; }
+
+    /** @name Element Access
+     *  @{
+     */
+    constexpr Integer value() const { return _value; }
+
+    /// The angle in @f$ [-\frac{1}{2}, \frac{1}{2}) @f$ of a turn, in steps
+    constexpr std::make_signed_t<Integer> signedValue() const { return static_cast<std::make_signed_t<Integer>>( _value ); }
+    /// @}
+
+    /** @name Trigonometry
+     *  @{
+     */
+    template <class T = float>
+    constexpr T sin() const
+    {
+        constexpr Integer fraction_mask = Integer( (Integer{1} << fraction_bits) - 1 );
+        constexpr T       fraction_scale = T{1} / T( std::uint64_t{1} << fraction_bits );
+
+        const unsigned index = static_cast<unsigned>( _value >> fraction_bits );
+        const T        fraction = T( _value & fraction_mask ) * fraction_scale;
+        const T        before = T( _sine_table[index] );
+
+        return before + (T( _sine_table[index + 1] ) - before) * fraction;
+    }
+
+    template <class T = float>
+    constexpr T cos() const { return (*this + quarter_turn()).template sin<T>(); }
+
+    template <class T = float>
+    constexpr SineCosine<T> sincos() const { return SineCosine<T>{ sin<T>(), cos<T>() }; }
+    /// @}
+
+    /** @name Operators
+     *  @{
+     */
+    constexpr BinaryAngle<Integer> &operator +=(const BinaryAngle<Integer> other)
+    {
+        _value = Integer( _value + other._value );
+        return *this;
+    }
+
+    constexpr BinaryAngle<Integer> &operator -=(const BinaryAngle<Integer> other)
+    {
+        _value = Integer( _value - other._value );
+        return *this;
+    }
+
+    constexpr bool operator ==(const BinaryAngle<Integer> &) const = default;
+    constexpr auto operator <=>(const BinaryAngle<Integer> &) const = default;
+    /// @}
+private:
+    constexpr static unsigned table_bits = (bits < 10) ? bits : 10;
+    constexpr static unsigned fraction_bits = bits - table_bits;
+
+    Integer _value{};
+
+    template <class T>
+    constexpr static T stepsPerTurn() { return T( std::uint64_t{1} << bits ); }
+
+    template <class T>
+    constexpr static Integer fromTurns(const T turns)
+    {
+        using std::nearbyint;
+
+        const T steps{ turns * stepsPerTurn<T>() };
+
+        // A full turn, from rounding up, wraps to zero
+        return static_cast<Integer>( static_cast<std::uint64_t>( std::is_constant_evaluated() ? compile_time::nearbyint( steps ) : nearbyint( steps ) ) );
+    }
+
+    using SineTable = std::array<float, (std::size_t{1} << table_bits) + 1>;
+
+    static const SineTable _sine_table; ///< The sine at each of 2^table_bits points around the circle, and the first one again
+
+    constexpr static SineTable makeSineTable()
+    {
+        constexpr std::size_t quarter = std::size_t{1} << (table_bits - 2);
+        constexpr double      step = 0.5 * std::numbers::pi / double(quarter);
+
+        // Taylor series, which converge to double precision up to an eighth of a turn
+        auto sine = [](const double x)
+            {
+                double term = x, sum = x;
+
+                for (int k = 1; k < 12; ++k)
+                    sum += (term *= -x * x / double( (2 * k) * (2 * k + 1) ));
+                return sum;
+            };
+        auto cosine = [](const double x)
+            {
+                double term = 1.0, sum = 1.0;
+
+                for (int k = 1; k < 12; ++k)
+                    sum += (term *= -x * x / double( (2 * k - 1) * (2 * k) ));
+                return sum;
+            };
+
+        SineTable table{};
+
+        for (std::size_t n = 0; n < table.size(); ++n)
+        {
+            // Every quadrant is the first one mirrored or negated
+            const std::size_t quadrant = (n / quarter) % 4;
+            const std::size_t offset = (quadrant % 2 == 0) ? n % quarter : quarter - n % quarter;
+            const double      value = (offset <= quarter / 2) ? sine( double(offset) * step ) : cosine( double(quarter - offset) * step );
+
+            table[n] = float( (quadrant < 2) ? value : -value );
+        }
+        return table;
+    }
+
+    /** @name Global Operators
+     *
+     *  @relates BinaryAngle
+     *
+     *  @{
+     */
+    friend constexpr BinaryAngle<Integer> operator +(BinaryAngle<Integer> left, const BinaryAngle<Integer> right) { return left += right; }
+    friend constexpr BinaryAngle<Integer> operator -(BinaryAngle<Integer> left, const BinaryAngle<Integer> right) { return left -= right; }
+    friend constexpr BinaryAngle<Integer> operator -(const BinaryAngle<Integer> input) { return BinaryAngle<Integer>{} - input; }
+    /// @}
+};
+
+template <class Integer>
+constexpr typename BinaryAngle<Integer>::SineTable BinaryAngle<Integer>::_sine_table = BinaryAngle<Integer>::makeSineTable();
+
+/** The smallest angle to turn by to get from @p from to @p to
+ *
+ *  @return The number of steps, positive when turning the positive way
+ *
+ *  @relates BinaryAngle
+ */
+template <class Integer>
+constexpr std::make_signed_t<Integer> shortest_angle_difference(const BinaryAngle<Integer> from, const BinaryAngle<Integer> to)
+{
+    return (to - from).signedValue();
+}
+
+/** Computes the sine and cosine of @p angle together, from a table
+ *
+ *  @relates BinaryAngle
+ */
+template <class T = float, class Integer>
+constexpr SineCosine<T> sincos(const BinaryAngle<Integer> angle)
+{
+    return angle.template sincos<T>();
+}
+
+/** Computes the sines and cosines of many binary angles
+ *
+ *  @pre @p sines and @p cosines have room for as many values as @p angles
+ *
+ *  @relates BinaryAngle
+ */
+template <class T, class Integer>
+void sincos(std::span<const BinaryAngle<Integer>> angles, std::span<T> sines, std::span<T> cosines)
+{
+    assert( sines.size() >= angles.size() && cosines.size() >= angles.size() );
+
+    const std::size_t count = angles.size();
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        sines[i] = angles[i].template sin<T>();
+        cosines[i] = angles[i].template cos<T>();
+    }
+}
+
+
 namespace Literals
 {
 /** @name User-Defined Literals
@@ -402,4 +865,14 @@ using Radiand  = Radian<double>;
 using Radianld = Radian<long double>;
 /// @}  {Radian Type Aliases}
 
+/** @name BinaryAngle Type Aliases
+ *
+ *  @relates BinaryAngle
+ *
+ *  @{
+ */
+using BinaryAngle16 = BinaryAngle<std::uint16_t>;
+using BinaryAngle32 = BinaryAngle<std::uint32_t>;
+/// @}  {BinaryAngle Type Aliases}
+
 }
\ No newline at end of file
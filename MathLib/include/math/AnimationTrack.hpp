@@ -0,0 +1,292 @@
+#pragma once
+
+#include "math/Quaternion.hpp"
+#include "math/DualQuaternion.hpp"
+#include "math/Vector3D.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+
+/** @file
+ *
+ *  Contains the definition of the AnimationTrack class
+ *
+ *  @hideincludegraph
+ */
+
+namespace Math
+{
+
+/** A sequence of keyframes of a single animated value
+ *
+ *  The value can be a Quaternion, a Vector3D or a DualQuaternion.  Between keyframes
+ *  Quaternions are interpolated with slerp(), Vector3Ds linearly and DualQuaternions
+ *  with blend(), always taking the shortest path for rotations.  Sampling before the
+ *  first keyframe or after the last one gives the value of that keyframe.
+ *
+ *  Sampling with a Cursor remembers the segment that was last used, so playing a
+ *  track forwards (or backwards) one small step at a time only has to look at the
+ *  neighbouring keyframes instead of doing a binary search each time.  A track has
+ *  no state of its own while sampling, so many instances of an animation can share
+ *  one track as long as each keeps its own Cursor.
+ *
+ *  @tparam Value The type of the animated value
+ *
+ *  @headerfile "math/AnimationTrack.hpp"
+ */
+template <class Value>
+class AnimationTrack
+{
+public:
+    using value_type = Value;
+    using time_type  = typename Value::value_type;
+
+    struct Keyframe
+    {
+        time_type time{};
+        Value     value{};
+    };
+
+    /** Remembers where the last sample of a track was taken
+     *
+     *  @note A Cursor can be used with any track, but it only speeds up sampling
+     *        when it is always used with the same one.
+     */
+    struct Cursor
+    {
+        std::size_t segment = 0; ///< The index of the keyframe starting the segment last sampled
+    };
+
+    AnimationTrack() = default;
+
+    /** Creates a track from keyframes in any order
+     *
+     *  @note Keyframes with the same time keep their relative order
+     */
+    explicit AnimationTrack(std::vector<Keyframe> keyframes)
+        :
+        _keyframes{ std::move( keyframes ) }
+    {
+        std::ranges::stable_sort( _keyframes, {}, &Keyframe::time );
+    }
+
+    /** @name Keyframes
+     *  @{
+     */
+    /** Adds a keyframe, replacing any keyframe already at @p time */
+    void insert(const time_type time, const Value &value)
+    {
+        auto position = std::ranges::lower_bound( _keyframes, time, {}, &Keyframe::time );
+
+        if ( position != _keyframes.end() && position->time == time )
+            position->value = value;
+        else
+            _keyframes.insert( position, Keyframe{ time, value } );
+    }
+
+    std::span<const Keyframe> keyframes() const { return _keyframes; }
+
+    std::size_t size() const { return _keyframes.size(); }
+
+    bool empty() const { return _keyframes.empty(); }
+
+    /// @pre The track is not empty
+    time_type startTime() const { assert( !empty() ); return _keyframes.front().time; }
+
+    /// @pre The track is not empty
+    time_type endTime() const { assert( !empty() ); return _keyframes.back().time; }
+
+    time_type duration() const { return empty() ? time_type{} : endTime() - startTime(); }
+    /// @}
+
+    /** @name Sampling
+     *  @{
+     */
+    /** Samples the track at @p time with a binary search
+     *
+     *  @pre The track is not empty
+     */
+    Value sample(const time_type time) const
+    {
+        Cursor cursor{ findSegment( time ) };
+
+        return sample( time, cursor );
+    }
+
+    /** Samples the track at @p time, starting the search from @p cursor
+     *
+     *  @param time   When to sample the track
+     *  @param cursor Where the last sample was taken.  It is updated to the segment containing @p time.
+     *
+     *  @pre The track is not empty
+     *
+     *  @note This is constant time when @p time is in the same segment as the last
+     *        sample or a neighbouring one.  Otherwise it falls back to a binary search.
+     */
+    Value sample(const time_type time, Cursor &cursor) const
+    {
+        assert( !empty() );
+
+        if ( time <= _keyframes.front().time )
+        {
+            cursor.segment = 0;
+            return _keyframes.front().value;
+        }
+        if ( time >= _keyframes.back().time )
+        {
+            cursor.segment = _keyframes.size() - 1;
+            return _keyframes.back().value;
+        }
+
+        // Here there are at least 2 keyframes and front().time < time < back().time
+        const std::size_t last_segment{ _keyframes.size() - 2 };
+        std::size_t       segment{ std::min( cursor.segment, last_segment ) };
+
+        if ( time < _keyframes[segment].time )
+        {
+            if ( segment > 0 && time >= _keyframes[segment - 1].time )
+                --segment;
+            else
+                segment = findSegment( time );
+        }
+        else if ( time >= _keyframes[segment + 1].time )
+        {
+            if ( segment < last_segment && time < _keyframes[segment + 2].time )
+                ++segment;
+            else
+                segment = findSegment( time );
+        }
+        cursor.segment = segment;
+
+        const Keyframe &from{ _keyframes[segment] };
+        const Keyframe &to{ _keyframes[segment + 1] };
+
+        return interpolate( from.value, to.value, (time - from.time) / (to.time - from.time) );
+    }
+    /// @}
+
+    /** Removes keyframes that can be recreated by interpolating their neighbours
+     *
+     *  Keyframes are removed greedily from the start: each kept keyframe is joined to
+     *  the furthest later keyframe such that every keyframe in between is reproduced
+     *  to within @p tolerance.  The first and last keyframes are always kept.
+     *
+     *  @param tolerance The largest allowed difference between a removed keyframe and
+     *                   the track sampled at its time.  For a Quaternion this is the
+     *                   distance between the two (as 4-vectors, taking the closer of q and -q),
+     *                   for a Vector3D it is the distance between the two points and for a
+     *                   DualQuaternion the larger of the rotation and translation distances.
+     *
+     *  @return The number of keyframes removed
+     *
+     *  @note This takes O(n * k * k) time, where k is the largest number of keyframes removed in a row
+     */
+    std::size_t reduce(const time_type tolerance)
+    {
+        if ( _keyframes.size() < 3 )
+            return 0;
+
+        std::vector<Keyframe> kept{ _keyframes.front() };
+        std::size_t           anchor = 0;
+
+        while ( anchor < _keyframes.size() - 1 )
+        {
+            std::size_t end = anchor + 1;
+
+            while ( end + 1 < _keyframes.size() && canSkipTo( anchor, end + 1, tolerance ) )
+                ++end;
+
+            kept.push_back( _keyframes[end] );
+            anchor = end;
+        }
+
+        const std::size_t removed{ _keyframes.size() - kept.size() };
+
+        _keyframes = std::move( kept );
+        return removed;
+    }
+
+    /** Interpolates between two values the same way as sampling a track does
+     *
+     *  @param from    The value at 0
+     *  @param to      The value at 1
+     *  @param percent [0..1] Represents the percentage to interpolate
+     */
+    static Value interpolate(const Value &from, const Value &to, const time_type percent)
+    {
+        if constexpr ( std::is_same_v<Value, Quaternion<time_type>> )
+            return slerp( from, (dot( from, to ) < time_type{0}) ? -to : to, percent );
+        else if constexpr ( std::is_same_v<Value, DualQuaternion<time_type>> )
+            return blend( from, (dot( from.rotation(), to.rotation() ) < time_type{0}) ? to * time_type{-1} : to, percent );
+        else
+            return from + (to - from) * percent;
+    }
+
+    /** Measures the difference between two values as used by reduce() */
+    static time_type distance(const Value &left, const Value &right)
+    {
+        if constexpr ( std::is_same_v<Value, Quaternion<time_type>> )
+        {
+            return std::min( (left - right).magnitude(), (left + right).magnitude() );
+        }
+        else if constexpr ( std::is_same_v<Value, DualQuaternion<time_type>> )
+        {
+            return std::max( AnimationTrack<Quaternion<time_type>>::distance( left.rotation(), right.rotation() ),
+                             (left.translation() - right.translation()).magnitude() );
+        }
+        else
+            return (left - right).magnitude();
+    }
+private:
+    std::vector<Keyframe> _keyframes;
+
+    /** Finds the segment containing @p time
+     *
+     *  @pre front().time < time < back().time
+     */
+    std::size_t findSegment(const time_type time) const
+    {
+        auto after = std::ranges::upper_bound( _keyframes, time, {}, &Keyframe::time );
+
+        return static_cast<std::size_t>( std::max<std::ptrdiff_t>( after - _keyframes.begin() - 1, 0 ) );
+    }
+
+    /** Checks that every keyframe between @p from and @p to is reproduced by interpolating the two */
+    bool canSkipTo(const std::size_t from, const std::size_t to, const time_type tolerance) const
+    {
+        const Keyframe &start{ _keyframes[from] };
+        const Keyframe &end{ _keyframes[to] };
+        const time_type span_of_time{ end.time - start.time };
+
+        for (std::size_t i = from + 1; i < to; ++i)
+        {
+            const time_type percent{ (span_of_time > time_type{0}) ? (_keyframes[i].time - start.time) / span_of_time : time_type{0} };
+
+            if ( distance( interpolate( start.value, end.value, percent ), _keyframes[i].value ) > tolerance )
+                return false;
+        }
+        return true;
+    }
+};
+
+
+/** @name Type Aliases
+ *
+ *  @relates AnimationTrack
+ *
+ *  @{
+ */
+using RotationTrackf       = AnimationTrack<Quaternion<float>>;
+using RotationTrackd       = AnimationTrack<Quaternion<double>>;
+using TranslationTrackf    = AnimationTrack<Vector3D<float>>;
+using TranslationTrackd    = AnimationTrack<Vector3D<double>>;
+using TransformTrackf      = AnimationTrack<DualQuaternion<float>>;
+using TransformTrackd      = AnimationTrack<DualQuaternion<double>>;
+/// @}
+
+}
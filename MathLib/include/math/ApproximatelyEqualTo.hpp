@@ -24,19 +24,19 @@ namespace Math
  * 
  *  @return @c true if the two are equal within @c tolerance , @c false otherwise
  */
-inline bool approximately_equal_to(float input, float near_to, float tolerance = 0.0002f)
+constexpr bool approximately_equal_to(float input, float near_to, float tolerance = 0.0002f)
 {
-    return std::abs(near_to - input) <= tolerance;
+    return (near_to - input <= tolerance) && (input - near_to <= tolerance);
 }
 
-inline bool approximately_equal_to(double input, double near_to, float tolerance = 0.0002f)
+constexpr bool approximately_equal_to(double input, double near_to, float tolerance = 0.0002f)
 {
-    return std::abs(near_to - input) <= tolerance;
+    return (near_to - input <= tolerance) && (input - near_to <= tolerance);
 }
 
-inline bool approximately_equal_to(long double input, long double near_to, float tolerance = 0.0002f)
+constexpr bool approximately_equal_to(long double input, long double near_to, float tolerance = 0.0002f)
 {
-    return std::abs(near_to - input) <= tolerance;
+    return (near_to - input <= tolerance) && (input - near_to <= tolerance);
 }
 /// @}
 
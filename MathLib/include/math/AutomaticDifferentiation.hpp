@@ -0,0 +1,255 @@
+#pragma once
+
+#include "math/AdjointTape.hpp"
+#include "math/Dual.hpp"
+#include "math/DualN.hpp"
+#include "math/HyperDual.hpp"
+#include "math/HyperDualN.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+/** @file
+ *
+ *  Contains functions that differentiate other functions by evaluating them with dual numbers
+ *
+ *  @hideincludegraph
+ */
+
+namespace Math
+{
+
+/** @addtogroup AutomaticDifferentiation
+ *
+ *  The functions to differentiate are written once for any number type, usually as generic
+ *  lambdas, and are then evaluated with dual numbers here:
+ *
+ *  @code
+ *  auto spherical = [](auto input, auto output)
+ *      {
+ *          output[0] = input[0] * sin( input[1] ) * cos( input[2] );
+ *          ...
+ *      };
+ *
+ *  jacobian<3>( spherical, point, matrix );
+ *  @endcode
+ *
+ *  The forward mode functions take one evaluation per @c N inputs, and the reverse mode
+ *  ones, which record to an AdjointTape, take one in all, which pays off for scalar
+ *  functions of many inputs.
+ *
+ *  @{
+ */
+
+/** Computes the derivative of @p function at @p x
+ *
+ *  @param function Called with a Dual<T> and returns a Dual<T>
+ *  @param x        Where to take the derivative
+ */
+template <class T, class Function>
+T derivative(Function &&function, const T x)
+{
+    return function( Dual<T>{ x, T{1} } ).dual;
+}
+
+/** Computes the Jacobian matrix of @p function at @p point
+ *
+ *  @param function Called with a @c std::span<const DualN<T, N>> of inputs and a @c std::span<DualN<T, N>>
+ *                  to write its outputs to
+ *  @param point    Where to take the derivatives
+ *  @param output   The Jacobian, one row of @c point.size() partial derivatives per output of @p function
+ *
+ *  @tparam N The number of partial derivatives taken per evaluation of @p function, which is
+ *            evaluated @f$ \lceil \frac{n}{N} \rceil @f$ times for @f$ n @f$ inputs
+ *
+ *  @pre @p point is not empty and the size of @p output is a multiple of its size
+ */
+template <std::size_t N = 8, class T, class Function>
+void jacobian(Function &&function, std::span<const T> point, std::span<T> output)
+{
+    assert( !point.empty() && output.size() % point.size() == 0 );
+
+    const std::size_t        input_count = point.size();
+    const std::size_t        output_count = output.size() / input_count;
+    std::vector<DualN<T, N>> inputs( point.begin(), point.end() );
+    std::vector<DualN<T, N>> outputs( output_count );
+
+    for (std::size_t first = 0; first < input_count; first += N)
+    {
+        const std::size_t lanes = std::min( N, input_count - first );
+
+        for (std::size_t lane = 0; lane < lanes; ++lane)
+            inputs[first + lane].dual[lane] = T{1};
+
+        function( std::span<const DualN<T, N>>{ inputs }, std::span<DualN<T, N>>{ outputs } );
+
+        for (std::size_t row = 0; row < output_count; ++row)
+        {
+            for (std::size_t lane = 0; lane < lanes; ++lane)
+                output[row * input_count + first + lane] = outputs[row].dual[lane];
+        }
+
+        for (std::size_t lane = 0; lane < lanes; ++lane)
+            inputs[first + lane].dual[lane] = T{0};
+    }
+}
+
+/** Computes the gradient of the scalar valued @p function at @p point
+ *
+ *  @param function Called with a @c std::span<const DualN<T, N>> of inputs and returns a DualN<T, N>
+ *  @param point    Where to take the derivatives
+ *  @param output   The partial derivative with respect to each of @p point
+ *
+ *  @tparam N The number of partial derivatives taken per evaluation of @p function
+ *
+ *  @pre @p output is the same size as @p point
+ */
+template <std::size_t N = 8, class T, class Function>
+void gradient(Function &&function, std::span<const T> point, std::span<T> output)
+{
+    assert( output.size() == point.size() );
+
+    jacobian<N>( [&function](std::span<const DualN<T, N>> inputs, std::span<DualN<T, N>> outputs) { outputs[0] = function( inputs ); },
+                 point,
+                 output );
+}
+
+/** Computes the second derivative of @p function at @p x
+ *
+ *  @param function Called with a HyperDual<T> and returns a HyperDual<T>
+ *  @param x        Where to take the derivative
+ */
+template <class T, class Function>
+T second_derivative(Function &&function, const T x)
+{
+    return function( HyperDual<T>::variable( x ) ).e12;
+}
+
+/** Computes the Hessian matrix of the scalar valued @p function at @p point
+ *
+ *  Each evaluation seeds the first part of one input and the @p N second parts of a block
+ *  of @p N inputs, giving that block of a row of the Hessian.  Only the blocks on or right
+ *  of the diagonal are evaluated, and mirrored into the lower triangle, so @p function is
+ *  evaluated @f$ \sum_{i=1}^{n} \lceil \frac{i}{N} \rceil @f$ times for @f$ n @f$ inputs,
+ *  about @f$ \frac{n^2}{2N} @f$.  The inputs are set up once and only the seeds that change
+ *  are touched between evaluations.
+ *
+ *  @param function          Called with a @c std::span<const HyperDualN<T, N>> of inputs and returns a HyperDualN<T, N>
+ *  @param point             Where to take the derivatives
+ *  @param output            The @f$ n \times n @f$ Hessian, row by row
+ *  @param first_derivatives The gradient, which comes for free.  Can be empty.
+ *
+ *  @tparam N The number of second partial derivatives taken per evaluation of @p function
+ *
+ *  @pre @p output has room for @f$ n^2 @f$ values and @p first_derivatives is either empty or the same size as @p point
+ */
+template <std::size_t N = 4, class T, class Function>
+void hessian(Function &&function, std::span<const T> point, std::span<T> output, std::span<T> first_derivatives = {})
+{
+    const std::size_t count = point.size();
+
+    assert( output.size() >= count * count );
+    assert( first_derivatives.empty() || first_derivatives.size() == count );
+
+    std::vector<HyperDualN<T, N>> inputs( point.begin(), point.end() );
+
+    for (std::size_t row = 0; row < count; ++row)
+    {
+        inputs[row].e1 = T{1};
+
+        for (std::size_t first = row; first < count; first += N)
+        {
+            const std::size_t lanes = std::min( N, count - first );
+
+            for (std::size_t lane = 0; lane < lanes; ++lane)
+                inputs[first + lane].e2[lane] = T{1};
+
+            const HyperDualN<T, N> result{ function( std::span<const HyperDualN<T, N>>{ inputs } ) };
+
+            for (std::size_t lane = 0; lane < lanes; ++lane)
+                output[row * count + first + lane] = output[(first + lane) * count + row] = result.e12[lane];
+            if ( first == row && !first_derivatives.empty() )
+                first_derivatives[row] = result.e1;
+
+            for (std::size_t lane = 0; lane < lanes; ++lane)
+                inputs[first + lane].e2[lane] = T{0};
+        }
+
+        inputs[row].e1 = T{0};
+    }
+}
+
+/** Computes the gradient of the scalar valued @p function at @p point in reverse mode
+ *
+ *  The cost is a small multiple of one evaluation of @p function however many inputs it
+ *  has, so this is the one to use for functions of many variables.
+ *
+ *  @param tape     Records the evaluation.  Reusing it across calls avoids allocating.
+ *  @param function Called with a @c std::span<const Adjoint<T>> of inputs and returns an Adjoint<T>
+ *  @param point    Where to take the derivatives
+ *  @param output   The partial derivative with respect to each of @p point
+ *
+ *  @return The value of @p function at @p point
+ *
+ *  @pre @p output is the same size as @p point
+ */
+template <class T, class Function>
+T adjoint_gradient(AdjointTape<T> &tape, Function &&function, std::span<const T> point, std::span<T> output)
+{
+    assert( output.size() == point.size() );
+
+    tape.clear();
+
+    const std::span<const Adjoint<T>> inputs{ tape.variables( point ) };
+    const Adjoint<T>                  value{ function( inputs ) };
+
+    tape.propagate( value );
+    for (std::size_t i = 0; i < inputs.size(); ++i)
+        output[i] = tape.adjoint( inputs[i] );
+    return value.real;
+}
+
+/** Computes the gradient of a sum of @p term_count terms at @p point in reverse mode
+ *
+ *  Each term is recorded, propagated and dropped from the tape before the next one, so the
+ *  tape only ever holds the inputs and one term, e.g. one residual of a least squares cost.
+ *
+ *  @param tape     Records the evaluation.  Reusing it across calls avoids allocating.
+ *  @param term     Called with the index of the term and a @c std::span<const Adjoint<T>> of inputs,
+ *                  and returns the term as an Adjoint<T>
+ *  @param point    Where to take the derivatives
+ *  @param output   The partial derivative of the sum with respect to each of @p point
+ *
+ *  @return The value of the sum at @p point
+ *
+ *  @pre @p output is the same size as @p point
+ */
+template <class T, class Term>
+T adjoint_gradient_of_sum(AdjointTape<T> &tape, Term &&term, const std::size_t term_count, std::span<const T> point, std::span<T> output)
+{
+    assert( output.size() == point.size() );
+
+    tape.clear();
+
+    const std::span<const Adjoint<T>>         inputs{ tape.variables( point ) };
+    const typename AdjointTape<T>::Checkpoint after_inputs{ tape.checkpoint() };
+    T                                         sum{};
+
+    for (std::size_t n = 0; n < term_count; ++n)
+    {
+        const Adjoint<T> value{ term( n, inputs ) };
+
+        sum += value.real;
+        tape.propagate( value, after_inputs );
+        tape.rewind( after_inputs );
+    }
+
+    for (std::size_t i = 0; i < inputs.size(); ++i)
+        output[i] = tape.adjoint( inputs[i] );
+    return sum;
+}
+/// @}  {AutomaticDifferentiation}
+
+}
@@ -0,0 +1,230 @@
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <limits>
+#include <numbers>
+
+/** @file
+ *
+ *  Contains versions of the elementary functions that can be evaluated at compile time
+ *
+ *  @hideincludegraph
+ */
+
+namespace Math
+{
+
+/** Takes @p turns whole turns off of @p radians, a piece of @f$ 2\pi @f$ at a time
+ *
+ *  The first three pieces have 8, 16 and 24 significant bits, so multiplying them by the
+ *  number of turns is exact for up to @f$ 2^{29} @f$ turns in @c double, and for the first
+ *  two up to @f$ 2^{8} @f$ turns in @c float.  The last piece is the rest of @f$ 2\pi @f$,
+ *  to the precision of @p T.
+ *
+ *  @pre @p turns is a whole number, or a quarter of one
+ *
+ *  @ingroup AngleWrapping
+ */
+template <class T>
+constexpr T remove_turns(const T radians, const T turns)
+{
+    constexpr T first{ 6.28125 };
+    constexpr T second{ 0x1.fb54p-10 };
+    constexpr T third{ 0x1.10b462p-28 };
+    constexpr T rest{ -1.991598500205919807242394807813279133581e-16L };
+
+    return (((radians - turns * first) - turns * second) - turns * third) - turns * rest;
+}
+
+/** Versions of the elementary functions that can be evaluated at compile time
+ *
+ *  The standard library's functions can't be called in constant expressions before C++26,
+ *  so StandardMath calls these instead when it is being evaluated at compile time, e.g. to
+ *  initialize a @c constexpr table of rotations:
+ *
+ *  @code
+ *  constexpr Quaterniond quarter_turn{ Quaterniond::make_rotation( Radiand{ std::numbers::pi / 2 }, Vector3Dd::unit_z() ) };
+ *  @endcode
+ *
+ *  They work in @c long double and use series that converge to its precision, so the
+ *  results for @c float and @c double are correctly rounded, or within a unit in the last
+ *  place of it.  The trigonometry reduces its argument with remove_turns(), which keeps
+ *  that accuracy for angles of up to @f$ 2^{29} @f$ turns, including those close to a
+ *  multiple of @f$ \frac{\pi}{2} @f$.
+ *
+ *  Where @c long double is no wider than @c double, as with MSVC, @c double results are
+ *  within a few units in the last place instead.  Sines and cosines within about
+ *  @f$ 10^{-15} @f$ of zero only keep an absolute error of about @f$ 10^{-31} @f$ per turn.
+ *
+ *  They are slow at run time, so outside of constant expressions use StandardMath.
+ */
+namespace compile_time
+{
+
+/// The largest integer below or equal to @p value
+template <std::floating_point T>
+constexpr T floor(const T value)
+{
+    constexpr int whole_bits = std::min( std::numeric_limits<T>::digits - 1, 62 );
+    constexpr T   whole{ T( 1ULL << whole_bits ) }; // Beyond this every value is whole
+
+    if ( !(value < whole && value > -whole) )
+        return value;
+
+    const T truncated{ T( static_cast<long long>( value ) ) };
+
+    return (truncated > value) ? truncated - T{1} : truncated;
+}
+
+/// The integer nearest to @p value, with halves going to the even one
+template <std::floating_point T>
+constexpr T nearbyint(const T value)
+{
+    const T lower{ floor( value ) };
+    const T difference{ value - lower };
+
+    if ( difference > T{0.5} )
+        return lower + T{1};
+    if ( difference < T{0.5} )
+        return lower;
+    return (static_cast<long long>( lower ) % 2 == 0) ? lower : lower + T{1};
+}
+
+template <std::floating_point T>
+constexpr T sqrt(const T value)
+{
+    if ( !(value >= T{0}) )
+        return std::numeric_limits<T>::quiet_NaN();
+    if ( value == T{0} || value == std::numeric_limits<T>::infinity() )
+        return value;
+
+    // Scale into [1, 4) by powers of 4, which is exact, so that Newton's method starts close
+    long double scaled{ value };
+    long double scale{ 1.0L };
+
+    while ( scaled >= 4.0L )
+    {
+        scaled *= 0.25L;
+        scale *= 2.0L;
+    }
+    while ( scaled < 1.0L )
+    {
+        scaled *= 4.0L;
+        scale *= 0.5L;
+    }
+
+    long double root{ 0.5L * (scaled + 1.0L) };
+
+    for (int i = 0; i < 6; ++i)
+        root = 0.5L * (root + scaled / root);
+    return T( root * scale );
+}
+
+/** Computes the sine and cosine of @p radians together
+ *
+ *  The angle is reduced to within an eighth of a turn of a multiple of a quarter turn,
+ *  where the Taylor series converge quickly.
+ */
+template <std::floating_point T>
+constexpr void sincos(const T radians, T &sine, T &cosine)
+{
+    if ( !(radians - radians == T{0}) ) // Infinite or NaN
+    {
+        sine = cosine = std::numeric_limits<T>::quiet_NaN();
+        return;
+    }
+
+    constexpr long double half_pi{ 0.5L * std::numbers::pi_v<long double> };
+
+    const long double quarter_turns{ nearbyint( static_cast<long double>( radians ) / half_pi ) };
+    const long double x{ remove_turns( static_cast<long double>( radians ), 0.25L * quarter_turns ) };
+    long double       sin_x{ x }, cos_x{ 1.0L }, term_sin{ x }, term_cos{ 1.0L };
+
+    for (int k = 1; k < 14; ++k)
+    {
+        term_sin *= -x * x / static_cast<long double>( (2 * k) * (2 * k + 1) );
+        term_cos *= -x * x / static_cast<long double>( (2 * k - 1) * (2 * k) );
+        sin_x += term_sin;
+        cos_x += term_cos;
+    }
+
+    // Turning by a quarter turn takes (cos, sin) to (-sin, cos)
+    switch ( static_cast<long long>( quarter_turns - 4.0L * floor( quarter_turns / 4.0L ) ) )
+    {
+        case 0:  sine = T(  sin_x ); cosine = T(  cos_x ); break;
+        case 1:  sine = T(  cos_x ); cosine = T( -sin_x ); break;
+        case 2:  sine = T( -sin_x ); cosine = T( -cos_x ); break;
+        default: sine = T( -cos_x ); cosine = T(  sin_x ); break;
+    }
+}
+
+template <std::floating_point T>
+constexpr T sin(const T radians)
+{
+    T sine, cosine;
+
+    sincos( radians, sine, cosine );
+    return sine;
+}
+
+template <std::floating_point T>
+constexpr T cos(const T radians)
+{
+    T sine, cosine;
+
+    sincos( radians, sine, cosine );
+    return cosine;
+}
+
+/** The angle whose tangent is @p y / @p x, in the quadrant of the point (@p x, @p y)
+ *
+ *  @note Unlike @c std::atan2 the sign of a zero @p y is ignored
+ */
+template <std::floating_point T>
+constexpr T atan2(const T y, const T x)
+{
+    if ( y != y || x != x )
+        return std::numeric_limits<T>::quiet_NaN();
+    if ( y == T{0} && x == T{0} )
+        return T{0};
+
+    constexpr long double pi{ std::numbers::pi_v<long double> };
+
+    const long double abs_x{ (x < T{0}) ? -static_cast<long double>( x ) : static_cast<long double>( x ) };
+    const long double abs_y{ (y < T{0}) ? -static_cast<long double>( y ) : static_cast<long double>( y ) };
+    const bool        steep{ abs_y > abs_x };
+    long double       t{ steep ? abs_x / abs_y : abs_y / abs_x }; // In [0, 1]
+
+    // atan(t) = 2 atan(t / (1 + sqrt(1 + t^2))), twice, leaves t below tan(pi / 16)
+    t = t / (1.0L + sqrt( 1.0L + t * t ));
+    t = t / (1.0L + sqrt( 1.0L + t * t ));
+
+    long double angle{ t }, term{ t };
+
+    for (int k = 1; k < 20; ++k)
+    {
+        term *= -t * t;
+        angle += term / static_cast<long double>( 2 * k + 1 );
+    }
+    angle *= 4.0L;
+
+    angle = steep ? 0.5L * pi - angle : angle;
+    angle = (x < T{0}) ? pi - angle : angle;
+    return T( (y < T{0}) ? -angle : angle );
+}
+
+template <std::floating_point T>
+constexpr T acos(const T value)
+{
+    if ( !(value >= T{-1} && value <= T{1}) )
+        return std::numeric_limits<T>::quiet_NaN();
+
+    const long double x{ value };
+
+    return T( atan2( sqrt( (1.0L - x) * (1.0L + x) ), x ) );
+}
+
+}
+
+}
\ No newline at end of file
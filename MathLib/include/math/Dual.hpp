@@ -2,6 +2,8 @@
 
 #include "math/Functions.hpp"
 #include <cassert>
+#include <cmath>
+#include <numbers>
 
 
 /** @file
@@ -15,12 +17,306 @@
 namespace Math
 {
 
+/** @addtogroup AutomaticDifferentiation Automatic Differentiation
+ *
+ *  Dual numbers carry the derivatives of a value alongside the value itself.  Evaluating a
+ *  function with them (forward mode automatic differentiation) gives the exact derivatives
+ *  of its output at the cost of a few extra multiplications per operation, instead of the
+ *  extra evaluations and rounding error of finite differences.
+ *
+ *  @{
+ */
+
+/** Overloads of the @c <cmath> functions for a dual number type
+ *
+ *  A dual number type @p D with value type @p T gets these by deriving from
+ *  DualFunctions<D, T> and providing:
+ *  - @c real, the value
+ *  - @c chain(value, derivative), which returns the result of a function of one variable
+ *    with the given value and derivative at @c real
+ *  - @c D::chain(x, y, value, dx, dy), the same for a function of two variables
+ *
+ *  They are hidden friends, so they are only found by argument-dependent lookup and
+ *  never hide the standard library's versions for plain numbers.  Calls on @c real are
+ *  unqualified as well, so dual numbers nest.
+ *
+ *  @note Comparisons inside the derivatives only look at values, so @p T needs @c <
+ */
+template <class D, class T>
+class DualFunctions
+{
+    /** @name Powers and Roots
+     *  @{
+     */
+    friend constexpr D sqrt(const D &x)
+    {
+        using std::sqrt;
+
+        const T root{ sqrt( x.real ) };
+
+        return x.chain( root, T{1} / (T{2} * root) );
+    }
+
+    friend constexpr D cbrt(const D &x)
+    {
+        using std::cbrt;
+
+        const T root{ cbrt( x.real ) };
+
+        return x.chain( root, T{1} / (T{3} * root * root) );
+    }
+
+    friend constexpr D pow(const D &base, const T &exponent)
+    {
+        using std::pow;
+
+        return base.chain( pow( base.real, exponent ), exponent * pow( base.real, exponent - T{1} ) );
+    }
+
+    friend constexpr D pow(const T &base, const D &exponent)
+    {
+        using std::pow;
+        using std::log;
+
+        const T value{ pow( base, exponent.real ) };
+
+        return exponent.chain( value, value * log( base ) );
+    }
+
+    /// @note The derivative with respect to the exponent is taken as 0 when @p base is not positive
+    friend constexpr D pow(const D &base, const D &exponent)
+    {
+        using std::pow;
+        using std::log;
+
+        const T value{ pow( base.real, exponent.real ) };
+        const T d_base{ exponent.real * pow( base.real, exponent.real - T{1} ) };
+        const T d_exponent{ (T{0} < base.real) ? value * log( base.real ) : T{0} };
+
+        return D::chain( base, exponent, value, d_base, d_exponent );
+    }
+
+    friend constexpr D hypot(const D &x, const D &y)
+    {
+        using std::hypot;
+
+        const T value{ hypot( x.real, y.real ) };
+
+        return D::chain( x, y, value, x.real / value, y.real / value );
+    }
+    /// @}
+
+    /** @name Exponentials and Logarithms
+     *  @{
+     */
+    friend constexpr D exp(const D &x)
+    {
+        using std::exp;
+
+        const T value{ exp( x.real ) };
+
+        return x.chain( value, value );
+    }
+
+    friend constexpr D exp2(const D &x)
+    {
+        using std::exp2;
+
+        const T value{ exp2( x.real ) };
+
+        return x.chain( value, value * std::numbers::ln2_v<T> );
+    }
+
+    friend constexpr D expm1(const D &x)
+    {
+        using std::expm1;
+
+        const T value{ expm1( x.real ) };
+
+        return x.chain( value, value + T{1} );
+    }
+
+    friend constexpr D log(const D &x)
+    {
+        using std::log;
+
+        return x.chain( log( x.real ), T{1} / x.real );
+    }
+
+    friend constexpr D log2(const D &x)
+    {
+        using std::log2;
+
+        return x.chain( log2( x.real ), T{1} / (x.real * std::numbers::ln2_v<T>) );
+    }
+
+    friend constexpr D log10(const D &x)
+    {
+        using std::log10;
+
+        return x.chain( log10( x.real ), T{1} / (x.real * std::numbers::ln10_v<T>) );
+    }
+
+    friend constexpr D log1p(const D &x)
+    {
+        using std::log1p;
+
+        return x.chain( log1p( x.real ), T{1} / (T{1} + x.real) );
+    }
+    /// @}
+
+    /** @name Trigonometric Functions
+     *  @{
+     */
+    friend constexpr D sin(const D &x)
+    {
+        using std::sin;
+        using std::cos;
+
+        return x.chain( sin( x.real ), cos( x.real ) );
+    }
+
+    friend constexpr D cos(const D &x)
+    {
+        using std::sin;
+        using std::cos;
+
+        return x.chain( cos( x.real ), -sin( x.real ) );
+    }
+
+    friend constexpr D tan(const D &x)
+    {
+        using std::tan;
+
+        const T value{ tan( x.real ) };
+
+        return x.chain( value, T{1} + value * value );
+    }
+
+    friend constexpr D asin(const D &x)
+    {
+        using std::asin;
+        using std::sqrt;
+
+        return x.chain( asin( x.real ), T{1} / sqrt( T{1} - x.real * x.real ) );
+    }
+
+    friend constexpr D acos(const D &x)
+    {
+        using std::acos;
+        using std::sqrt;
+
+        return x.chain( acos( x.real ), -T{1} / sqrt( T{1} - x.real * x.real ) );
+    }
+
+    friend constexpr D atan(const D &x)
+    {
+        using std::atan;
+
+        return x.chain( atan( x.real ), T{1} / (T{1} + x.real * x.real) );
+    }
+
+    friend constexpr D atan2(const D &y, const D &x)
+    {
+        using std::atan2;
+
+        const T length_squared{ x.real * x.real + y.real * y.real };
+
+        return D::chain( y, x, atan2( y.real, x.real ), x.real / length_squared, -y.real / length_squared );
+    }
+    /// @}
+
+    /** @name Hyperbolic Functions
+     *  @{
+     */
+    friend constexpr D sinh(const D &x)
+    {
+        using std::sinh;
+        using std::cosh;
+
+        return x.chain( sinh( x.real ), cosh( x.real ) );
+    }
+
+    friend constexpr D cosh(const D &x)
+    {
+        using std::sinh;
+        using std::cosh;
+
+        return x.chain( cosh( x.real ), sinh( x.real ) );
+    }
+
+    friend constexpr D tanh(const D &x)
+    {
+        using std::tanh;
+
+        const T value{ tanh( x.real ) };
+
+        return x.chain( value, T{1} - value * value );
+    }
+
+    friend constexpr D asinh(const D &x)
+    {
+        using std::asinh;
+        using std::sqrt;
+
+        return x.chain( asinh( x.real ), T{1} / sqrt( x.real * x.real + T{1} ) );
+    }
+
+    friend constexpr D acosh(const D &x)
+    {
+        using std::acosh;
+        using std::sqrt;
+
+        return x.chain( acosh( x.real ), T{1} / sqrt( x.real * x.real - T{1} ) );
+    }
+
+    friend constexpr D atanh(const D &x)
+    {
+        using std::atanh;
+
+        return x.chain( atanh( x.real ), T{1} / (T{1} - x.real * x.real) );
+    }
+    /// @}
+
+    /** @name Other Functions
+     *  @{
+     */
+    friend constexpr D erf(const D &x)
+    {
+        using std::erf;
+        using std::exp;
+
+        return x.chain( erf( x.real ), T{2} * std::numbers::inv_sqrtpi_v<T> * exp( -x.real * x.real ) );
+    }
+
+    /// @note The derivative at 0 is taken as 1
+    friend constexpr D abs(const D &x)
+    {
+        return (x.real < T{0}) ? x.chain( -x.real, T{-1} ) : x.chain( x.real, T{1} );
+    }
+
+    /// @copydoc abs(const D &)
+    friend constexpr D fabs(const D &x) { return abs( x ); }
+
+    friend constexpr D fmin(const D &x, const D &y) { return (y.real < x.real) ? y : x; }
+    friend constexpr D fmax(const D &x, const D &y) { return (x.real < y.real) ? y : x; }
+
+    /// The rounding functions are flat wherever they are differentiable
+    friend constexpr D floor(const D &x) { using std::floor; return x.chain( floor( x.real ), T{0} ); }
+    friend constexpr D ceil(const D &x)  { using std::ceil;  return x.chain( ceil( x.real ), T{0} ); }
+    friend constexpr D trunc(const D &x) { using std::trunc; return x.chain( trunc( x.real ), T{0} ); }
+    friend constexpr D round(const D &x) { using std::round; return x.chain( round( x.real ), T{0} ); }
+    /// @}
+};
+/// @}  {AutomaticDifferentiation}
+
+
 /** Class representing the concept of a dual number
  *  
  *  @headerfile "math/Dual.hpp"
  */
 template<class T>
-class Dual
+class Dual : public DualFunctions<Dual<T>, T>
 {
 public:
     using value_type = T;
@@ -38,7 +334,7 @@ public:
 
     constexpr Dual<T> conjugate() const
     {
-        if constexpr (std::is_floating_point_v<T>)
+        if constexpr (is_scalar_v<T>)
             return Dual{ real, -dual };
         else
             return Dual{ real, conjugate(dual) };
@@ -93,6 +389,25 @@ public:
         return approximately_equal_to(*this, right);
     }
 
+    /** @name Chain Rule
+     *
+     *  Used by the DualFunctions to differentiate functions of Duals
+     *
+     *  @{
+     */
+    /// The result of a function with the given @p value and @p derivative at @c real
+    constexpr Dual<T> chain(const T &value, const T &derivative) const
+    {
+        return Dual<T>{ value, derivative * dual };
+    }
+
+    /// The result of a function of @p x and @p y with the given @p value and partial derivatives at their real parts
+    constexpr static Dual<T> chain(const Dual<T> &x, const Dual<T> &y, const T &value, const T &dx, const T &dy)
+    {
+        return Dual<T>{ value, dx * x.dual + dy * y.dual };
+    }
+    /// @}
+
     /** @addtogroup DualAlgebra Dual Number Algebra
      *  @{
      */
@@ -104,8 +419,9 @@ public:
      */
     constexpr Dual<T> operator *(const Dual<T> &right) const
     {
+        // Keeps the order of the factors so that it works for Duals of Quaternions, which don't commute
         return Dual<T>(real * right.real,
-                    real * right.dual + right.real * dual);
+                    real * right.dual + dual * right.real);
     }
 
     /** Defines multiplication of a single-precision scalar and a Dual
@@ -226,6 +542,13 @@ public:
         return Dual<T>(real - right.real, dual - right.dual);
     }
 
+    /** Defines negation of a Dual
+     */
+    constexpr Dual<T> operator -() const
+    {
+        return Dual<T>(-real, -dual);
+    }
+
     /** Defines subtraction of a single-precision scalar and a Dual
      */
     friend constexpr Dual<T> operator -(const float scalar, const Dual<T> &d)
@@ -423,6 +746,20 @@ public:
     /// @} {Private Friend Functions}
 };
 
+/** Lets a Dual of scalars be used as a scalar
+ *
+ *  @relates Dual
+ */
+template <class T>
+struct scalar_traits<Dual<T>>
+{
+    using real_type = real_type_t<T>;
+
+    constexpr static bool is_scalar = is_scalar_v<T>;
+
+    constexpr static real_type value(const Dual<T> &input) { return value_of( input.real ); }
+};
+
 
 /** @name Type Aliases
  * 
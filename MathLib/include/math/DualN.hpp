@@ -0,0 +1,235 @@
+#pragma once
+
+#include "math/Dual.hpp"
+#include <array>
+#include <cassert>
+#include <compare>
+#include <cstddef>
+
+/** @file
+ *
+ *  Contains the definition of the DualN class, a dual number with many derivatives
+ *
+ *  @hideincludegraph
+ */
+
+namespace Math
+{
+
+/** A dual number that carries the partial derivatives with respect to @p N variables at once
+ *
+ *  Evaluating a function with DualN gives its value and @p N directional derivatives in one
+ *  pass.  The derivatives are kept in a plain array, and every operation does the same thing
+ *  to each of them, so compilers can vectorize the loops over them.
+ *
+ *  Comparisons only look at the values, so code that branches on them takes the same
+ *  path as it would with plain numbers.
+ *
+ *  @headerfile "math/DualN.hpp"
+ *
+ *  @ingroup AutomaticDifferentiation
+ */
+template <class T, std::size_t N>
+class DualN : public DualFunctions<DualN<T, N>, T>
+{
+public:
+    using value_type = T;
+
+    constexpr static std::size_t lanes = N; ///< The number of derivatives carried
+
+    DualN() = default;
+    explicit constexpr DualN(const T value) : real(value) { } ///< Constructs a constant, whose derivatives are all zero
+    constexpr DualN(const T value, const std::array<T, N> &derivatives) : real(value), dual(derivatives) { }
+
+    /** Constructs the independent variable for derivative number @p lane
+     *
+     *  @pre @p lane < N
+     */
+    constexpr static DualN<T, N> variable(const T value, const std::size_t lane)
+    {
+        assert( lane < N );
+
+        DualN<T, N> output{ value };
+
+        output.dual[lane] = T{1};
+        return output;
+    }
+
+    /** @name Element Access
+     *  @{
+     */
+    T                real{};
+    std::array<T, N> dual{};
+    /// @}
+
+    /** @name Chain Rule
+     *
+     *  Used by the DualFunctions to differentiate functions of DualNs
+     *
+     *  @{
+     */
+    /// The result of a function with the given @p value and @p derivative at @c real
+    constexpr DualN<T, N> chain(const T &value, const T &derivative) const
+    {
+        DualN<T, N> output{ value };
+
+        for (std::size_t i = 0; i < N; ++i)
+            output.dual[i] = derivative * dual[i];
+        return output;
+    }
+
+    /// The result of a function of @p x and @p y with the given @p value and partial derivatives at their real parts
+    constexpr static DualN<T, N> chain(const DualN<T, N> &x, const DualN<T, N> &y, const T &value, const T &dx, const T &dy)
+    {
+        DualN<T, N> output{ value };
+
+        for (std::size_t i = 0; i < N; ++i)
+            output.dual[i] = dx * x.dual[i] + dy * y.dual[i];
+        return output;
+    }
+    /// @}
+
+    /** @name Operators
+     *  @{
+     */
+    constexpr DualN<T, N> &operator +=(const DualN<T, N> &other)
+    {
+        real += other.real;
+        for (std::size_t i = 0; i < N; ++i)
+            dual[i] += other.dual[i];
+        return *this;
+    }
+
+    constexpr DualN<T, N> &operator -=(const DualN<T, N> &other)
+    {
+        real -= other.real;
+        for (std::size_t i = 0; i < N; ++i)
+            dual[i] -= other.dual[i];
+        return *this;
+    }
+
+    constexpr DualN<T, N> &operator *=(const DualN<T, N> &other)
+    {
+        for (std::size_t i = 0; i < N; ++i)
+            dual[i] = dual[i] * other.real + real * other.dual[i];
+        real *= other.real;
+        return *this;
+    }
+
+    constexpr DualN<T, N> &operator /=(const DualN<T, N> &other)
+    {
+        const T inverse{ T{1} / other.real };
+        const T quotient{ real * inverse };
+
+        for (std::size_t i = 0; i < N; ++i)
+            dual[i] = (dual[i] - quotient * other.dual[i]) * inverse;
+        real = quotient;
+        return *this;
+    }
+
+    constexpr DualN<T, N> &operator +=(const T scalar)
+    {
+        real += scalar;
+        return *this;
+    }
+
+    constexpr DualN<T, N> &operator -=(const T scalar)
+    {
+        real -= scalar;
+        return *this;
+    }
+
+    constexpr DualN<T, N> &operator *=(const T scalar)
+    {
+        real *= scalar;
+        for (std::size_t i = 0; i < N; ++i)
+            dual[i] *= scalar;
+        return *this;
+    }
+
+    constexpr DualN<T, N> &operator /=(const T scalar)
+    {
+        return *this *= T{1} / scalar;
+    }
+    /// @}
+private:
+
+    /** @name Global Operators
+     *
+     *  @relates DualN
+     *
+     *  @{
+     */
+    friend constexpr DualN<T, N> operator -(const DualN<T, N> &input) { return input.chain( -input.real, T{-1} ); }
+
+    friend constexpr DualN<T, N> operator +(DualN<T, N> left, const DualN<T, N> &right) { return left += right; }
+    friend constexpr DualN<T, N> operator -(DualN<T, N> left, const DualN<T, N> &right) { return left -= right; }
+    friend constexpr DualN<T, N> operator *(DualN<T, N> left, const DualN<T, N> &right) { return left *= right; }
+    friend constexpr DualN<T, N> operator /(DualN<T, N> left, const DualN<T, N> &right) { return left /= right; }
+
+    friend constexpr DualN<T, N> operator +(DualN<T, N> left, const T right) { return left += right; }
+    friend constexpr DualN<T, N> operator -(DualN<T, N> left, const T right) { return left -= right; }
+    friend constexpr DualN<T, N> operator *(DualN<T, N> left, const T right) { return left *= right; }
+    friend constexpr DualN<T, N> operator /(DualN<T, N> left, const T right) { return left /= right; }
+
+    friend constexpr DualN<T, N> operator +(const T left, DualN<T, N> right) { return right += left; }
+    friend constexpr DualN<T, N> operator -(const T left, const DualN<T, N> &right) { return -right + left; }
+    friend constexpr DualN<T, N> operator *(const T left, DualN<T, N> right) { return right *= left; }
+    friend constexpr DualN<T, N> operator /(const T left, const DualN<T, N> &right) { return DualN<T, N>{ left } / right; }
+
+    friend constexpr bool operator ==(const DualN<T, N> &left, const DualN<T, N> &right) { return left.real == right.real; }
+    friend constexpr bool operator ==(const DualN<T, N> &left, const T right) { return left.real == right; }
+
+    friend constexpr auto operator <=>(const DualN<T, N> &left, const DualN<T, N> &right) { return left.real <=> right.real; }
+    friend constexpr auto operator <=>(const DualN<T, N> &left, const T right) { return left.real <=> right; }
+    /// @}
+
+    /** @addtogroup Equality
+     *
+     *  @relates DualN
+     *
+     *  @{
+     */
+    /// Compares the values and all of the derivatives to within @p tolerance
+    friend constexpr bool approximately_equal_to(const DualN<T, N> &value_to_test,
+                                                 const DualN<T, N> &value_it_should_be,
+                                                 const real_type_t<T> tolerance = real_type_t<T>{0.0002})
+    {
+        bool equal = approximately_equal_to( value_to_test.real, value_it_should_be.real, tolerance );
+
+        for (std::size_t i = 0; i < N; ++i)
+            equal = equal && approximately_equal_to( value_to_test.dual[i], value_it_should_be.dual[i], tolerance );
+        return equal;
+    }
+    /// @}  {Equality}
+};
+
+/** Lets a DualN be used as a scalar
+ *
+ *  @relates DualN
+ */
+template <class T, std::size_t N>
+struct scalar_traits<DualN<T, N>>
+{
+    using real_type = real_type_t<T>;
+
+    constexpr static bool is_scalar = is_scalar_v<T>;
+
+    constexpr static real_type value(const DualN<T, N> &input) { return value_of( input.real ); }
+};
+
+
+/** @name Type Aliases
+ *
+ *  @relates DualN
+ *
+ *  @{
+ */
+template <std::size_t N>
+using DualNf = DualN<float, N>;
+
+template <std::size_t N>
+using DualNd = DualN<double, N>;
+/// @}
+
+}
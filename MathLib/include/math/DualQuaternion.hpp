@@ -5,6 +5,8 @@
 #include "math/Vector3D.hpp"
 #include "math/Functions.hpp"
 #include <cassert>
+#include <cmath>
+#include <limits>
 
 /** @file
  *  
@@ -105,6 +107,23 @@ public:
         return DualQuaternion<T>{ rotation, Quaternion<T>::zero() };
     }
 
+    /** Create a DualQuaternion containing a rotation only
+     *  
+     *  @param radians The amount of rotation to apply (in radians)
+     *  @param axis    The axis to rotate around
+     *
+     *  @tparam Policy Supplies the trigonometry (see @ref MathPolicies)
+     *
+     *  @return A DualQuaternion representing a rotation only
+     *  
+     *  @see Quaternion::make_rotation
+     */
+    template <class Policy = StandardMath>
+    constexpr static DualQuaternion<T> make_rotation(const Radian<T> radians, const Vector3D<T> &axis)
+    {
+        return make_rotation( Quaternion<T>::template make_rotation<Policy>( radians, axis ) );
+    }
+
     /** Create a DualQuaternion containing a translation only
      *  
      *  @param translation_x The X component of the translation vector
@@ -252,6 +271,113 @@ public:
         return *this / norm();
     }
 
+    /** Computes the log base e of this DualQuaternion
+     *
+     *  For a unit DualQuaternion this is the pure DualQuaternion
+     *  @f$ \frac{\theta}{2} l + \epsilon ( \frac{d}{2} l + \frac{\theta}{2} m ) @f$,
+     *  where @f$ \theta @f$, @f$ d @f$, @f$ l @f$ and @f$ m @f$ are the angle, pitch, axis
+     *  and moment of its screw motion.  Non-unit DualQuaternions also get the log of their
+     *  norm in the scalar parts, so that log( exp( x ) ) == x.
+     *
+     *  @pre The rotation is less than a full turn, i.e. real().w() is not -1.
+     *       Negate a unit DualQuaternion with real().w() < 0 first to get the shortest motion.
+     *
+     *  @note Small rotations use a series expansion instead of dividing by the sine of the angle,
+     *        so pure translations and the identity are handled without special cases.
+     */
+    DualQuaternion<T> log() const
+    {
+        using std::atan2;
+        using std::log;
+
+        // Split off the (dual number) norm
+        const T             real_norm{ real().norm() };
+        const T             dual_norm{ dot( real(), dual() ) / real_norm };
+        const Quaternion<T> unit_real{ real() / real_norm };
+        const Quaternion<T> unit_dual{ (dual() - unit_real * dual_norm) / real_norm };
+
+        const Vector3D<T> v{ unit_real.imaginary() };
+        const T           sin_half_angle{ v.magnitude() };
+        const T           half_angle{ atan2( sin_half_angle, unit_real.w() ) };
+        T                 angle_over_sine;    // half_angle / sin(half_angle)
+        T                 dual_coefficient;   // (1 - half_angle * cot(half_angle)) / sin^2(half_angle)
+
+        if ( half_angle < small_angle_threshold() )
+        {
+            const T angle_squared{ half_angle * half_angle };
+
+            angle_over_sine  = T{1} + angle_squared * (T{1} / T{6} + angle_squared * T{7} / T{360});
+            dual_coefficient = T{1} / T{3} + angle_squared * (T{2} / T{15} + angle_squared * T{2} / T{63});
+        }
+        else
+        {
+            angle_over_sine  = half_angle / sin_half_angle;
+            dual_coefficient = (T{1} - angle_over_sine * unit_real.w()) / (sin_half_angle * sin_half_angle);
+        }
+
+        const Vector3D<T> real_part{ v * angle_over_sine };
+        const Vector3D<T> dual_part{ unit_dual.imaginary() * angle_over_sine - v * (unit_dual.w() * dual_coefficient) };
+
+        return DualQuaternion<T>{ Quaternion<T>{ log( real_norm ), real_part.x, real_part.y, real_part.z },
+                                  Quaternion<T>{ dual_norm / real_norm, dual_part.x, dual_part.y, dual_part.z } };
+    }
+
+    /** Computes the exponential of this DualQuaternion
+     *
+     *  This is the inverse of log(), so a pure DualQuaternion @f$ a + \epsilon b @f$ becomes the
+     *  unit DualQuaternion of the screw motion with angle @f$ 2 |a| @f$ about the axis of @p a.
+     *
+     *  @note Small angles use a series expansion instead of dividing by the angle
+     */
+    DualQuaternion<T> exp() const
+    {
+        using std::sqrt;
+        using std::exp;
+
+        const Vector3D<T> a{ real().imaginary() };
+        const Vector3D<T> b{ dual().imaginary() };
+        const T           angle_squared{ dot( a, a ) };
+        const T           angle{ sqrt( angle_squared ) };
+        const SineCosine<T> sine_cosine{ sincos( Radian<T>{ angle } ) };
+        const T           cos_angle{ sine_cosine.cos };
+        T                 sine_over_angle;    // sin(angle) / angle
+        T                 dual_coefficient;   // (cos(angle) - sin(angle) / angle) / angle^2
+
+        if ( angle < small_angle_threshold() )
+        {
+            sine_over_angle  = T{1} - angle_squared * (T{1} / T{6} - angle_squared / T{120});
+            dual_coefficient = -T{1} / T{3} + angle_squared * (T{1} / T{30} - angle_squared / T{840});
+        }
+        else
+        {
+            sine_over_angle  = sine_cosine.sin / angle;
+            dual_coefficient = (cos_angle - sine_over_angle) / angle_squared;
+        }
+
+        const T           a_dot_b{ dot( a, b ) };
+        const Vector3D<T> real_part{ a * sine_over_angle };
+        const Vector3D<T> dual_part{ b * sine_over_angle + a * (a_dot_b * dual_coefficient) };
+        const Quaternion<T> unit_real{ cos_angle, real_part.x, real_part.y, real_part.z };
+        const Quaternion<T> unit_dual{ -a_dot_b * sine_over_angle, dual_part.x, dual_part.y, dual_part.z };
+
+        // The scalar parts commute with everything, so they just scale by the Dual number exp(w)
+        const T e_to_the_w{ exp( real().w() ) };
+
+        return DualQuaternion<T>{ unit_real * e_to_the_w, (unit_dual + unit_real * dual().w()) * e_to_the_w };
+    }
+
+    /** Computes this DualQuaternion raised to a real power
+     *
+     *  For a unit DualQuaternion this scales the angle and pitch of its screw motion by
+     *  @p exponent, e.g. pow( 0.5 ) is the transformation that does half of the motion.
+     *
+     *  @pre Same as log()
+     */
+    DualQuaternion<T> pow(const T exponent) const
+    {
+        return (log() * exponent).exp();
+    }
+
     /** Checks for a DualQuaternion's rotation component has a magnitude of one
      *  
      *  @return @c true of the magnitude of the rotation is 1, @c false otherwise
@@ -299,6 +425,13 @@ public:
         return approximately_equal_to(*this, right);
     }
 private:
+    /** The angle below which log() and exp() switch to a series expansion
+     *
+     *  This balances the truncation error of the series against the cancellation
+     *  in the closed form, which is worse the fewer bits of precision @p T has.
+     */
+    constexpr static T small_angle_threshold() { return (std::numeric_limits<real_type_t<T>>::digits <= 24) ? T{0.2} : T{0.02}; }
+
     Dual<Quaternion<T>> _frame_of_reference{ Quaternion<T>::identity(), Quaternion<T>::zero() }; // The default value is an identity transformation
 
     /** @name Global Operators
@@ -324,6 +457,19 @@ private:
     }
     /// @}  {Addition}
 
+    /** @name Subtraction
+     *  @{
+     */
+    /** Defines subtraction
+     *
+     *  We basically just subtract the underlying Dual numbers
+     */
+    friend constexpr DualQuaternion<T> operator -(const DualQuaternion<T> &left_side, const DualQuaternion<T> &right_side)
+    {
+        return DualQuaternion<T>{ left_side._frame_of_reference - right_side._frame_of_reference };
+    }
+    /// @}  {Subtraction}
+
 
     /** @name Multiplication
      *  @{
@@ -418,7 +564,7 @@ private:
      *  
      *  @see Equality
      */
-    friend constexpr bool approximately_equal_to(const DualQuaternion<T> &value_to_test, const DualQuaternion<T> &value_it_should_be, float tolerance = 0.0002f)
+    friend constexpr bool approximately_equal_to(const DualQuaternion<T> &value_to_test, const DualQuaternion<T> &value_it_should_be, real_type_t<T> tolerance = real_type_t<T>{0.0002})
     {
         // Just use the underlying Dual number's version of the same function...
         return approximately_equal_to( value_to_test._frame_of_reference, value_it_should_be._frame_of_reference, tolerance );
@@ -468,6 +614,24 @@ private:
         return input.conjugate();
     }
 
+    /**  Computes the log of the input
+     * 
+     *   @note This will just call @c input.log()
+     */
+    friend DualQuaternion<T> log(const DualQuaternion<T> &input)
+    {
+        return input.log();
+    }
+
+    /**  Computes the exponential of the input
+     * 
+     *   @note This will just call @c input.exp()
+     */
+    friend DualQuaternion<T> exp(const DualQuaternion<T> &input)
+    {
+        return input.exp();
+    }
+
     /** @addtogroup Checks
      * 
      *  Compare two values for equality with a tolerance and prints debug information when false
@@ -478,7 +642,7 @@ private:
      * 
      *  @return @c true if the two are equal within @c tolerance , @c false otherwise
      */
-    friend bool check_if_equal(const DualQuaternion<T> &input, const DualQuaternion<T> &near_to, float tolerance = 0.0002f)
+    friend bool check_if_equal(const DualQuaternion<T> &input, const DualQuaternion<T> &near_to, real_type_t<T> tolerance = real_type_t<T>{0.0002})
     {
         if (!approximately_equal_to(input, near_to, tolerance))
         {
@@ -505,7 +669,7 @@ private:
      * 
      *  @return @c true if the two are not equal outside @c tolerance , @c false otherwise
      */
-    friend bool check_if_not_equal(const DualQuaternion<T> &input, const DualQuaternion<T> &near_to, float tolerance = 0.0002f)
+    friend bool check_if_not_equal(const DualQuaternion<T> &input, const DualQuaternion<T> &near_to, real_type_t<T> tolerance = real_type_t<T>{0.0002})
     {
         if (approximately_equal_to(input, near_to, tolerance))
         {
@@ -522,17 +686,17 @@ private:
         return true;
     }
 
-    friend void CHECK_IF_EQUAL(const DualQuaternion<T> &input, const DualQuaternion<T> &near_to, const float tolerance = 0.0002f)
+    friend void CHECK_IF_EQUAL(const DualQuaternion<T> &input, const DualQuaternion<T> &near_to, const real_type_t<T> tolerance = real_type_t<T>{0.0002})
     {
         assert( check_if_equal(input, near_to, tolerance) );
     }
 
-    friend void CHECK_IF_NOT_EQUAL(const DualQuaternion<T> &input, const DualQuaternion<T> &near_to, const float tolerance = 0.0002f)
+    friend void CHECK_IF_NOT_EQUAL(const DualQuaternion<T> &input, const DualQuaternion<T> &near_to, const real_type_t<T> tolerance = real_type_t<T>{0.0002})
     {
         assert( check_if_not_equal(input, near_to, tolerance) );
     }
 
-    friend void CHECK_IF_ZERO(const DualQuaternion<T> &input, const float tolerance = 0.0002f)
+    friend void CHECK_IF_ZERO(const DualQuaternion<T> &input, const real_type_t<T> tolerance = real_type_t<T>{0.0002})
     {
         assert( check_if_equal(input, DualQuaternion<T>::zero(), tolerance));
     }
@@ -0,0 +1,341 @@
+#pragma once
+
+#include "math/Quaternion.hpp"
+#include "math/Angle.hpp"
+#include "math/FastMath.hpp"
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <numbers>
+#include <span>
+
+/** @file
+ *
+ *  Contains conversions between Quaternions and Euler angles
+ *
+ *  @hideincludegraph
+ */
+
+namespace Math
+{
+
+/** @addtogroup EulerAngles Euler Angles
+ *
+ *  Converts between unit Quaternions and three rotations about coordinate axes
+ *
+ *  An EulerOrder names the axes in the order that the rotations are applied, each about
+ *  the fixed (world) axes, so @c EulerOrder::XYZ turns about x, then y, then z:
+ *
+ *  @f[ q = q_z(\gamma) q_y(\beta) q_x(\alpha) @f]
+ *
+ *  which is the same rotation as turning about z, then the new y, then the newest x
+ *  (intrinsic ZYX, as used for yaw, pitch and roll).  The six Tait-Bryan orders use
+ *  three different axes and the six proper Euler orders use the first axis again last.
+ *
+ *  The order is a template parameter, so each one compiles to its own straight line of
+ *  arithmetic.  Going from a Quaternion to angles follows Bernardes and Viollet's direct
+ *  method, which is the same for every order:
+ *
+ *  - the second angle is in @f$ [0, \pi] @f$ for the proper Euler orders and in
+ *    @f$ [-\frac{\pi}{2}, \frac{\pi}{2}] @f$ for the Tait-Bryan ones
+ *  - the first and third are in @f$ [-\pi, \pi] @f$
+ *  - in gimbal lock, where only the sum or difference of the first and third angles is
+ *    defined, the first angle is zero and the third one takes the whole rotation
+ *
+ *  None of the functions have data-dependent branches, and every one takes an optional
+ *  policy after the order, which supplies the trigonometry (see @ref MathPolicies).  The
+ *  batched functions take either spans of EulerAngles and Quaternions or, so that the
+ *  components needn't be shuffled in and out of vector registers, EulerAngleArrays and
+ *  QuaternionArrays.  Whether their loops vectorize (checked with GCC 12 at @c -O3) only
+ *  depends on the policy:
+ *
+ *  - With one of the fast:: policies they vectorize with the default floating-point flags
+ *  - With StandardMath the from_euler() loops don't, since @c std::sin and @c std::cos are
+ *    calls, and the to_euler() loops only do with @c -ffast-math, which lets them call the
+ *    vector versions of @c std::atan2 in glibc's libmvec
+ *
+ *  @{
+ */
+
+enum class EulerOrder
+{
+    XYZ, XZY, YXZ, YZX, ZXY, ZYX, ///< Tait-Bryan angles
+    XYX, XZX, YXY, YZY, ZXZ, ZYZ  ///< Proper Euler angles
+};
+
+/** Three rotations about coordinate axes, in the order that they're applied
+ *
+ *  @headerfile "math/EulerAngles.hpp"
+ */
+template <class T>
+struct EulerAngles
+{
+    Radian<T> first{};
+    Radian<T> second{};
+    Radian<T> third{};
+};
+
+/** The angles of many EulerAngles, one array per angle, in radians
+ *
+ *  Use @c EulerAngleArrays<const T> for read-only input.
+ *
+ *  @note All of the arrays must be the same size
+ *
+ *  @relates EulerAngles
+ */
+template <class T>
+struct EulerAngleArrays
+{
+    std::span<T> first, second, third;
+
+    std::size_t size() const { return first.size(); }
+};
+
+/// The axes of @p order in the order they're applied, 0 for x, 1 for y and 2 for z
+constexpr std::array<unsigned, 3> euler_axes(const EulerOrder order)
+{
+    constexpr std::array<unsigned, 3> axes[] = { { 0, 1, 2 }, { 0, 2, 1 }, { 1, 0, 2 }, { 1, 2, 0 }, { 2, 0, 1 }, { 2, 1, 0 },
+                                                 { 0, 1, 0 }, { 0, 2, 0 }, { 1, 0, 1 }, { 1, 2, 1 }, { 2, 0, 2 }, { 2, 1, 2 } };
+
+    return axes[static_cast<unsigned>( order )];
+}
+
+/// Whether @p order uses its first axis again last
+constexpr bool is_proper_euler(const EulerOrder order)
+{
+    return euler_axes( order )[0] == euler_axes( order )[2];
+}
+
+/** How close, in radians, the middle angle has to be to where the first and third axes line up to count as gimbal lock
+ *
+ *  This is a few ulps, which only catches rotations that are locked up to rounding.  Snapping
+ *  the first angle to zero any further out would lose a real rotation of up to twice this.
+ */
+template <class T>
+constexpr T gimbal_lock_threshold() { return T{4} * std::numeric_limits<T>::epsilon(); }
+
+/** Encodes the rotation by the Euler @p angles
+ *
+ *  @tparam Order  The axes the angles turn about
+ *  @tparam Policy Supplies the trigonometry (see @ref MathPolicies)
+ *
+ *  @post output.isUnit() == true
+ */
+template <EulerOrder Order, class Policy = StandardMath, class T>
+MATHLIB_FORCE_INLINE constexpr Quaternion<T> from_euler(const EulerAngles<T> &angles)
+{
+    // Written as the intrinsic rotation q_i(a) q_j(b) q_k(c), where k is turned about first
+    constexpr unsigned i = euler_axes( Order )[2];
+    constexpr unsigned j = euler_axes( Order )[1];
+    constexpr unsigned k = (i == euler_axes( Order )[0]) ? 3 - i - j : euler_axes( Order )[0];
+    constexpr T        sign = ((j + 3 - i) % 3 == 1) ? T{1} : T{-1}; // Of the permutation (i, j, k)
+
+    T sin_a, cos_a, sin_b, cos_b, sin_c, cos_c;
+
+    Policy::sincos( T{0.5} * angles.third.value(), sin_a, cos_a );
+    Policy::sincos( T{0.5} * angles.second.value(), sin_b, cos_b );
+    Policy::sincos( T{0.5} * angles.first.value(), sin_c, cos_c );
+
+    T components[4];
+
+    if constexpr ( is_proper_euler( Order ) )
+    {
+        components[0]     = cos_b * (cos_a * cos_c - sin_a * sin_c);
+        components[1 + i] = cos_b * (sin_a * cos_c + cos_a * sin_c);
+        components[1 + j] = sin_b * (cos_a * cos_c + sin_a * sin_c);
+        components[1 + k] = sign * sin_b * (sin_a * cos_c - cos_a * sin_c);
+    }
+    else
+    {
+        components[0]     = cos_a * cos_b * cos_c - sign * sin_a * sin_b * sin_c;
+        components[1 + i] = sin_a * cos_b * cos_c + sign * cos_a * sin_b * sin_c;
+        components[1 + j] = cos_a * sin_b * cos_c - sign * sin_a * cos_b * sin_c;
+        components[1 + k] = cos_a * cos_b * sin_c + sign * sin_a * sin_b * cos_c;
+    }
+
+    return Quaternion<T>{ components[0], components[1], components[2], components[3] };
+}
+
+/// @copydoc from_euler(const EulerAngles<T> &)
+template <EulerOrder Order, class Policy = StandardMath, class T>
+constexpr Quaternion<T> from_euler(const Radian<T> first, const Radian<T> second, const Radian<T> third)
+{
+    return from_euler<Order, Policy>( EulerAngles<T>{ first, second, third } );
+}
+
+/** Computes the Euler angles of @p rotation
+ *
+ *  @tparam Order  The axes the angles turn about
+ *  @tparam Policy Supplies the trigonometry (see @ref MathPolicies)
+ *
+ *  @pre @p rotation is a unit Quaternion
+ *
+ *  @note There are no branches that depend on @p rotation, gimbal lock included
+ */
+template <EulerOrder Order, class Policy = StandardMath, class T>
+MATHLIB_FORCE_INLINE constexpr EulerAngles<T> to_euler(const Quaternion<T> &rotation)
+{
+    constexpr unsigned i = euler_axes( Order )[2];
+    constexpr unsigned j = euler_axes( Order )[1];
+    constexpr unsigned k = (i == euler_axes( Order )[0]) ? 3 - i - j : euler_axes( Order )[0];
+    constexpr T        sign = ((j + 3 - i) % 3 == 1) ? T{1} : T{-1};
+    constexpr T        pi = std::numbers::pi_v<T>;
+
+    const T components[4] = { rotation.w(), rotation.i(), rotation.j(), rotation.k() };
+    T       a, b, c, d;
+
+    if constexpr ( is_proper_euler( Order ) )
+    {
+        a = components[0];
+        b = components[1 + i];
+        c = components[1 + j];
+        d = sign * components[1 + k];
+    }
+    else
+    {
+        // q q_j(pi / 2) = q_i(third) q_j(second + pi / 2) q_i(-sign first), which are proper Euler angles (scaled by sqrt(2))
+        a = components[0] - components[1 + j];
+        b = components[1 + i] - sign * components[1 + k];
+        c = components[1 + j] + components[0];
+        d = components[1 + i] + sign * components[1 + k];
+    }
+
+    // a + b i = cos(second / 2) e^(i (third + first) / 2) and c + d i = sin(second / 2) e^(i (third - first) / 2)
+    const T    second{ T{2} * Policy::atan2( Policy::sqrt( c * c + d * d ), Policy::sqrt( a * a + b * b ) ) };
+    const T    half_sum{ Policy::atan2( b, a ) };
+    const T    half_difference{ Policy::atan2( d, c ) };
+    const bool locked_at_zero{ second < gimbal_lock_threshold<T>() };
+    const bool locked_at_pi{ second > pi - gimbal_lock_threshold<T>() };
+    const bool locked{ locked_at_zero || locked_at_pi };
+
+    T third{ fast::select( locked_at_zero, T{2} * half_sum, fast::select( locked_at_pi, T{2} * half_difference, half_sum + half_difference ) ) };
+    T first{ fast::select( locked, T{0}, half_sum - half_difference ) };
+
+    third += fast::select( third > pi, T{-2} * pi, fast::select( third < -pi, T{2} * pi, T{0} ) );
+    first += fast::select( first > pi, T{-2} * pi, fast::select( first < -pi, T{2} * pi, T{0} ) );
+
+    if constexpr ( is_proper_euler( Order ) )
+        return EulerAngles<T>{ Radian<T>{ first }, Radian<T>{ second }, Radian<T>{ third } };
+    else
+        return EulerAngles<T>{ Radian<T>{ -sign * first }, Radian<T>{ second - T{0.5} * pi }, Radian<T>{ third } };
+}
+
+/** Encodes the rotation by each of @p angles
+ *
+ *  @pre @p output has room for as many Quaternions as @p angles
+ */
+template <EulerOrder Order, class Policy = StandardMath, class T>
+void from_euler(std::span<const EulerAngles<T>> angles, std::span<Quaternion<T>> output)
+{
+    assert( output.size() >= angles.size() );
+
+    const std::size_t count = angles.size();
+
+    for (std::size_t n = 0; n < count; ++n)
+        output[n] = from_euler<Order, Policy>( angles[n] );
+}
+
+/** Computes the Euler angles of each of @p rotations
+ *
+ *  @pre @p rotations are unit Quaternions
+ *  @pre @p output has room for as many angles as @p rotations
+ */
+template <EulerOrder Order, class Policy = StandardMath, class T>
+void to_euler(std::span<const Quaternion<T>> rotations, std::span<EulerAngles<T>> output)
+{
+    assert( output.size() >= rotations.size() );
+
+    const std::size_t count = rotations.size();
+
+    for (std::size_t n = 0; n < count; ++n)
+        output[n] = to_euler<Order, Policy>( rotations[n] );
+}
+
+/** Encodes the rotation by each of @p angles, which are stored one array per angle, into @p output
+ *
+ *  @pre @p output has room for as many Quaternions as @p angles
+ *  @pre None of the arrays overlap
+ */
+template <EulerOrder Order, class Policy = StandardMath, class T>
+void from_euler(EulerAngleArrays<const T> angles, QuaternionArrays<T> output)
+{
+    assert( angles.second.size() == angles.size() && angles.third.size() == angles.size() );
+    assert( output.i.size() == output.size() && output.j.size() == output.size() && output.k.size() == output.size() );
+    assert( output.size() >= angles.size() );
+
+    const std::size_t count = angles.size();
+
+    // The arrays are restrict parameters because there are too many pairs of them for compilers to check for overlap at run time
+    auto convert_all = [count](const T * MATHLIB_RESTRICT first,
+                               const T * MATHLIB_RESTRICT second,
+                               const T * MATHLIB_RESTRICT third,
+                               T       * MATHLIB_RESTRICT w,
+                               T       * MATHLIB_RESTRICT i,
+                               T       * MATHLIB_RESTRICT j,
+                               T       * MATHLIB_RESTRICT k)
+        {
+            for (std::size_t n = 0; n < count; ++n)
+            {
+                const Quaternion<T> rotation{ from_euler<Order, Policy>( EulerAngles<T>{ Radian<T>{ first[n] }, Radian<T>{ second[n] }, Radian<T>{ third[n] } } ) };
+
+                w[n] = rotation.w();
+                i[n] = rotation.i();
+                j[n] = rotation.j();
+                k[n] = rotation.k();
+            }
+        };
+
+    convert_all( angles.first.data(), angles.second.data(), angles.third.data(), output.w.data(), output.i.data(), output.j.data(), output.k.data() );
+}
+
+/** Computes the Euler angles of each of @p rotations, which are stored one array per component, into @p output
+ *
+ *  @pre @p rotations are unit Quaternions
+ *  @pre @p output has room for as many angles as @p rotations
+ *  @pre None of the arrays overlap
+ */
+template <EulerOrder Order, class Policy = StandardMath, class T>
+void to_euler(QuaternionArrays<const T> rotations, EulerAngleArrays<T> output)
+{
+    assert( rotations.i.size() == rotations.size() && rotations.j.size() == rotations.size() && rotations.k.size() == rotations.size() );
+    assert( output.second.size() == output.size() && output.third.size() == output.size() );
+    assert( output.size() >= rotations.size() );
+
+    const std::size_t count = rotations.size();
+
+    // The arrays are restrict parameters because there are too many pairs of them for compilers to check for overlap at run time
+    auto convert_all = [count](const T * MATHLIB_RESTRICT w,
+                               const T * MATHLIB_RESTRICT i,
+                               const T * MATHLIB_RESTRICT j,
+                               const T * MATHLIB_RESTRICT k,
+                               T       * MATHLIB_RESTRICT first,
+                               T       * MATHLIB_RESTRICT second,
+                               T       * MATHLIB_RESTRICT third)
+        {
+            for (std::size_t n = 0; n < count; ++n)
+            {
+                const EulerAngles<T> angles{ to_euler<Order, Policy>( Quaternion<T>{ w[n], i[n], j[n], k[n] } ) };
+
+                first[n]  = angles.first.value();
+                second[n] = angles.second.value();
+                third[n]  = angles.third.value();
+            }
+        };
+
+    convert_all( rotations.w.data(), rotations.i.data(), rotations.j.data(), rotations.k.data(), output.first.data(), output.second.data(), output.third.data() );
+}
+/// @}  {EulerAngles}
+
+
+/** @name Type Aliases
+ *
+ *  @relates EulerAngles
+ *
+ *  @{
+ */
+using EulerAnglesf = EulerAngles<float>;
+using EulerAnglesd = EulerAngles<double>;
+/// @}
+
+}
\ No newline at end of file
@@ -0,0 +1,483 @@
+#pragma once
+
+#include "math/ConstexprMath.hpp"
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <span>
+#include <type_traits>
+
+#if defined(_MSC_VER)
+#define MATHLIB_FORCE_INLINE __forceinline
+#define MATHLIB_RESTRICT     __restrict
+#elif defined(__GNUC__)
+#define MATHLIB_FORCE_INLINE [[gnu::always_inline]] inline
+#define MATHLIB_RESTRICT     __restrict__
+#else
+#define MATHLIB_FORCE_INLINE inline
+#define MATHLIB_RESTRICT
+#endif
+
+/** @file
+ *
+ *  Contains approximations of the elementary functions and the policies for choosing
+ *  between them and the standard library
+ *
+ *  @hideincludegraph
+ */
+
+namespace Math
+{
+
+/** @addtogroup MathPolicies Math Policies
+ *
+ *  Functions that spend most of their time in trigonometry take a policy as their first
+ *  template parameter, which supplies @c sin, @c cos, @c sincos, @c acos, @c atan2,
+ *  @c sqrt and @c rsqrt.  It defaults to StandardMath, so only the call sites that
+ *  opt in trade precision for speed:
+ *
+ *  @code
+ *  auto q = Quaternionf::make_rotation<fast::MediumPrecision>( angle, axis );
+ *  auto s = unnormalized_sinc<fast::LowPrecision>( x );
+ *  @endcode
+ *
+ *  @{
+ */
+
+/** The policy that calls the standard library
+ *
+ *  In constant expressions, where the standard library can't be called, it calls the
+ *  versions in Math::compile_time instead, so everything built on it can be evaluated
+ *  at compile time.
+ *
+ *  @note The calls are unqualified so that overloads for other number types
+ *        are found by argument-dependent lookup
+ */
+struct StandardMath
+{
+    template <class T>
+    constexpr static T sin(const T radians)
+    {
+        if constexpr ( std::is_floating_point_v<T> )
+        {
+            if ( std::is_constant_evaluated() )
+                return compile_time::sin( radians );
+        }
+        using std::sin;
+        return sin( radians );
+    }
+
+    template <class T>
+    constexpr static T cos(const T radians)
+    {
+        if constexpr ( std::is_floating_point_v<T> )
+        {
+            if ( std::is_constant_evaluated() )
+                return compile_time::cos( radians );
+        }
+        using std::cos;
+        return cos( radians );
+    }
+
+    /// Both at once, which compilers usually combine into a single call
+    template <class T>
+    constexpr static void sincos(const T radians, T &sine, T &cosine)
+    {
+        if constexpr ( std::is_floating_point_v<T> )
+        {
+            if ( std::is_constant_evaluated() )
+                return compile_time::sincos( radians, sine, cosine );
+        }
+        using std::sin;
+        using std::cos;
+
+        sine   = sin( radians );
+        cosine = cos( radians );
+    }
+
+    template <class T>
+    constexpr static T acos(const T value)
+    {
+        if constexpr ( std::is_floating_point_v<T> )
+        {
+            if ( std::is_constant_evaluated() )
+                return compile_time::acos( value );
+        }
+        using std::acos;
+        return acos( value );
+    }
+
+    template <class T>
+    constexpr static T atan2(const T y, const T x)
+    {
+        if constexpr ( std::is_floating_point_v<T> )
+        {
+            if ( std::is_constant_evaluated() )
+                return compile_time::atan2( y, x );
+        }
+        using std::atan2;
+        return atan2( y, x );
+    }
+
+    template <class T>
+    constexpr static T sqrt(const T value)
+    {
+        if constexpr ( std::is_floating_point_v<T> )
+        {
+            if ( std::is_constant_evaluated() )
+                return compile_time::sqrt( value );
+        }
+        using std::sqrt;
+        return sqrt( value );
+    }
+
+    template <class T>
+    constexpr static T rsqrt(const T value) { return T{1} / sqrt( value ); }
+};
+/// @}  {MathPolicies}
+
+
+/** Approximations of the elementary functions
+ *
+ *  Every function is a short minimax polynomial that is forced inline and has no
+ *  data-dependent branches: quadrants are rounded with an integer conversion rather than
+ *  @c std::floor, square roots come from rsqrt() rather than @c std::sqrt, which can set
+ *  @c errno, and choices between values go through select().  So loops that call them,
+ *  the span versions included, vectorize with the default floating-point flags (checked
+ *  with GCC 12 at @c -O3).  Each one comes in three precision tiers, with these maximum
+ *  absolute errors (before rounding to the type used):
+ *
+ *  | Precision | sin, cos | acos   | atan2  | rsqrt (relative) |
+ *  | --------- | -------- | ------ | ------ | ---------------- |
+ *  | Low       | 2e-3     | 4e-4   | 7e-4   | 2e-3             |
+ *  | Medium    | 1e-5     | 5e-6   | 2e-5   | 5e-6             |
+ *  | High      | 3e-8     | 2e-8   | 4e-8   | float precision  |
+ *
+ *  High is as good as the standard library for @c float, but not for @c double.
+ *
+ *  The span versions apply the scalar versions to each element.
+ */
+namespace fast
+{
+
+enum class Precision
+{
+    Low,
+    Medium,
+    High
+};
+
+/** The polynomial coefficients for each precision, lowest power first
+ *
+ *  - sine:        @f$ \sin r \approx r P(r^2) @f$ for @f$ |r| \le \frac{\pi}{4} @f$
+ *  - cosine:      @f$ \cos r \approx P(r^2) @f$ for @f$ |r| \le \frac{\pi}{4} @f$
+ *  - arc_cosine:  @f$ \arccos x \approx \sqrt{1 - x} P(x) @f$ for @f$ 0 \le x \le 1 @f$
+ *  - arc_tangent: @f$ \arctan x \approx x P(x^2) @f$ for @f$ 0 \le x \le 1 @f$
+ */
+template <Precision P>
+struct Coefficients;
+
+template <>
+struct Coefficients<Precision::Low>
+{
+    static constexpr std::array<double, 2> sine{ 0.9990314020597697, -0.1603439488462249 };
+    static constexpr std::array<double, 2> cosine{ 0.9980784595331589, -0.47482033882985636 };
+    static constexpr std::array<double, 3> arc_cosine{ 1.5704703010513053, -0.20549776445464515, 0.05138976426850042 };
+    static constexpr std::array<double, 3> arc_tangent{ 0.995357881713598, -0.2886898244369762, 0.07933861332682648 };
+    static constexpr int newton_steps = 1;
+};
+
+template <>
+struct Coefficients<Precision::Medium>
+{
+    static constexpr std::array<double, 3> sine{ 0.9999949974615102, -0.16660161901482962, 0.008121556516145103 };
+    static constexpr std::array<double, 3> cosine{ 0.99999003470346, -0.49970813532788, 0.040398525027819175 };
+    static constexpr std::array<double, 5> arc_cosine{ 1.5707915346974382, -0.21428062285367203, 0.08563842932571938,
+                                                       -0.037618297536703045, 0.00973301015601423 };
+    static constexpr std::array<double, 5> arc_tangent{ 0.9998663280717037, -0.33030476208889004, 0.1801591929555848,
+                                                        -0.08515619206840812, 0.020845033300695093 };
+    static constexpr int newton_steps = 2;
+};
+
+template <>
+struct Coefficients<Precision::High>
+{
+    static constexpr std::array<double, 4> sine{ 0.9999999861791167, -0.16666636753933695, 0.008331584592240631, -0.00019462115457014677 };
+    static constexpr std::array<double, 4> cosine{ 0.9999999724227878, -0.4999985669367749, 0.04165502676580999, -0.0013585906967043184 };
+    static constexpr std::array<double, 8> arc_cosine{ 1.570796314320702, -0.2145998925257667, 0.08899926594228086, -0.05031279041053939,
+                                                       0.031335486928540095, -0.017809008589716537, 0.007245466056074165, -0.0014414851542896012 };
+    static constexpr std::array<double, 8> arc_tangent{ 0.9999993355738209, -0.3332986076464698, 0.19946565408303193, -0.1390862824801605,
+                                                        0.09642193791278764, -0.05591227583130978, 0.021862920822603507, -0.004054556507487627 };
+    static constexpr int newton_steps = 3;
+};
+
+/** Returns @p if_true or @p if_false without a branch
+ *
+ *  A ternary on @c float or @c double is often turned back into a branch, which stops the
+ *  loop around it from being vectorized, so those pick the bits with a mask instead.
+ */
+template <class T>
+MATHLIB_FORCE_INLINE constexpr T select(const bool condition, const T if_true, const T if_false)
+{
+    if constexpr ( std::is_same_v<T, float> || std::is_same_v<T, double> )
+    {
+        using Bits = std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+
+        const Bits mask{ Bits{0} - static_cast<Bits>( condition ) };
+
+        return std::bit_cast<T>( (std::bit_cast<Bits>( if_true ) & mask) | (std::bit_cast<Bits>( if_false ) & ~mask) );
+    }
+    else
+        return condition ? if_true : if_false;
+}
+
+/// Evaluates the polynomial with the given @p coefficients (lowest power first) at @p x
+template <class T, std::size_t N>
+MATHLIB_FORCE_INLINE constexpr T polynomial(const T x, const std::array<double, N> &coefficients)
+{
+    T result{ static_cast<T>( coefficients[N - 1] ) };
+
+    for (std::size_t i = N - 1; i-- > 0;)
+        result = result * x + static_cast<T>( coefficients[i] );
+    return result;
+}
+
+/** Computes the sine and cosine of the same angle with one range reduction
+ *
+ *  The angle is reduced to within @f$ \frac{\pi}{4} @f$ of a multiple of
+ *  @f$ \frac{\pi}{2} @f$ by subtracting that multiple in three parts (Cody-Waite), which
+ *  keeps the error within the tier's bound for angles up to about @f$ 10^4 @f$ radians.
+ */
+template <Precision P = Precision::Medium, class T>
+MATHLIB_FORCE_INLINE void sincos(const T radians, T &sine, T &cosine)
+{
+    using C = Coefficients<P>;
+
+    // Rounded to the nearest quadrant by a conversion that truncates, rather than by std::floor()
+    const std::int32_t quadrant_index{ static_cast<std::int32_t>( radians * std::numbers::inv_pi_v<T> * T{2} + ((radians < T{0}) ? T{-0.5} : T{0.5}) ) };
+    const T            quadrant{ static_cast<T>( quadrant_index ) };
+    const T r{ ((radians - quadrant * T{1.5703125}) - quadrant * T{4.837512969970703125e-4}) - quadrant * T{7.54978995489188216e-8} };
+    const T r_squared{ r * r };
+    const T s{ r * polynomial( r_squared, C::sine ) };
+    const T c{ polynomial( r_squared, C::cosine ) };
+    const std::int32_t q{ quadrant_index & 3 };
+
+    // Rotate by the quadrant: swap in odd quadrants, negate the sine in quadrants 2 and 3 and the cosine in 1 and 2.
+    // Multiplying by 0, 1 and -1 is exact and, unlike select(), needs no integer of the same width as T.
+    const T odd{ static_cast<T>( q & 1 ) };
+    const T even{ T{1} - odd };
+
+    sine   = static_cast<T>( 1 - (q & 2) ) * (s * even + c * odd);
+    cosine = static_cast<T>( 1 - ((q + 1) & 2) ) * (c * even + s * odd);
+}
+
+template <Precision P = Precision::Medium, class T>
+MATHLIB_FORCE_INLINE T sin(const T radians)
+{
+    T sine, cosine;
+
+    sincos<P>( radians, sine, cosine );
+    return sine;
+}
+
+template <Precision P = Precision::Medium, class T>
+MATHLIB_FORCE_INLINE T cos(const T radians)
+{
+    T sine, cosine;
+
+    sincos<P>( radians, sine, cosine );
+    return cosine;
+}
+
+/// Follows the same quadrant and signed zero conventions as @c std::atan2
+template <Precision P = Precision::Medium, class T>
+MATHLIB_FORCE_INLINE T atan2(const T y, const T x)
+{
+    const T abs_x{ std::abs( x ) };
+    const T abs_y{ std::abs( y ) };
+    const T larger{ select( abs_y > abs_x, abs_y, abs_x ) };
+    const T smaller{ select( abs_y > abs_x, abs_x, abs_y ) };
+    const T ratio{ smaller / select( larger > T{0}, larger, T{1} ) };
+    const T first_octant{ ratio * polynomial( ratio * ratio, Coefficients<P>::arc_tangent ) };
+    const T first_quadrant{ select( abs_y > abs_x, std::numbers::pi_v<T> / T{2} - first_octant, first_octant ) };
+    const T upper_half{ select( std::copysign( T{1}, x ) < T{0}, std::numbers::pi_v<T> - first_quadrant, first_quadrant ) };
+
+    return std::copysign( upper_half, y );
+}
+
+/** Computes @f$ \frac{1}{\sqrt{x}} @f$ from a bit-level first guess refined by Newton's method
+ *
+ *  @pre @p value > 0
+ *
+ *  @note Types other than @c float and @c double fall back to the standard library
+ */
+template <Precision P = Precision::Medium, class T>
+MATHLIB_FORCE_INLINE T rsqrt(const T value)
+{
+    T estimate;
+
+    if constexpr ( std::is_same_v<T, float> )
+        estimate = std::bit_cast<float>( std::uint32_t{0x5F375A86} - (std::bit_cast<std::uint32_t>( value ) >> 1) );
+    else if constexpr ( std::is_same_v<T, double> )
+        estimate = std::bit_cast<double>( std::uint64_t{0x5FE6EB50C7B537A9} - (std::bit_cast<std::uint64_t>( value ) >> 1) );
+    else
+        return T{1} / std::sqrt( value );
+
+    const T half_value{ T{0.5} * value };
+
+    for (int step = 0; step < Coefficients<P>::newton_steps; ++step)
+        estimate = estimate * (T{1.5} - half_value * estimate * estimate);
+    return estimate;
+}
+
+/** Computes @f$ \sqrt{x} @f$ as @f$ x \frac{1}{\sqrt{x}} @f$
+ *
+ *  @pre @p value >= 0
+ */
+template <Precision P = Precision::Medium, class T>
+MATHLIB_FORCE_INLINE T sqrt(const T value)
+{
+    // Newton's method overflows from the first guess for zero, so that takes the reciprocal square root of the smallest normal instead
+    constexpr T smallest = std::numeric_limits<T>::min();
+
+    return value * rsqrt<P>( select( value > smallest, value, smallest ) );
+}
+
+/** @pre -1 <= @p value <= 1
+ *
+ *  @note The square root is fast::sqrt() one tier up, which is well within the error of
+ *        the polynomial and, unlike @c std::sqrt, never sets @c errno
+ */
+template <Precision P = Precision::Medium, class T>
+MATHLIB_FORCE_INLINE T acos(const T value)
+{
+    constexpr Precision root_precision = (P == Precision::Low) ? Precision::Medium : Precision::High;
+
+    const T magnitude{ std::abs( value ) };
+    const T one_minus{ T{1} - magnitude };
+    const T result{ sqrt<root_precision>( select( one_minus > T{0}, one_minus, T{0} ) ) * polynomial( magnitude, Coefficients<P>::arc_cosine ) };
+
+    return select( value < T{0}, std::numbers::pi_v<T> - result, result );
+}
+
+/** @name Span Versions
+ *
+ *  @pre The outputs have room for as many values as the inputs
+ *
+ *  @{
+ */
+template <Precision P = Precision::Medium, class T>
+void sincos(std::span<const T> radians, std::span<T> sines, std::span<T> cosines)
+{
+    assert( sines.size() >= radians.size() && cosines.size() >= radians.size() );
+
+    const std::size_t count = radians.size();
+
+    for (std::size_t i = 0; i < count; ++i)
+        sincos<P>( radians[i], sines[i], cosines[i] );
+}
+
+template <Precision P = Precision::Medium, class T>
+void sin(std::span<const T> radians, std::span<T> output)
+{
+    assert( output.size() >= radians.size() );
+
+    const std::size_t count = radians.size();
+
+    for (std::size_t i = 0; i < count; ++i)
+        output[i] = sin<P>( radians[i] );
+}
+
+template <Precision P = Precision::Medium, class T>
+void cos(std::span<const T> radians, std::span<T> output)
+{
+    assert( output.size() >= radians.size() );
+
+    const std::size_t count = radians.size();
+
+    for (std::size_t i = 0; i < count; ++i)
+        output[i] = cos<P>( radians[i] );
+}
+
+template <Precision P = Precision::Medium, class T>
+void acos(std::span<const T> values, std::span<T> output)
+{
+    assert( output.size() >= values.size() );
+
+    const std::size_t count = values.size();
+
+    for (std::size_t i = 0; i < count; ++i)
+        output[i] = acos<P>( values[i] );
+}
+
+template <Precision P = Precision::Medium, class T>
+void atan2(std::span<const T> y, std::span<const T> x, std::span<T> output)
+{
+    assert( x.size() == y.size() && output.size() >= y.size() );
+
+    const std::size_t count = y.size();
+
+    for (std::size_t i = 0; i < count; ++i)
+        output[i] = atan2<P>( y[i], x[i] );
+}
+
+template <Precision P = Precision::Medium, class T>
+void rsqrt(std::span<const T> values, std::span<T> output)
+{
+    assert( output.size() >= values.size() );
+
+    const std::size_t count = values.size();
+
+    for (std::size_t i = 0; i < count; ++i)
+        output[i] = rsqrt<P>( values[i] );
+}
+/// @}
+
+/** The policy that calls the approximations in this namespace
+ *
+ *  @ingroup MathPolicies
+ */
+template <Precision P>
+struct ApproximateMath
+{
+    template <class T>
+    MATHLIB_FORCE_INLINE static T sin(const T radians) { return fast::sin<P>( radians ); }
+
+    template <class T>
+    MATHLIB_FORCE_INLINE static T cos(const T radians) { return fast::cos<P>( radians ); }
+
+    template <class T>
+    MATHLIB_FORCE_INLINE static void sincos(const T radians, T &sine, T &cosine) { fast::sincos<P>( radians, sine, cosine ); }
+
+    template <class T>
+    MATHLIB_FORCE_INLINE static T acos(const T value) { return fast::acos<P>( value ); }
+
+    template <class T>
+    MATHLIB_FORCE_INLINE static T atan2(const T y, const T x) { return fast::atan2<P>( y, x ); }
+
+    template <class T>
+    MATHLIB_FORCE_INLINE static T sqrt(const T value) { return fast::sqrt<P>( value ); }
+
+    template <class T>
+    MATHLIB_FORCE_INLINE static T rsqrt(const T value) { return fast::rsqrt<P>( value ); }
+};
+
+/** @name Policies
+ *
+ *  @relates ApproximateMath
+ *
+ *  @{
+ */
+using LowPrecision    = ApproximateMath<Precision::Low>;
+using MediumPrecision = ApproximateMath<Precision::Medium>;
+using HighPrecision   = ApproximateMath<Precision::High>;
+/// @}
+
+}
+
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "math/ApproximatelyEqualTo.hpp"
+#include "math/ScalarTraits.hpp"
 #include "math/Normalized.hpp"
 #include "math/Conversions.hpp"
 #include "math/Exponential.hpp"
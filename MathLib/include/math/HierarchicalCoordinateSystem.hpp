@@ -1,7 +1,12 @@
 #pragma once
 
 #include "math/SceneNode.hpp"
+#include <cstdint>
 #include <memory>
+#include <optional>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 
 /** @file
@@ -27,8 +32,150 @@ public:
 
     const SceneNode<Type> &root() const { return *_root_node; }
           SceneNode<Type> &root()       { return *_root_node; }
+
+    /** @name Lookup
+     *  @{
+     */
+    /** Finds a node in the hierarchy by its name
+     *
+     *  @param name The name of the node to look for
+     *
+     *  @return The first node registered with that name, or @c nullptr if there is none
+     *
+     *  @note Renaming or re-attaching a node registers it again, after the nodes that are
+     *        already registered
+     *  @note This is a hash lookup and does not traverse the hierarchy
+     */
+    std::shared_ptr<SceneNode<Type>> findNode(std::string_view name) const
+    {
+        SceneNode<Type> *found = _root_node->registry().findFirst( name );
+
+        return found ? found->shared_from_this() : nullptr;
+    }
+
+    /** Finds all the nodes in the hierarchy with the given name
+     *
+     *  @param name The name of the nodes to look for
+     *
+     *  @return The matching nodes, in the order they were created
+     */
+    SceneNodeList<Type> findNodes(std::string_view name) const
+    {
+        SceneNodeList<Type> found;
+
+        for (SceneNode<Type> *node : _root_node->registry().find( name ))
+            found.push_back( node->shared_from_this() );
+        return found;
+    }
+
+    /** Finds a node by its path from the root of the hierarchy
+     *
+     *  @param path The names of the nodes to go through separated by '/', e.g. "root/arm/hand"
+     *
+     *  @return The node at the end of the path, or @c nullptr if there is none
+     *
+     *  @note The root node itself is not part of the path and empty path components
+     *        are ignored, so "/arm/hand/" is the same as "arm/hand".
+     *  @note The last component is looked up by name and the candidates are then
+     *        verified by walking up their parents, so the cost depends on the depth
+     *        of the path rather than the size of the hierarchy.
+     */
+    std::shared_ptr<SceneNode<Type>> findPath(std::string_view path) const
+    {
+        while ( !path.empty() && path.back() == '/' )
+            path.remove_suffix( 1 );
+
+        if ( path.find_first_not_of( '/' ) == std::string_view::npos )
+            return _root_node;
+
+        std::string_view leaf_name{ path.substr( path.find_last_of( '/' ) + 1 ) };
+
+        for (SceneNode<Type> *candidate : _root_node->registry().find( leaf_name ))
+        {
+            if ( matchesPath( *candidate, path ) )
+                return candidate->shared_from_this();
+        }
+        return nullptr;
+    }
+    /// @}
+
+    /** @name Traversal
+     *  @{
+     */
+    /** Visits every node in depth-first pre-order, starting with the root
+     *
+     *  @param visitor Called as @c visitor(node, index, parent_index) for every node.
+     *                 @c index counts the nodes in visiting order, starting with 0 for the root,
+     *                 and @c parent_index is -1 for the root.
+     *
+     *  @note Parents are always visited before their children, and the children of a node
+     *        are visited in order.  This is the order used to identify nodes in snapshots
+     *        and delta streams.
+     *  @note The hierarchy must not be restructured while it is being visited.
+     */
+    template <class Visitor>
+    void visitPreOrder(Visitor &&visitor) const
+    {
+        visitPreOrder( static_cast<const SceneNode<Type> &>( *_root_node ), visitor );
+    }
+
+    template <class Visitor>
+    void visitPreOrder(Visitor &&visitor)
+    {
+        visitPreOrder( *_root_node, visitor );
+    }
+    /// @}
+
+    /// The version of the most recent change to the hierarchy
+    std::uint64_t version() const { return _root_node->registry().version(); }
 private:
     std::shared_ptr<SceneNode<Type>> _root_node;
+
+    template <class Node, class Visitor>
+    static void visitPreOrder(Node &root, Visitor &visitor)
+    {
+        std::vector<std::pair<Node *, std::int32_t>> to_visit{ { &root, -1 } };
+        std::int32_t                                 index = 0;
+
+        while ( !to_visit.empty() )
+        {
+            auto [node, parent_index] = to_visit.back();
+
+            to_visit.pop_back();
+            visitor( *node, index, parent_index );
+
+            // Reverse so that the children come out in order
+            for (auto child = node->children().rbegin(); child != node->children().rend(); ++child)
+                to_visit.emplace_back( child->get(), index );
+            ++index;
+        }
+    }
+
+    /** Checks that the ancestors of @p node are named by the components of @p path, leaf first */
+    bool matchesPath(const SceneNode<Type> &node, std::string_view path) const
+    {
+        std::shared_ptr<const SceneNode<Type>> current{ node.shared_from_this() };
+
+        while ( !path.empty() )
+        {
+            std::size_t      separator{ path.find_last_of( '/' ) };
+            std::string_view component{ (separator == std::string_view::npos) ? path : path.substr( separator + 1 ) };
+
+            path = (separator == std::string_view::npos) ? std::string_view{} : path.substr( 0, separator );
+
+            if ( component.empty() )
+                continue; // Repeated separators
+
+            std::optional<typename SceneNode<Type>::NameId> component_id{ _root_node->registry().idOf( component ) };
+
+            if ( !component_id || !current || current == _root_node || current->nameId() != *component_id )
+                return false;
+
+            current = current->parent().lock();
+        }
+
+        return current == _root_node;
+    }
 };
 
 
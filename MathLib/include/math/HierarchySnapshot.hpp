@@ -0,0 +1,552 @@
+#pragma once
+
+#include "math/HierarchicalCoordinateSystem.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define MATHLIB_HAS_MMAP 1
+#else
+#define MATHLIB_HAS_MMAP 0
+#endif
+
+
+/** @file
+ *
+ *  Contains a compact binary snapshot format for a HierarchicalCoordinateSystem
+ *  along with the classes for writing and reading it in place
+ *
+ *  The layout of a snapshot is:
+ *
+ *  | Section      | Contents                                                       |
+ *  | ------------ | -------------------------------------------------------------- |
+ *  | header       | HierarchySnapshotHeader                                         |
+ *  | transforms   | 8 scalars per node: real w, i, j, k then dual w, i, j, k        |
+ *  | parents      | int32 per node, the index of the parent node or -1 for the root |
+ *  | name ids     | uint32 per node, the index of its name in the name table        |
+ *  | name offsets | uint32 per name + 1, the start of each name in the name data    |
+ *  | name data    | The characters of all the names, back to back                   |
+ *
+ *  Nodes are stored in depth-first pre-order starting with the root, so a parent
+ *  always comes before its children.  Every section starts on a 16-byte boundary,
+ *  which means that a memory-mapped snapshot can be read in place.
+ *
+ *  @note Snapshots use the byte order and scalar type of the machine that wrote them
+ *        and are rejected when those don't match.
+ *
+ *  @hideincludegraph
+ */
+
+/** The fixed-size header at the start of every snapshot
+ *
+ *  @headerfile "math/HierarchySnapshot.hpp"
+ */
+struct HierarchySnapshotHeader
+{
+    constexpr static std::uint32_t expected_magic      = 0x53484c4d; // "MLHS"
+    constexpr static std::uint32_t expected_version    = 1;
+    constexpr static std::uint32_t expected_byte_order = 0x01020304;
+
+    std::uint32_t magic       = expected_magic;
+    std::uint32_t version     = expected_version;
+    std::uint32_t byte_order  = expected_byte_order;
+    std::uint32_t scalar_size = 0;
+    std::uint32_t node_count  = 0;
+    std::uint32_t name_count  = 0;
+    std::uint64_t transforms_offset   = 0;
+    std::uint64_t parents_offset      = 0;
+    std::uint64_t name_ids_offset     = 0;
+    std::uint64_t name_offsets_offset = 0;
+    std::uint64_t name_data_offset    = 0;
+    std::uint64_t total_size          = 0;
+};
+
+
+/** Read-only view of a snapshot that lives in a block of memory
+ *
+ *  This does not copy or allocate anything.  All the accessors read directly from
+ *  the underlying bytes, which makes it suitable for use on a memory-mapped file.
+ *
+ *  @headerfile "math/HierarchySnapshot.hpp"
+ *
+ *  @see MappedHierarchySnapshot
+ */
+template <class Type>
+class HierarchySnapshotView
+{
+public:
+    HierarchySnapshotView() = default;
+
+    /** Validates and wraps the given bytes
+     *
+     *  @param bytes The snapshot.  Must be aligned to at least 16 bytes and outlive the view.
+     *
+     *  @return The view, or @c std::nullopt if @p bytes does not hold a valid snapshot for @c Type
+     *
+     *  @note Besides the sizes of the sections, this checks every parent index, name id and
+     *        name offset, in one pass over them, so the accessors can't read outside of
+     *        @p bytes even when the file is corrupt.
+     */
+    static std::optional<HierarchySnapshotView<Type>> make(std::span<const std::byte> bytes)
+    {
+        std::optional<HierarchySnapshotView<Type>> view{ makeTrusted( bytes ) };
+
+        if ( !view )
+            return std::nullopt;
+
+        const HierarchySnapshotHeader &header = view->_header;
+
+        // Names have to lie within the name data, which the last offset was checked against
+        for (std::uint32_t name_index = 0; name_index < header.name_count; ++name_index)
+        {
+            if ( view->_name_offsets[name_index] > view->_name_offsets[name_index + 1] )
+                return std::nullopt;
+        }
+
+        // Only the first node is a root, and every other parent comes before its child
+        for (std::uint32_t index = 0; index < header.node_count; ++index)
+        {
+            const std::int32_t parent_index{ view->_parents[index] };
+            const bool         valid_parent{ (index == 0) ? parent_index == -1 : (parent_index >= 0 && static_cast<std::uint32_t>( parent_index ) < index) };
+
+            if ( !valid_parent || view->_name_ids[index] >= header.name_count )
+                return std::nullopt;
+        }
+
+        return view;
+    }
+
+    /** Wraps the given bytes, only checking the header and the sizes of the sections
+     *
+     *  This takes the same time no matter how many nodes are in the snapshot.
+     *
+     *  @param bytes The snapshot.  Must be aligned to at least 16 bytes and outlive the view.
+     *
+     *  @return The view, or @c std::nullopt if the header or the sections of @p bytes are not valid for @c Type
+     *
+     *  @warning The parent indices, name ids and name offsets are not checked, so only use
+     *           this on snapshots that are known to be good, such as ones that this program
+     *           wrote itself.  Use make() for anything else.
+     */
+    static std::optional<HierarchySnapshotView<Type>> makeTrusted(std::span<const std::byte> bytes)
+    {
+        HierarchySnapshotHeader header;
+
+        if ( bytes.size() < sizeof(header) )
+            return std::nullopt;
+
+        std::memcpy( &header, bytes.data(), sizeof(header) );
+
+        if ( header.magic       != HierarchySnapshotHeader::expected_magic      ||
+             header.version     != HierarchySnapshotHeader::expected_version    ||
+             header.byte_order  != HierarchySnapshotHeader::expected_byte_order ||
+             header.scalar_size != sizeof(Type)                                 ||
+             header.total_size  != bytes.size() )
+            return std::nullopt;
+
+        if ( (reinterpret_cast<std::uintptr_t>( bytes.data() ) % alignof(Type)) != 0 )
+            return std::nullopt;
+
+        auto section_fits = [&](std::uint64_t offset, std::uint64_t count, std::uint64_t element_size)
+        {
+            return offset % element_size == 0 && offset <= bytes.size() && count <= (bytes.size() - offset) / element_size;
+        };
+
+        if ( !section_fits( header.transforms_offset,   std::uint64_t{8} * header.node_count, sizeof(Type) )          ||
+             !section_fits( header.parents_offset,      header.node_count,                     sizeof(std::int32_t) )  ||
+             !section_fits( header.name_ids_offset,     header.node_count,                     sizeof(std::uint32_t) ) ||
+             !section_fits( header.name_offsets_offset, std::uint64_t{header.name_count} + 1,  sizeof(std::uint32_t) ) )
+            return std::nullopt;
+
+        HierarchySnapshotView<Type> view;
+
+        view._header       = header;
+        view._transforms   = reinterpret_cast<const Type *>( bytes.data() + header.transforms_offset );
+        view._parents      = reinterpret_cast<const std::int32_t *>( bytes.data() + header.parents_offset );
+        view._name_ids     = reinterpret_cast<const std::uint32_t *>( bytes.data() + header.name_ids_offset );
+        view._name_offsets = reinterpret_cast<const std::uint32_t *>( bytes.data() + header.name_offsets_offset );
+        view._name_data    = reinterpret_cast<const char *>( bytes.data() + header.name_data_offset );
+
+        if ( !section_fits( header.name_data_offset, view._name_offsets[header.name_count], 1 ) )
+            return std::nullopt;
+
+        return view;
+    }
+
+    /// The number of nodes, including the root
+    std::size_t size() const { return _header.node_count; }
+
+    /// The number of distinct names
+    std::size_t nameCount() const { return _header.name_count; }
+
+    /** The index of the parent of node @p index
+     *
+     *  @return The parent index, which is always less than @p index, or -1 for the root
+     */
+    std::int32_t parent(std::size_t index) const
+    {
+        assert( index < size() );
+
+        return _parents[index];
+    }
+
+    /// The local transform of node @p index
+    Math::DualQuaternion<Type> transform(std::size_t index) const
+    {
+        assert( index < size() );
+
+        const Type *t = _transforms + 8 * index;
+
+        return Math::DualQuaternion<Type>{ Math::Quaternion<Type>{ t[0], t[1], t[2], t[3] },
+                                           Math::Quaternion<Type>{ t[4], t[5], t[6], t[7] } };
+    }
+
+    /// The name of node @p index
+    std::string_view name(std::size_t index) const
+    {
+        assert( index < size() );
+
+        return tableName( _name_ids[index] );
+    }
+
+    /// The name at @p name_index of the name table
+    std::string_view tableName(std::size_t name_index) const
+    {
+        assert( name_index < nameCount() );
+
+        return { _name_data + _name_offsets[name_index], _name_offsets[name_index + 1] - _name_offsets[name_index] };
+    }
+
+    /** Computes the transform of every node relative to the root's parent
+     *
+     *  @param output Receives one transform per node, in the same order as the snapshot
+     *
+     *  @note This is a single pass over the nodes because parents always come before their children
+     */
+    void worldTransforms(std::span<Math::DualQuaternion<Type>> output) const
+    {
+        assert( output.size() >= size() );
+
+        for (std::size_t i = 0; i < size(); ++i)
+        {
+            std::int32_t parent_index = parent( i );
+
+            output[i] = (parent_index < 0) ? transform( i ) : output[parent_index] * transform( i );
+        }
+    }
+
+    /** Recreates the snapshot as SceneNodes under the root of @p destination
+     *
+     *  @param destination The hierarchy to build into.  Its root takes the root transform and name of the snapshot.
+     *
+     *  @note Only needed when a live, editable hierarchy is wanted.  Read-only uses can work directly on the view.
+     */
+    void instantiate(HierarchicalCoordinateSystem<Type> &destination) const
+    {
+        if ( size() == 0 )
+            return;
+
+        std::vector<SceneNode<Type> *> nodes( size() );
+
+        nodes[0] = &destination.root();
+        nodes[0]->setCoordinateSystem( transform( 0 ) );
+        nodes[0]->setName( name( 0 ) );
+
+        for (std::size_t i = 1; i < size(); ++i)
+        {
+            std::int32_t parent_index = parent( i );
+
+            assert( parent_index >= 0 && static_cast<std::size_t>(parent_index) < i );
+
+            std::shared_ptr<SceneNode<Type>> new_node{ nodes[parent_index]->createChildNode( Math::Vector3D<Type>::zero(), Math::Quaternion<Type>::identity(), name( i ) ) };
+
+            new_node->setCoordinateSystem( transform( i ) );
+            nodes[i] = new_node.get();
+        }
+    }
+private:
+    HierarchySnapshotHeader _header;
+    const Type          *_transforms   = nullptr;
+    const std::int32_t  *_parents      = nullptr;
+    const std::uint32_t *_name_ids     = nullptr;
+    const std::uint32_t *_name_offsets = nullptr;
+    const char          *_name_data    = nullptr;
+};
+
+
+/** Creates a snapshot of a whole hierarchy
+ *
+ *  @param hierarchy The hierarchy to capture
+ *
+ *  @return The bytes of the snapshot
+ *
+ *  @relates HierarchySnapshotView
+ */
+template <class Type>
+std::vector<std::byte> make_hierarchy_snapshot(const HierarchicalCoordinateSystem<Type> &hierarchy)
+{
+    constexpr std::uint64_t section_alignment = 16;
+    constexpr std::uint32_t unused            = std::numeric_limits<std::uint32_t>::max();
+
+    auto align = [](std::uint64_t offset) { return (offset + section_alignment - 1) / section_alignment * section_alignment; };
+
+    // Flatten the tree in pre-order, only keeping the names that are actually used
+    const SceneNodeRegistry<Type>        &registry{ hierarchy.root().registry() };
+    std::vector<const SceneNode<Type> *> nodes;
+    std::vector<std::int32_t>            parents;
+    std::vector<std::uint32_t>           name_ids;
+    std::vector<std::uint32_t>           snapshot_name_ids( registry.nameIdLimit(), unused );
+    std::vector<std::string_view>        names;
+
+    hierarchy.visitPreOrder( [&](const SceneNode<Type> &node, std::int32_t, std::int32_t parent_index)
+        {
+            std::uint32_t &snapshot_name_id{ snapshot_name_ids[node.nameId()] };
+
+            if ( snapshot_name_id == unused )
+            {
+                snapshot_name_id = static_cast<std::uint32_t>( names.size() );
+                names.push_back( node.name() );
+            }
+
+            nodes.push_back( &node );
+            parents.push_back( parent_index );
+            name_ids.push_back( snapshot_name_id );
+        } );
+
+    std::vector<std::uint32_t> name_offsets{ 0 };
+
+    for (std::string_view name : names)
+        name_offsets.push_back( name_offsets.back() + static_cast<std::uint32_t>( name.size() ) );
+
+    HierarchySnapshotHeader header;
+
+    header.scalar_size         = sizeof(Type);
+    header.node_count          = static_cast<std::uint32_t>( nodes.size() );
+    header.name_count          = static_cast<std::uint32_t>( names.size() );
+    header.transforms_offset   = align( sizeof(header) );
+    header.parents_offset      = align( header.transforms_offset + 8 * sizeof(Type) * nodes.size() );
+    header.name_ids_offset     = align( header.parents_offset + sizeof(std::int32_t) * nodes.size() );
+    header.name_offsets_offset = align( header.name_ids_offset + sizeof(std::uint32_t) * nodes.size() );
+    header.name_data_offset    = align( header.name_offsets_offset + sizeof(std::uint32_t) * name_offsets.size() );
+    header.total_size          = header.name_data_offset + name_offsets.back();
+
+    std::vector<std::byte> bytes( header.total_size );
+
+    std::memcpy( bytes.data(), &header, sizeof(header) );
+
+    Type *transforms = reinterpret_cast<Type *>( bytes.data() + header.transforms_offset );
+
+    for (const SceneNode<Type> *node : nodes)
+    {
+        const Math::DualQuaternion<Type> &dq{ node->coordinate_system() };
+        const Type values[8] = { dq.real().w(), dq.real().i(), dq.real().j(), dq.real().k(),
+                                 dq.dual().w(), dq.dual().i(), dq.dual().j(), dq.dual().k() };
+
+        std::memcpy( transforms, values, sizeof(values) );
+        transforms += 8;
+    }
+
+    std::memcpy( bytes.data() + header.parents_offset,      parents.data(),      sizeof(std::int32_t)  * parents.size() );
+    std::memcpy( bytes.data() + header.name_ids_offset,     name_ids.data(),     sizeof(std::uint32_t) * name_ids.size() );
+    std::memcpy( bytes.data() + header.name_offsets_offset, name_offsets.data(), sizeof(std::uint32_t) * name_offsets.size() );
+
+    for (std::size_t i = 0; i < names.size(); ++i)
+        std::memcpy( bytes.data() + header.name_data_offset + name_offsets[i], names[i].data(), names[i].size() );
+
+    return bytes;
+}
+
+/** Writes a snapshot of a whole hierarchy to a file
+ *
+ *  @return @c true on success
+ *
+ *  @relates HierarchySnapshotView
+ */
+template <class Type>
+bool save_hierarchy_snapshot(const HierarchicalCoordinateSystem<Type> &hierarchy, const std::filesystem::path &file_name)
+{
+    std::vector<std::byte> bytes{ make_hierarchy_snapshot( hierarchy ) };
+    std::ofstream          file( file_name, std::ios::binary | std::ios::trunc );
+
+    file.write( reinterpret_cast<const char *>( bytes.data() ), static_cast<std::streamsize>( bytes.size() ) );
+    return static_cast<bool>( file );
+}
+
+
+/** A read-only file mapped into memory
+ *
+ *  @note Falls back to reading the whole file into memory on platforms without mmap()
+ *
+ *  @headerfile "math/HierarchySnapshot.hpp"
+ */
+class MappedFile
+{
+public:
+    MappedFile() = default;
+    MappedFile(const MappedFile &) = delete;
+    MappedFile(MappedFile &&other) noexcept { swap( other ); }
+    MappedFile &operator =(const MappedFile &) = delete;
+    MappedFile &operator =(MappedFile &&other) noexcept
+    {
+        MappedFile{ std::move( other ) }.swap( *this );
+        return *this;
+    }
+    ~MappedFile()
+    {
+#if MATHLIB_HAS_MMAP
+        if ( _data && _size > 0 )
+            ::munmap( const_cast<std::byte *>( _data ), _size );
+#endif
+    }
+
+    /** Maps the whole of @p file_name into memory
+     *
+     *  @return The mapped file, or @c std::nullopt if it couldn't be opened
+     */
+    static std::optional<MappedFile> open(const std::filesystem::path &file_name)
+    {
+        MappedFile mapped;
+#if MATHLIB_HAS_MMAP
+        int descriptor = ::open( file_name.c_str(), O_RDONLY );
+
+        if ( descriptor < 0 )
+            return std::nullopt;
+
+        struct stat file_status;
+
+        if ( ::fstat( descriptor, &file_status ) != 0 )
+        {
+            ::close( descriptor );
+            return std::nullopt;
+        }
+
+        mapped._size = static_cast<std::size_t>( file_status.st_size );
+
+        if ( mapped._size > 0 )
+        {
+            void *address = ::mmap( nullptr, mapped._size, PROT_READ, MAP_PRIVATE, descriptor, 0 );
+
+            if ( address == MAP_FAILED )
+            {
+                ::close( descriptor );
+                return std::nullopt;
+            }
+            mapped._data = static_cast<const std::byte *>( address );
+        }
+        ::close( descriptor );
+#else
+        std::ifstream file( file_name, std::ios::binary | std::ios::ate );
+
+        if ( !file )
+            return std::nullopt;
+
+        mapped._size = static_cast<std::size_t>( file.tellg() );
+
+        // Over-aligned so that the contents can be used in place just like a mapping
+        mapped._buffer.reset( new std::max_align_t[mapped._size / sizeof(std::max_align_t) + 1] );
+        mapped._data = reinterpret_cast<const std::byte *>( mapped._buffer.get() );
+
+        file.seekg( 0 );
+        file.read( reinterpret_cast<char *>( mapped._buffer.get() ), static_cast<std::streamsize>( mapped._size ) );
+
+        if ( !file )
+            return std::nullopt;
+#endif
+        return mapped;
+    }
+
+    std::span<const std::byte> bytes() const { return { _data, _size }; }
+private:
+    const std::byte *_data = nullptr;
+    std::size_t      _size = 0;
+#if !MATHLIB_HAS_MMAP
+    std::unique_ptr<std::max_align_t[]> _buffer;
+#endif
+
+    void swap(MappedFile &other) noexcept
+    {
+        std::swap( _data, other._data );
+        std::swap( _size, other._size );
+#if !MATHLIB_HAS_MMAP
+        std::swap( _buffer, other._buffer );
+#endif
+    }
+};
+
+
+/** A snapshot file that is memory-mapped and read in place
+ *
+ *  Opening one of these maps the file without copying it, but open() still validates
+ *  each node once, which touches every page of the parent and name id sections.  Use
+ *  openTrusted() to skip that for files that are known to be good; then opening costs
+ *  the same no matter how many nodes are in the snapshot, and the pages are only
+ *  brought in from disk as the nodes are accessed.
+ *
+ *  @headerfile "math/HierarchySnapshot.hpp"
+ */
+template <class Type>
+class MappedHierarchySnapshot
+{
+public:
+    /** Maps and validates a snapshot file
+     *
+     *  @return The snapshot, or @c std::nullopt if the file couldn't be mapped or isn't a valid snapshot for @c Type
+     */
+    static std::optional<MappedHierarchySnapshot<Type>> open(const std::filesystem::path &file_name)
+    {
+        std::optional<MappedFile> file{ MappedFile::open( file_name ) };
+
+        if ( !file )
+            return std::nullopt;
+
+        std::optional<HierarchySnapshotView<Type>> view{ HierarchySnapshotView<Type>::make( file->bytes() ) };
+
+        if ( !view )
+            return std::nullopt;
+
+        return MappedHierarchySnapshot<Type>{ std::move( *file ), *view };
+    }
+
+    /** Maps a snapshot file, only checking its header and the sizes of its sections
+     *
+     *  @return The snapshot, or @c std::nullopt if the file couldn't be mapped or its header doesn't match @c Type
+     *
+     *  @warning See HierarchySnapshotView::makeTrusted() for what is not checked
+     */
+    static std::optional<MappedHierarchySnapshot<Type>> openTrusted(const std::filesystem::path &file_name)
+    {
+        std::optional<MappedFile> file{ MappedFile::open( file_name ) };
+
+        if ( !file )
+            return std::nullopt;
+
+        std::optional<HierarchySnapshotView<Type>> view{ HierarchySnapshotView<Type>::makeTrusted( file->bytes() ) };
+
+        if ( !view )
+            return std::nullopt;
+
+        return MappedHierarchySnapshot<Type>{ std::move( *file ), *view };
+    }
+
+    const HierarchySnapshotView<Type> &view() const { return _view; }
+
+    const HierarchySnapshotView<Type> *operator ->() const { return &_view; }
+private:
+    MappedFile                  _file;
+    HierarchySnapshotView<Type> _view;
+
+    MappedHierarchySnapshot(MappedFile file, HierarchySnapshotView<Type> view) : _file{ std::move( file ) }, _view{ view } { }
+};
\ No newline at end of file
@@ -0,0 +1,432 @@
+#pragma once
+
+#include "math/ApproximatelyEqualTo.hpp"
+#include "math/ScalarTraits.hpp"
+#include <cassert>
+#include <cmath>
+#include <compare>
+#include <numbers>
+
+/** @file
+ *
+ *  Contains the definition of the HyperDual class
+ *
+ *  @hideincludegraph
+ */
+
+namespace Math
+{
+
+/** Overloads of the @c <cmath> functions for a hyper-dual number type
+ *
+ *  A hyper-dual number type @p D with value type @p T gets these by deriving from
+ *  HyperDualFunctions<D, T> and providing:
+ *  - @c real, the value
+ *  - @c chain(value, derivative, second_derivative), which returns the result of a function
+ *    of one variable with the given value and first two derivatives at @c real
+ *  - @c D::chain(x, y, value, dx, dy, dxx, dxy, dyy), the same for a function of two variables
+ *  - the arithmetic operators
+ *
+ *  @ingroup AutomaticDifferentiation
+ */
+template <class D, class T>
+class HyperDualFunctions
+{
+    /** @name Powers and Roots
+     *  @{
+     */
+    friend constexpr D sqrt(const D &x)
+    {
+        const T root{ std::sqrt( x.real ) };
+        const T derivative{ T{0.5} / root };
+
+        return x.chain( root, derivative, -T{0.5} * derivative / x.real );
+    }
+
+    friend constexpr D cbrt(const D &x)
+    {
+        const T root{ std::cbrt( x.real ) };
+        const T derivative{ T{1} / (T{3} * root * root) };
+
+        return x.chain( root, derivative, -T{2} / T{3} * derivative / x.real );
+    }
+
+    /// @note Terms whose coefficient is zero are left out, so that whole powers are smooth at 0
+    friend constexpr D pow(const D &base, const T exponent)
+    {
+        const T second_coefficient{ exponent * (exponent - T{1}) };
+
+        return base.chain( std::pow( base.real, exponent ),
+                           (exponent == T{0}) ? T{0} : exponent * std::pow( base.real, exponent - T{1} ),
+                           (second_coefficient == T{0}) ? T{0} : second_coefficient * std::pow( base.real, exponent - T{2} ) );
+    }
+
+    friend constexpr D pow(const T base, const D &exponent)
+    {
+        const T value{ std::pow( base, exponent.real ) };
+        const T log_base{ std::log( base ) };
+
+        return exponent.chain( value, value * log_base, value * log_base * log_base );
+    }
+
+    /// @pre @p base > 0
+    friend constexpr D pow(const D &base, const D &exponent)
+    {
+        return exp( exponent * log( base ) );
+    }
+
+    friend constexpr D hypot(const D &x, const D &y)
+    {
+        const T value{ std::hypot( x.real, y.real ) };
+        const T inverse_cubed{ T{1} / (value * value * value) };
+
+        return D::chain( x, y, value, x.real / value, y.real / value,
+                         y.real * y.real * inverse_cubed, -x.real * y.real * inverse_cubed, x.real * x.real * inverse_cubed );
+    }
+    /// @}
+
+    /** @name Exponentials and Logarithms
+     *  @{
+     */
+    friend constexpr D exp(const D &x)
+    {
+        const T value{ std::exp( x.real ) };
+
+        return x.chain( value, value, value );
+    }
+
+    friend constexpr D log(const D &x)
+    {
+        const T inverse{ T{1} / x.real };
+
+        return x.chain( std::log( x.real ), inverse, -inverse * inverse );
+    }
+
+    friend constexpr D log2(const D &x)
+    {
+        const T inverse{ T{1} / (x.real * std::numbers::ln2_v<T>) };
+
+        return x.chain( std::log2( x.real ), inverse, -inverse / x.real );
+    }
+
+    friend constexpr D log10(const D &x)
+    {
+        const T inverse{ T{1} / (x.real * std::numbers::ln10_v<T>) };
+
+        return x.chain( std::log10( x.real ), inverse, -inverse / x.real );
+    }
+    /// @}
+
+    /** @name Trigonometric Functions
+     *  @{
+     */
+    friend constexpr D sin(const D &x)
+    {
+        const T sine{ std::sin( x.real ) };
+
+        return x.chain( sine, std::cos( x.real ), -sine );
+    }
+
+    friend constexpr D cos(const D &x)
+    {
+        const T cosine{ std::cos( x.real ) };
+
+        return x.chain( cosine, -std::sin( x.real ), -cosine );
+    }
+
+    friend constexpr D tan(const D &x)
+    {
+        const T tangent{ std::tan( x.real ) };
+        const T derivative{ T{1} + tangent * tangent };
+
+        return x.chain( tangent, derivative, T{2} * tangent * derivative );
+    }
+
+    friend constexpr D asin(const D &x)
+    {
+        const T inverse_root{ T{1} / std::sqrt( T{1} - x.real * x.real ) };
+
+        return x.chain( std::asin( x.real ), inverse_root, x.real * inverse_root * inverse_root * inverse_root );
+    }
+
+    friend constexpr D acos(const D &x)
+    {
+        const T inverse_root{ T{1} / std::sqrt( T{1} - x.real * x.real ) };
+
+        return x.chain( std::acos( x.real ), -inverse_root, -x.real * inverse_root * inverse_root * inverse_root );
+    }
+
+    friend constexpr D atan(const D &x)
+    {
+        const T derivative{ T{1} / (T{1} + x.real * x.real) };
+
+        return x.chain( std::atan( x.real ), derivative, -T{2} * x.real * derivative * derivative );
+    }
+
+    friend constexpr D atan2(const D &y, const D &x)
+    {
+        const T inverse_length_squared{ T{1} / (x.real * x.real + y.real * y.real) };
+        const T inverse_length_fourth{ inverse_length_squared * inverse_length_squared };
+        const T twice_xy{ T{2} * x.real * y.real };
+
+        return D::chain( y, x, std::atan2( y.real, x.real ),
+                         x.real * inverse_length_squared,
+                         -y.real * inverse_length_squared,
+                         -twice_xy * inverse_length_fourth,
+                         (y.real * y.real - x.real * x.real) * inverse_length_fourth,
+                         twice_xy * inverse_length_fourth );
+    }
+    /// @}
+
+    /** @name Hyperbolic Functions
+     *  @{
+     */
+    friend constexpr D sinh(const D &x)
+    {
+        const T value{ std::sinh( x.real ) };
+
+        return x.chain( value, std::cosh( x.real ), value );
+    }
+
+    friend constexpr D cosh(const D &x)
+    {
+        const T value{ std::cosh( x.real ) };
+
+        return x.chain( value, std::sinh( x.real ), value );
+    }
+
+    friend constexpr D tanh(const D &x)
+    {
+        const T value{ std::tanh( x.real ) };
+        const T derivative{ T{1} - value * value };
+
+        return x.chain( value, derivative, -T{2} * value * derivative );
+    }
+    /// @}
+
+    /** @name Other Functions
+     *  @{
+     */
+    /// @note The derivative at 0 is taken as 1
+    friend constexpr D abs(const D &x)
+    {
+        return (x.real < T{0}) ? x.chain( -x.real, T{-1}, T{0} ) : x.chain( x.real, T{1}, T{0} );
+    }
+
+    /// @copydoc abs(const D &)
+    friend constexpr D fabs(const D &x) { return abs( x ); }
+    /// @}
+};
+
+/** A number with two nilpotent parts, for exact second derivatives
+ *
+ *  A hyper-dual number is @f$ a + b_1 \epsilon_1 + b_2 \epsilon_2 + b_{12} \epsilon_1 \epsilon_2 @f$
+ *  with @f$ \epsilon_1^2 = \epsilon_2^2 = 0 @f$.  Evaluating a function @f$ f @f$ at
+ *  @f$ x + \epsilon_1 + \epsilon_2 @f$ gives @f$ f(x) @f$, @f$ f'(x) @f$ (twice) and
+ *  @f$ f''(x) @f$ with no rounding error beyond that of the arithmetic itself.  Seeding
+ *  @f$ \epsilon_1 @f$ and @f$ \epsilon_2 @f$ with different variables gives a mixed partial
+ *  derivative instead.
+ *
+ *  Nesting Dual numbers gives the same results, but evaluates the value and first
+ *  derivative of every function twice.  Each function here works out its value and its
+ *  first two derivatives once, sharing what they have in common.
+ *
+ *  Comparisons only look at the values, so code that branches on them takes the same
+ *  path as it would with plain numbers.
+ *
+ *  @headerfile "math/HyperDual.hpp"
+ *
+ *  @ingroup AutomaticDifferentiation
+ */
+template <class T>
+class HyperDual : public HyperDualFunctions<HyperDual<T>, T>
+{
+public:
+    using value_type = T;
+
+    HyperDual() = default;
+    explicit constexpr HyperDual(const T value) : real(value) { } ///< Constructs a constant
+    explicit constexpr HyperDual(const T value, const T e1, const T e2, const T e12) : real(value), e1(e1), e2(e2), e12(e12) { }
+
+    /// Constructs the variable to take the first and second derivatives with respect to
+    constexpr static HyperDual<T> variable(const T value) { return HyperDual<T>{ value, T{1}, T{1}, T{0} }; }
+
+    /** @name Element Access
+     *  @{
+     */
+    T real{}; ///< The value
+    T e1{};   ///< The derivative in the direction of the first part
+    T e2{};   ///< The derivative in the direction of the second part
+    T e12{};  ///< The second derivative in both directions
+    /// @}
+
+    /** @name Chain Rule
+     *  @{
+     */
+    /// The result of a function with the given @p value and first and second derivatives at @c real
+    constexpr HyperDual<T> chain(const T value, const T derivative, const T second_derivative) const
+    {
+        return HyperDual<T>{ value,
+                             derivative * e1,
+                             derivative * e2,
+                             derivative * e12 + second_derivative * e1 * e2 };
+    }
+
+    /** The result of a function of @p x and @p y with the given @p value, gradient and Hessian at their real parts
+     *
+     *  @param dx  The partial derivative with respect to @p x
+     *  @param dy  The partial derivative with respect to @p y
+     *  @param dxx The second partial derivative with respect to @p x
+     *  @param dxy The mixed partial derivative
+     *  @param dyy The second partial derivative with respect to @p y
+     */
+    constexpr static HyperDual<T> chain(const HyperDual<T> &x, const HyperDual<T> &y,
+                                        const T value, const T dx, const T dy, const T dxx, const T dxy, const T dyy)
+    {
+        return HyperDual<T>{ value,
+                             dx * x.e1 + dy * y.e1,
+                             dx * x.e2 + dy * y.e2,
+                             dx * x.e12 + dy * y.e12 + dxx * x.e1 * x.e2 + dxy * (x.e1 * y.e2 + y.e1 * x.e2) + dyy * y.e1 * y.e2 };
+    }
+    /// @}
+
+    /** @name Operators
+     *  @{
+     */
+    constexpr HyperDual<T> &operator +=(const HyperDual<T> &other)
+    {
+        real += other.real;
+        e1 += other.e1;
+        e2 += other.e2;
+        e12 += other.e12;
+        return *this;
+    }
+
+    constexpr HyperDual<T> &operator -=(const HyperDual<T> &other)
+    {
+        real -= other.real;
+        e1 -= other.e1;
+        e2 -= other.e2;
+        e12 -= other.e12;
+        return *this;
+    }
+
+    constexpr HyperDual<T> &operator *=(const HyperDual<T> &other)
+    {
+        *this = HyperDual<T>{ real * other.real,
+                              real * other.e1 + e1 * other.real,
+                              real * other.e2 + e2 * other.real,
+                              real * other.e12 + e1 * other.e2 + e2 * other.e1 + e12 * other.real };
+        return *this;
+    }
+
+    constexpr HyperDual<T> &operator /=(const HyperDual<T> &other)
+    {
+        const T inverse{ T{1} / other.real };
+
+        return *this *= other.chain( inverse, -inverse * inverse, T{2} * inverse * inverse * inverse );
+    }
+
+    constexpr HyperDual<T> &operator +=(const T scalar)
+    {
+        real += scalar;
+        return *this;
+    }
+
+    constexpr HyperDual<T> &operator -=(const T scalar)
+    {
+        real -= scalar;
+        return *this;
+    }
+
+    constexpr HyperDual<T> &operator *=(const T scalar)
+    {
+        real *= scalar;
+        e1 *= scalar;
+        e2 *= scalar;
+        e12 *= scalar;
+        return *this;
+    }
+
+    constexpr HyperDual<T> &operator /=(const T scalar)
+    {
+        return *this *= T{1} / scalar;
+    }
+    /// @}
+private:
+
+    /** @name Global Operators
+     *
+     *  @relates HyperDual
+     *
+     *  @{
+     */
+    friend constexpr HyperDual<T> operator -(const HyperDual<T> &input) { return HyperDual<T>{ -input.real, -input.e1, -input.e2, -input.e12 }; }
+
+    friend constexpr HyperDual<T> operator +(HyperDual<T> left, const HyperDual<T> &right) { return left += right; }
+    friend constexpr HyperDual<T> operator -(HyperDual<T> left, const HyperDual<T> &right) { return left -= right; }
+    friend constexpr HyperDual<T> operator *(HyperDual<T> left, const HyperDual<T> &right) { return left *= right; }
+    friend constexpr HyperDual<T> operator /(HyperDual<T> left, const HyperDual<T> &right) { return left /= right; }
+
+    friend constexpr HyperDual<T> operator +(HyperDual<T> left, const T right) { return left += right; }
+    friend constexpr HyperDual<T> operator -(HyperDual<T> left, const T right) { return left -= right; }
+    friend constexpr HyperDual<T> operator *(HyperDual<T> left, const T right) { return left *= right; }
+    friend constexpr HyperDual<T> operator /(HyperDual<T> left, const T right) { return left /= right; }
+
+    friend constexpr HyperDual<T> operator +(const T left, HyperDual<T> right) { return right += left; }
+    friend constexpr HyperDual<T> operator -(const T left, const HyperDual<T> &right) { return -right + left; }
+    friend constexpr HyperDual<T> operator *(const T left, HyperDual<T> right) { return right *= left; }
+    friend constexpr HyperDual<T> operator /(const T left, const HyperDual<T> &right) { return HyperDual<T>{ left } / right; }
+
+    friend constexpr bool operator ==(const HyperDual<T> &left, const HyperDual<T> &right) { return left.real == right.real; }
+    friend constexpr bool operator ==(const HyperDual<T> &left, const T right) { return left.real == right; }
+
+    friend constexpr auto operator <=>(const HyperDual<T> &left, const HyperDual<T> &right) { return left.real <=> right.real; }
+    friend constexpr auto operator <=>(const HyperDual<T> &left, const T right) { return left.real <=> right; }
+    /// @}
+
+    /** @addtogroup Equality
+     *
+     *  @relates HyperDual
+     *
+     *  @{
+     */
+    /// Compares the values and all of the derivatives to within @p tolerance
+    friend constexpr bool approximately_equal_to(const HyperDual<T> &value_to_test,
+                                                 const HyperDual<T> &value_it_should_be,
+                                                 const real_type_t<T> tolerance = real_type_t<T>{0.0002})
+    {
+        return approximately_equal_to( value_to_test.real, value_it_should_be.real, tolerance ) &&
+               approximately_equal_to( value_to_test.e1,   value_it_should_be.e1,   tolerance ) &&
+               approximately_equal_to( value_to_test.e2,   value_it_should_be.e2,   tolerance ) &&
+               approximately_equal_to( value_to_test.e12,  value_it_should_be.e12,  tolerance );
+    }
+    /// @}  {Equality}
+};
+
+/** Lets a HyperDual be used as a scalar
+ *
+ *  @relates HyperDual
+ */
+template <class T>
+struct scalar_traits<HyperDual<T>>
+{
+    using real_type = real_type_t<T>;
+
+    constexpr static bool is_scalar = is_scalar_v<T>;
+
+    constexpr static real_type value(const HyperDual<T> &input) { return value_of( input.real ); }
+};
+
+
+/** @name Type Aliases
+ *
+ *  @relates HyperDual
+ *
+ *  @{
+ */
+using HyperDualf = HyperDual<float>;
+using HyperDuald = HyperDual<double>;
+/// @}
+
+}
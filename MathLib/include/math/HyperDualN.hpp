@@ -0,0 +1,254 @@
+#pragma once
+
+#include "math/HyperDual.hpp"
+#include <array>
+#include <cassert>
+#include <compare>
+#include <cstddef>
+
+/** @file
+ *
+ *  Contains the definition of the HyperDualN class, a hyper-dual number with many second parts
+ *
+ *  @hideincludegraph
+ */
+
+namespace Math
+{
+
+/** A hyper-dual number that carries @p N second directions at once
+ *
+ *  This is @f$ a + b_1 \epsilon_1 + \sum_i (b_{2,i} \epsilon_{2,i} + b_{12,i} \epsilon_1 \epsilon_{2,i}) @f$.
+ *  Seeding @f$ \epsilon_1 @f$ with one variable and each @f$ \epsilon_{2,i} @f$ with another
+ *  gives @p N second partial derivatives, a block of one row of the Hessian, in one
+ *  evaluation.  With @p N = 1 it is the same as HyperDual.
+ *
+ *  The second parts are kept in plain arrays and every operation does the same thing to
+ *  each of them, so compilers can vectorize the loops over them.
+ *
+ *  Comparisons only look at the values, so code that branches on them takes the same
+ *  path as it would with plain numbers.
+ *
+ *  @headerfile "math/HyperDualN.hpp"
+ *
+ *  @ingroup AutomaticDifferentiation
+ */
+template <class T, std::size_t N>
+class HyperDualN : public HyperDualFunctions<HyperDualN<T, N>, T>
+{
+public:
+    using value_type = T;
+
+    constexpr static std::size_t lanes = N; ///< The number of second directions carried
+
+    HyperDualN() = default;
+    explicit constexpr HyperDualN(const T value) : real(value) { } ///< Constructs a constant
+
+    /** @name Element Access
+     *  @{
+     */
+    T                real{}; ///< The value
+    T                e1{};   ///< The derivative in the direction of the first part
+    std::array<T, N> e2{};   ///< The derivative in the direction of each second part
+    std::array<T, N> e12{};  ///< The second derivative in the first direction and each second one
+    /// @}
+
+    /** @name Chain Rule
+     *
+     *  Used by the HyperDualFunctions to differentiate functions of HyperDualNs
+     *
+     *  @{
+     */
+    /// The result of a function with the given @p value and first and second derivatives at @c real
+    constexpr HyperDualN<T, N> chain(const T value, const T derivative, const T second_derivative) const
+    {
+        HyperDualN<T, N> output{ value };
+        const T          scaled_e1{ second_derivative * e1 };
+
+        output.e1 = derivative * e1;
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            output.e2[i]  = derivative * e2[i];
+            output.e12[i] = derivative * e12[i] + scaled_e1 * e2[i];
+        }
+        return output;
+    }
+
+    /// The result of a function of @p x and @p y with the given @p value, gradient and Hessian at their real parts
+    constexpr static HyperDualN<T, N> chain(const HyperDualN<T, N> &x, const HyperDualN<T, N> &y,
+                                            const T value, const T dx, const T dy, const T dxx, const T dxy, const T dyy)
+    {
+        HyperDualN<T, N> output{ value };
+        const T          x_weight{ dxx * x.e1 + dxy * y.e1 }; // Multiplies x.e2
+        const T          y_weight{ dxy * x.e1 + dyy * y.e1 }; // Multiplies y.e2
+
+        output.e1 = dx * x.e1 + dy * y.e1;
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            output.e2[i]  = dx * x.e2[i] + dy * y.e2[i];
+            output.e12[i] = dx * x.e12[i] + dy * y.e12[i] + x_weight * x.e2[i] + y_weight * y.e2[i];
+        }
+        return output;
+    }
+    /// @}
+
+    /** @name Operators
+     *  @{
+     */
+    constexpr HyperDualN<T, N> &operator +=(const HyperDualN<T, N> &other)
+    {
+        real += other.real;
+        e1 += other.e1;
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            e2[i] += other.e2[i];
+            e12[i] += other.e12[i];
+        }
+        return *this;
+    }
+
+    constexpr HyperDualN<T, N> &operator -=(const HyperDualN<T, N> &other)
+    {
+        real -= other.real;
+        e1 -= other.e1;
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            e2[i] -= other.e2[i];
+            e12[i] -= other.e12[i];
+        }
+        return *this;
+    }
+
+    constexpr HyperDualN<T, N> &operator *=(const HyperDualN<T, N> &other)
+    {
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            e12[i] = real * other.e12[i] + e1 * other.e2[i] + e2[i] * other.e1 + e12[i] * other.real;
+            e2[i]  = real * other.e2[i] + e2[i] * other.real;
+        }
+        e1 = real * other.e1 + e1 * other.real;
+        real *= other.real;
+        return *this;
+    }
+
+    constexpr HyperDualN<T, N> &operator /=(const HyperDualN<T, N> &other)
+    {
+        const T inverse{ T{1} / other.real };
+
+        return *this *= other.chain( inverse, -inverse * inverse, T{2} * inverse * inverse * inverse );
+    }
+
+    constexpr HyperDualN<T, N> &operator +=(const T scalar)
+    {
+        real += scalar;
+        return *this;
+    }
+
+    constexpr HyperDualN<T, N> &operator -=(const T scalar)
+    {
+        real -= scalar;
+        return *this;
+    }
+
+    constexpr HyperDualN<T, N> &operator *=(const T scalar)
+    {
+        real *= scalar;
+        e1 *= scalar;
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            e2[i] *= scalar;
+            e12[i] *= scalar;
+        }
+        return *this;
+    }
+
+    constexpr HyperDualN<T, N> &operator /=(const T scalar)
+    {
+        return *this *= T{1} / scalar;
+    }
+    /// @}
+private:
+
+    /** @name Global Operators
+     *
+     *  @relates HyperDualN
+     *
+     *  @{
+     */
+    friend constexpr HyperDualN<T, N> operator -(const HyperDualN<T, N> &input) { return input.chain( -input.real, T{-1}, T{0} ); }
+
+    friend constexpr HyperDualN<T, N> operator +(HyperDualN<T, N> left, const HyperDualN<T, N> &right) { return left += right; }
+    friend constexpr HyperDualN<T, N> operator -(HyperDualN<T, N> left, const HyperDualN<T, N> &right) { return left -= right; }
+    friend constexpr HyperDualN<T, N> operator *(HyperDualN<T, N> left, const HyperDualN<T, N> &right) { return left *= right; }
+    friend constexpr HyperDualN<T, N> operator /(HyperDualN<T, N> left, const HyperDualN<T, N> &right) { return left /= right; }
+
+    friend constexpr HyperDualN<T, N> operator +(HyperDualN<T, N> left, const T right) { return left += right; }
+    friend constexpr HyperDualN<T, N> operator -(HyperDualN<T, N> left, const T right) { return left -= right; }
+    friend constexpr HyperDualN<T, N> operator *(HyperDualN<T, N> left, const T right) { return left *= right; }
+    friend constexpr HyperDualN<T, N> operator /(HyperDualN<T, N> left, const T right) { return left /= right; }
+
+    friend constexpr HyperDualN<T, N> operator +(const T left, HyperDualN<T, N> right) { return right += left; }
+    friend constexpr HyperDualN<T, N> operator -(const T left, const HyperDualN<T, N> &right) { return -right + left; }
+    friend constexpr HyperDualN<T, N> operator *(const T left, HyperDualN<T, N> right) { return right *= left; }
+    friend constexpr HyperDualN<T, N> operator /(const T left, const HyperDualN<T, N> &right) { return HyperDualN<T, N>{ left } / right; }
+
+    friend constexpr bool operator ==(const HyperDualN<T, N> &left, const HyperDualN<T, N> &right) { return left.real == right.real; }
+    friend constexpr bool operator ==(const HyperDualN<T, N> &left, const T right) { return left.real == right; }
+
+    friend constexpr auto operator <=>(const HyperDualN<T, N> &left, const HyperDualN<T, N> &right) { return left.real <=> right.real; }
+    friend constexpr auto operator <=>(const HyperDualN<T, N> &left, const T right) { return left.real <=> right; }
+    /// @}
+
+    /** @addtogroup Equality
+     *
+     *  @relates HyperDualN
+     *
+     *  @{
+     */
+    /// Compares the values and all of the derivatives to within @p tolerance
+    friend constexpr bool approximately_equal_to(const HyperDualN<T, N> &value_to_test,
+                                                 const HyperDualN<T, N> &value_it_should_be,
+                                                 const real_type_t<T> tolerance = real_type_t<T>{0.0002})
+    {
+        bool equal = approximately_equal_to( value_to_test.real, value_it_should_be.real, tolerance ) &&
+                     approximately_equal_to( value_to_test.e1, value_it_should_be.e1, tolerance );
+
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            equal = equal && approximately_equal_to( value_to_test.e2[i], value_it_should_be.e2[i], tolerance ) &&
+                             approximately_equal_to( value_to_test.e12[i], value_it_should_be.e12[i], tolerance );
+        }
+        return equal;
+    }
+    /// @}  {Equality}
+};
+
+/** Lets a HyperDualN be used as a scalar
+ *
+ *  @relates HyperDualN
+ */
+template <class T, std::size_t N>
+struct scalar_traits<HyperDualN<T, N>>
+{
+    using real_type = real_type_t<T>;
+
+    constexpr static bool is_scalar = is_scalar_v<T>;
+
+    constexpr static real_type value(const HyperDualN<T, N> &input) { return value_of( input.real ); }
+};
+
+
+/** @name Type Aliases
+ *
+ *  @relates HyperDualN
+ *
+ *  @{
+ */
+template <std::size_t N>
+using HyperDualNf = HyperDualN<float, N>;
+
+template <std::size_t N>
+using HyperDualNd = HyperDualN<double, N>;
+/// @}
+
+}
\ No newline at end of file
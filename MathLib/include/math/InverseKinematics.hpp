@@ -0,0 +1,496 @@
+#pragma once
+
+#include "math/SceneNode.hpp"
+#include "math/DualQuaternion.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <numbers>
+#include <span>
+#include <utility>
+#include <vector>
+
+
+/** @file
+ *
+ *  Contains the definition of the IKChain class, which solves inverse kinematics
+ *  over a chain of SceneNodes
+ *
+ *  @hideincludegraph
+ */
+
+/// The algorithms an IKChain can be solved with
+enum class IKMethod
+{
+    CyclicCoordinateDescent, ///< Turns one joint at a time, from the end effector back, to point at the target
+    FABRIK,                  ///< Forward And Backward Reaching IK: moves the joint positions and then fits the rotations to them
+    DampedLeastSquares       ///< Turns all the joints at once with the damped pseudo-inverse of the Jacobian
+};
+
+/// What an IKChain starts from when it is solved
+enum class IKStart
+{
+    Previous, ///< The result of the previous solve, or the current pose if there was none
+    Current,  ///< The current local rotations of the nodes
+    Rest      ///< The local rotations the nodes had when the chain was created
+};
+
+/** Limits how far a joint of an IKChain can turn away from its rest rotation
+ *
+ *  A hinge only turns about its @c axis, between @c minimum and @c maximum.  Any other
+ *  joint is a ball joint, which turns about any axis by up to @c maximum.  The default
+ *  value doesn't limit the joint at all.
+ *
+ *  @headerfile "math/InverseKinematics.hpp"
+ */
+template <class Type>
+struct IKJointLimit
+{
+    Math::Vector3D<Type> axis = Math::Vector3D<Type>::zero();      ///< The unit axis of a hinge in the frame of the joint at rest, or zero for a ball joint
+    Math::Radian<Type>   minimum{ -std::numbers::pi_v<Type> };      ///< The smallest angle of a hinge
+    Math::Radian<Type>   maximum{  std::numbers::pi_v<Type> };      ///< The largest angle of a hinge, or of a ball joint away from rest
+
+    /** @name Convenience Creation Functions
+     *  @{
+     */
+    static IKJointLimit<Type> hinge(const Math::Vector3D<Type> &axis, const Math::Radian<Type> minimum, const Math::Radian<Type> maximum)
+    {
+        assert( minimum.value() <= maximum.value() );
+
+        return { axis.normalized(), minimum, maximum };
+    }
+
+    static IKJointLimit<Type> ball(const Math::Radian<Type> maximum)
+    {
+        return { Math::Vector3D<Type>::zero(), Math::Radian<Type>{ -maximum.value() }, maximum };
+    }
+    /// @}
+
+    bool isHinge() const { return axis.magnitudeSquared() > Type{0}; }
+};
+
+/** How an IKChain is solved
+ *
+ *  @headerfile "math/InverseKinematics.hpp"
+ */
+template <class Type>
+struct IKSettings
+{
+    IKMethod    method         = IKMethod::CyclicCoordinateDescent;
+    IKStart     start          = IKStart::Previous;
+    std::size_t max_iterations = 20;
+    Type        tolerance      = Type{0.001}; ///< How close the end effector has to get to the target
+    Type        damping        = Type{0.5};   ///< Keeps IKMethod::DampedLeastSquares stable near singular poses, in units of distance
+};
+
+/** The outcome of solving an IKChain
+ *
+ *  @headerfile "math/InverseKinematics.hpp"
+ */
+template <class Type>
+struct IKResult
+{
+    Type        distance   = Type{}; ///< How far the end effector ended up from the target
+    std::size_t iterations = 0;      ///< How many iterations it took
+    bool        reached    = false;  ///< Whether @c distance is within the tolerance
+};
+
+
+/** Solves inverse kinematics for a chain of SceneNodes
+ *
+ *  The chain runs from a root joint down through its descendants to an end effector.
+ *  Solving turns the local rotations of the joints so that the end effector reaches for a
+ *  target given in world coordinates, and writes them back into the local DualQuaternions
+ *  of the nodes.  The translations of the nodes, i.e. the lengths of the bones, are kept,
+ *  and the rotation of the end effector itself is left alone.
+ *
+ *  The transforms of the nodes are read once per solve and the iterations work on a copy
+ *  of them, so the hierarchy isn't walked again for every step.
+ *
+ *  The result of the last solve is kept, which lets the next frame start from it with
+ *  IKStart::Previous even when an animation has overwritten the nodes in the meantime.
+ *
+ *  @headerfile "math/InverseKinematics.hpp"
+ */
+template <class Type>
+class IKChain
+{
+public:
+    using Node = SceneNode<Type>;
+
+    /** Creates the chain from @p root down to @p end_effector
+     *
+     *  @pre @p end_effector is a descendant of @p root
+     *
+     *  @note The current local rotations of the nodes become their rest rotations
+     */
+    IKChain(const std::shared_ptr<Node> &root, const std::shared_ptr<Node> &end_effector)
+    {
+        assert( root && end_effector && root != end_effector );
+
+        for (std::shared_ptr<Node> node = end_effector; node != root; node = node->parent().lock())
+        {
+            assert( node ); // The end effector has to be below the root
+
+            _nodes.push_back( node );
+        }
+        _nodes.push_back( root );
+        std::reverse( _nodes.begin(), _nodes.end() );
+
+        const std::size_t joints = jointCount();
+
+        _translations.resize( joints + 1 );
+        _positions.resize( joints + 1 );
+        _reached_positions.resize( joints + 1 );
+        _rest.resize( joints );
+        _rotations.resize( joints );
+        _world.resize( joints );
+        _turns.resize( joints );
+        _limits.resize( joints );
+
+        for (std::size_t joint = 0; joint < joints; ++joint)
+            _rest[joint] = std::as_const( *_nodes[joint] ).coordinate_system().rotation();
+        _rotations = _rest;
+    }
+
+    /// The number of joints, which doesn't include the end effector
+    std::size_t jointCount() const { return _nodes.size() - 1; }
+
+    /** @name Joint Limits
+     *  @{
+     */
+    const IKJointLimit<Type> &limit(const std::size_t joint) const
+    {
+        assert( joint < jointCount() );
+
+        return _limits[joint];
+    }
+
+    void setLimit(const std::size_t joint, const IKJointLimit<Type> &limit)
+    {
+        assert( joint < jointCount() );
+
+        _limits[joint] = limit;
+    }
+    /// @}
+
+    /** The local rotation of a joint after the last solve
+     *
+     *  @pre @p joint < jointCount()
+     */
+    const Math::Quaternion<Type> &rotation(const std::size_t joint) const
+    {
+        assert( joint < jointCount() );
+
+        return _rotations[joint];
+    }
+
+    /// Where the end effector was in world coordinates after the last solve
+    const Math::Vector3D<Type> &endEffectorPosition() const { return _positions.back(); }
+
+    /** Turns the joints so that the end effector reaches for @p target
+     *
+     *  @param target   Where the end effector should be, in world coordinates
+     *  @param settings How to solve
+     *
+     *  @return How close the end effector got.  The nodes are updated either way.
+     */
+    IKResult<Type> solve(const Math::Vector3D<Type> &target, const IKSettings<Type> &settings = {})
+    {
+        IKResult<Type> result;
+
+        prepare( settings.start );
+
+        for (result.distance = (target - _positions.back()).magnitude();
+             result.distance > settings.tolerance && result.iterations < settings.max_iterations;
+             result.distance = (target - _positions.back()).magnitude())
+        {
+            switch ( settings.method )
+            {
+            case IKMethod::CyclicCoordinateDescent:
+                iterateCyclicCoordinateDescent( target );
+                break;
+            case IKMethod::FABRIK:
+                iterateFABRIK( target );
+                break;
+            case IKMethod::DampedLeastSquares:
+                iterateDampedLeastSquares( target, settings.damping );
+                break;
+            }
+            ++result.iterations;
+        }
+        result.reached = result.distance <= settings.tolerance;
+
+        for (std::size_t joint = 0; joint < jointCount(); ++joint)
+        {
+            const Math::Vector3D<Type> &t{ _translations[joint] };
+
+            _nodes[joint]->setCoordinateSystem( Math::DualQuaternion<Type>::make_coordinate_system( _rotations[joint], t.x, t.y, t.z ) );
+        }
+        _has_solution = true;
+        return result;
+    }
+private:
+    std::vector<std::shared_ptr<Node>>  _nodes;             // The joints from the root down, then the end effector
+    std::vector<Math::Vector3D<Type>>   _translations;      // The local translation of each node
+    std::vector<Math::Quaternion<Type>> _rest;              // The local rotation of each joint when the chain was created
+    std::vector<Math::Quaternion<Type>> _rotations;         // The local rotation of each joint being solved for
+    std::vector<IKJointLimit<Type>>     _limits;
+    bool                                _has_solution = false;
+
+    // Scratch space, so that solving doesn't allocate
+    Math::Quaternion<Type>              _base_rotation;     // The world transform of the parent of the root
+    Math::Vector3D<Type>                _base_position;
+    std::vector<Math::Quaternion<Type>> _world;             // The world rotation of each joint
+    std::vector<Math::Vector3D<Type>>   _positions;         // The world position of each node
+    std::vector<Math::Vector3D<Type>>   _reached_positions; // The positions FABRIK moves the nodes to
+    std::vector<Math::Quaternion<Type>> _turns;             // The local turn of each joint in a step of damped least squares
+
+    /// Reads the nodes and sets up the rotations to start from
+    void prepare(const IKStart start)
+    {
+        const std::shared_ptr<Node> base{ _nodes.front()->parent().lock() };
+        const Math::DualQuaternion<Type> base_transform{ base ? base->concatenatedTransforms() : Math::DualQuaternion<Type>::identity() };
+
+        _base_rotation = base_transform.rotation();
+        _base_position = base_transform.translation();
+
+        for (std::size_t node = 0; node < _nodes.size(); ++node)
+            _translations[node] = std::as_const( *_nodes[node] ).coordinate_system().translation();
+
+        if ( start == IKStart::Rest )
+            _rotations = _rest;
+        else if ( start == IKStart::Current || !_has_solution )
+        {
+            for (std::size_t joint = 0; joint < jointCount(); ++joint)
+                _rotations[joint] = std::as_const( *_nodes[joint] ).coordinate_system().rotation();
+        }
+        updatePositions( 0 );
+    }
+
+    /// The world rotation of the parent of @p joint
+    const Math::Quaternion<Type> &parentRotation(const std::size_t joint) const { return (joint == 0) ? _base_rotation : _world[joint - 1]; }
+
+    /// Recomputes the world rotations and positions from @p first_joint down to the end effector
+    void updatePositions(const std::size_t first_joint)
+    {
+        const std::size_t joints = jointCount();
+
+        for (std::size_t joint = first_joint; joint < joints; ++joint)
+        {
+            const Math::Quaternion<Type> &parent{ parentRotation( joint ) };
+            const Math::Vector3D<Type>   &parent_position{ (joint == 0) ? _base_position : _positions[joint - 1] };
+
+            _positions[joint] = parent_position + rotate( parent, _translations[joint] );
+            _world[joint]     = parent * _rotations[joint];
+        }
+        _positions[joints] = _positions[joints - 1] + rotate( _world[joints - 1], _translations[joints] );
+    }
+
+    /** Turns @p joint by @p world_turn, which is a rotation in world coordinates about the joint
+     *
+     *  @note The world rotations and positions aren't updated
+     */
+    void turnJoint(const std::size_t joint, const Math::Quaternion<Type> &world_turn)
+    {
+        const Math::Quaternion<Type> &parent{ parentRotation( joint ) };
+
+        setRotation( joint, parent.conjugate() * world_turn * parent * _rotations[joint] );
+    }
+
+    /// Sets the local rotation of @p joint to @p rotation, after renormalizing it and applying the limit
+    void setRotation(const std::size_t joint, const Math::Quaternion<Type> &rotation)
+    {
+        const Math::Quaternion<Type> &rest{ _rest[joint] };
+        const Math::Quaternion<Type>  deviation{ rest.conjugate() * rotation / rotation.norm() };
+
+        _rotations[joint] = rest * constrain( deviation, _limits[joint] );
+    }
+
+    void iterateCyclicCoordinateDescent(const Math::Vector3D<Type> &target)
+    {
+        const std::size_t joints = jointCount();
+
+        for (std::size_t joint = joints; joint-- > 0;)
+        {
+            turnJoint( joint, Math::Quaternion<Type>::from_to( _positions[joints] - _positions[joint], target - _positions[joint] ) );
+            updatePositions( joint );
+        }
+    }
+
+    void iterateFABRIK(const Math::Vector3D<Type> &target)
+    {
+        const std::size_t joints = jointCount();
+
+        // Move the points to reach the target without changing the lengths of the bones...
+        _reached_positions = _positions;
+        _reached_positions[joints] = target;
+        for (std::size_t joint = joints; joint-- > 0;)
+            _reached_positions[joint] = place( _reached_positions[joint + 1], _reached_positions[joint], _translations[joint + 1].magnitude() );
+
+        // ...then back again so that the root stays where it is
+        _reached_positions[0] = _positions[0];
+        for (std::size_t joint = 0; joint < joints; ++joint)
+            _reached_positions[joint + 1] = place( _reached_positions[joint], _reached_positions[joint + 1], _translations[joint + 1].magnitude() );
+
+        // Fit the rotations to the points, one bone at a time so that each one starts from where its parent really is
+        for (std::size_t joint = 0; joint < joints; ++joint)
+        {
+            turnJoint( joint, Math::Quaternion<Type>::from_to( _positions[joint + 1] - _positions[joint], _reached_positions[joint + 1] - _positions[joint] ) );
+            updatePositions( joint );
+        }
+    }
+
+    /** Takes one step of @f$ \Delta\theta = J^T (J J^T + \lambda^2 I)^{-1} e @f$
+     *
+     *  The column of the Jacobian for turning a joint about the world axis @f$ a @f$ is
+     *  @f$ a \times (p_{end} - p_{joint}) @f$.  A hinge has one column, about its axis,
+     *  and a ball joint has three, about the world axes.
+     */
+    void iterateDampedLeastSquares(const Math::Vector3D<Type> &target, const Type damping)
+    {
+        const std::size_t          joints = jointCount();
+        const Math::Vector3D<Type> error{ target - _positions[joints] };
+        const Type                 damping_squared{ damping * damping };
+
+        // J J^T + lambda^2 I is symmetric, so only 6 of its elements are needed
+        Type xx{ damping_squared }, yy{ damping_squared }, zz{ damping_squared }, xy{}, xz{}, yz{};
+
+        auto for_each_column = [this](std::size_t joint, auto &&function)
+            {
+                const Math::Vector3D<Type> lever{ _positions.back() - _positions[joint] };
+
+                if ( _limits[joint].isHinge() )
+                {
+                    const Math::Vector3D<Type> axis{ rotate( parentRotation( joint ) * _rest[joint], _limits[joint].axis ) };
+
+                    function( axis, cross( axis, lever ) );
+                }
+                else
+                {
+                    for (const Math::Vector3D<Type> &axis : { Math::Vector3D<Type>::unit_x(), Math::Vector3D<Type>::unit_y(), Math::Vector3D<Type>::unit_z() })
+                        function( axis, cross( axis, lever ) );
+                }
+            };
+
+        for (std::size_t joint = 0; joint < joints; ++joint)
+        {
+            for_each_column( joint, [&](const Math::Vector3D<Type> &, const Math::Vector3D<Type> &c)
+                {
+                    xx += c.x * c.x;  yy += c.y * c.y;  zz += c.z * c.z;
+                    xy += c.x * c.y;  xz += c.x * c.z;  yz += c.y * c.z;
+                } );
+        }
+
+        // Solve (J J^T + lambda^2 I) y = e with the adjugate
+        const Type adjugate_xx{ yy * zz - yz * yz }, adjugate_xy{ xz * yz - xy * zz }, adjugate_xz{ xy * yz - xz * yy };
+        const Type adjugate_yy{ xx * zz - xz * xz }, adjugate_yz{ xy * xz - xx * yz }, adjugate_zz{ xx * yy - xy * xy };
+        const Type determinant{ xx * adjugate_xx + xy * adjugate_xy + xz * adjugate_xz };
+        const Math::Vector3D<Type> y{ Math::Vector3D<Type>{ adjugate_xx * error.x + adjugate_xy * error.y + adjugate_xz * error.z,
+                                                            adjugate_xy * error.x + adjugate_yy * error.y + adjugate_yz * error.z,
+                                                            adjugate_xz * error.x + adjugate_yz * error.y + adjugate_zz * error.z } / determinant };
+
+        // Every joint turns by the sum of its columns' angles times their axes, all at the current pose
+        for (std::size_t joint = 0; joint < joints; ++joint)
+        {
+            Math::Vector3D<Type> turn{ Math::Vector3D<Type>::zero() };
+
+            for_each_column( joint, [&](const Math::Vector3D<Type> &axis, const Math::Vector3D<Type> &c) { turn = turn + axis * dot( c, y ); } );
+
+            const Type                    angle{ turn.magnitude() };
+            const Math::Quaternion<Type> &parent{ parentRotation( joint ) };
+            const Math::Quaternion<Type>  world_turn{ (angle > Type{0}) ? Math::Quaternion<Type>::make_rotation( Math::Radian<Type>{ angle }, turn / angle )
+                                                                        : Math::Quaternion<Type>::identity() };
+
+            _turns[joint] = parent.conjugate() * world_turn * parent;
+        }
+
+        for (std::size_t joint = 0; joint < joints; ++joint)
+            setRotation( joint, _turns[joint] * _rotations[joint] );
+        updatePositions( 0 );
+    }
+
+    /// Rotates @p vector by the unit Quaternion @p rotation
+    static Math::Vector3D<Type> rotate(const Math::Quaternion<Type> &rotation, const Math::Vector3D<Type> &vector)
+    {
+        return (rotation * Math::Quaternion<Type>::encode_point( vector ) * rotation.conjugate()).imaginary();
+    }
+
+    /// The point @p length away from @p anchor in the direction of @p towards
+    static Math::Vector3D<Type> place(const Math::Vector3D<Type> &anchor, const Math::Vector3D<Type> &towards, const Type length)
+    {
+        const Math::Vector3D<Type> direction{ towards - anchor };
+        const Type                 distance{ direction.magnitude() };
+
+        return (distance > Type{0}) ? anchor + direction * (length / distance) : anchor;
+    }
+
+    /** Limits the @p deviation of a joint from its rest rotation
+     *
+     *  A hinge keeps the twist of the deviation about its axis, clamped to its range.  A ball
+     *  joint keeps the axis of the deviation and clamps its angle.
+     */
+    static Math::Quaternion<Type> constrain(const Math::Quaternion<Type> &deviation, const IKJointLimit<Type> &limit)
+    {
+        using std::atan2;
+
+        // Keep to the half of the rotations with angles in [-pi, pi]
+        const Math::Quaternion<Type> shortest{ (deviation.w() < Type{0}) ? -deviation : deviation };
+
+        if ( limit.isHinge() )
+        {
+            const Type angle{ Type{2} * atan2( dot( shortest.imaginary(), limit.axis ), shortest.w() ) };
+
+            return Math::Quaternion<Type>::make_rotation( Math::Radian<Type>{ std::clamp( angle, limit.minimum.value(), limit.maximum.value() ) }, limit.axis );
+        }
+
+        const Type sine_of_half_angle{ shortest.imaginary().magnitude() };
+        const Type angle{ Type{2} * atan2( sine_of_half_angle, shortest.w() ) };
+
+        if ( angle <= limit.maximum.value() )
+            return shortest;
+        return Math::Quaternion<Type>::make_rotation( limit.maximum, shortest.imaginary() / sine_of_half_angle );
+    }
+};
+
+
+/** Solves many IKChains, e.g. one per character
+ *
+ *  @param chains   The chains to solve
+ *  @param targets  The target of each chain, in world coordinates
+ *  @param settings How to solve all of them
+ *  @param results  Either empty or where to write how close each chain got
+ *
+ *  @pre @p targets and a non-empty @p results are the same size as @p chains
+ *
+ *  The chains are solved one after another, in order, on the calling thread.
+ *
+ *  @relates IKChain
+ */
+template <class Type>
+void solve_ik_chains(std::span<IKChain<Type>> chains, std::span<const Math::Vector3D<Type>> targets, const IKSettings<Type> &settings, std::span<IKResult<Type>> results = {})
+{
+    assert( targets.size() == chains.size() );
+    assert( results.empty() || results.size() == chains.size() );
+
+    for (std::size_t chain = 0; chain < chains.size(); ++chain)
+    {
+        const IKResult<Type> result{ chains[chain].solve( targets[chain], settings ) };
+
+        if ( !results.empty() )
+            results[chain] = result;
+    }
+}
+
+
+/** @name Type Aliases
+ *
+ *  @relates IKChain
+ *
+ *  @{
+ */
+using IKChainf = IKChain<float>;
+using IKChaind = IKChain<double>;
+/// @}
\ No newline at end of file
@@ -0,0 +1,230 @@
+#pragma once
+
+#include "math/HierarchicalCoordinateSystem.hpp"
+#include "math/DualQuaternion.hpp"
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+
+/** @file
+ *
+ *  Contains the definition of the PoseBlender class
+ *
+ *  @hideincludegraph
+ */
+
+/** Blends weighted poses of a skeleton into one
+ *
+ *  A pose is the local transform of every bone of a skeleton, indexed the same way as
+ *  HierarchicalCoordinateSystem::visitPreOrder() numbers the nodes (so index 0 is the root).
+ *
+ *  Poses added with addPose() are combined with dual quaternion linear blending: the
+ *  weighted sum of all of them is normalized once, at the end, instead of after every
+ *  pairwise blend.  Each pose is flipped onto the same hemisphere as the sum so far so
+ *  that rotations take the shortest path.  Bones whose total weight is zero come out as
+ *  the identity transform.
+ *
+ *  Poses added with addAdditivePose() are applied on top of that, in the order they were
+ *  added, as the difference between the pose and a reference pose scaled by a weight.
+ *
+ *  Both take an optional mask holding a weight for every bone, which multiplies the
+ *  weight of the pose, e.g. to only affect the upper body.
+ *
+ *  The sums are kept as one array per component, so blending runs over all the bones
+ *  in simple loops without any data-dependent branches that compilers can vectorize.
+ *
+ *  @headerfile "math/PoseBlender.hpp"
+ */
+template <class Type>
+class PoseBlender
+{
+public:
+    using Transform = Math::DualQuaternion<Type>;
+
+    /** Creates a blender for skeletons with @p bone_count bones */
+    explicit PoseBlender(std::size_t bone_count)
+        :
+        _real_w( bone_count ), _real_i( bone_count ), _real_j( bone_count ), _real_k( bone_count ),
+        _dual_w( bone_count ), _dual_i( bone_count ), _dual_j( bone_count ), _dual_k( bone_count ),
+        _weights( bone_count ),
+        _additive( bone_count )
+    {
+    }
+
+    std::size_t boneCount() const { return _weights.size(); }
+
+    /** Removes all the poses added so far */
+    void reset()
+    {
+        for (std::vector<Type> *lane : { &_real_w, &_real_i, &_real_j, &_real_k, &_dual_w, &_dual_i, &_dual_j, &_dual_k, &_weights })
+            std::fill( lane->begin(), lane->end(), Type{} );
+        std::fill( _additive.begin(), _additive.end(), Transform{} );
+        _has_additive = false;
+    }
+
+    /** Adds a pose to be blended with the others
+     *
+     *  @param pose   The local transform of every bone
+     *  @param weight How much the pose contributes.  The weights don't need to add up to 1.
+     *  @param mask   Either empty or a weight for every bone that multiplies @p weight
+     *
+     *  @pre @p pose has boneCount() unit DualQuaternions
+     */
+    void addPose(std::span<const Transform> pose, const Type weight, std::span<const Type> mask = {})
+    {
+        assert( pose.size() == boneCount() );
+        assert( mask.empty() || mask.size() == boneCount() );
+
+        const std::size_t count = boneCount();
+        const bool        masked = !mask.empty();
+
+        for (std::size_t bone = 0; bone < count; ++bone)
+        {
+            const Math::Quaternion<Type> &real{ pose[bone].real() };
+            const Math::Quaternion<Type> &dual{ pose[bone].dual() };
+
+            // Flip onto the same hemisphere as what has been accumulated so far
+            const Type alignment{ _real_w[bone] * real.w() + _real_i[bone] * real.i() + _real_j[bone] * real.j() + _real_k[bone] * real.k() };
+            const Type bone_weight{ masked ? weight * mask[bone] : weight };
+            const Type signed_weight{ (alignment < Type{0}) ? -bone_weight : bone_weight };
+
+            _real_w[bone] += signed_weight * real.w();
+            _real_i[bone] += signed_weight * real.i();
+            _real_j[bone] += signed_weight * real.j();
+            _real_k[bone] += signed_weight * real.k();
+            _dual_w[bone] += signed_weight * dual.w();
+            _dual_i[bone] += signed_weight * dual.i();
+            _dual_j[bone] += signed_weight * dual.j();
+            _dual_k[bone] += signed_weight * dual.k();
+            _weights[bone] += bone_weight;
+        }
+    }
+
+    /** Adds a pose that is layered on top of the blended poses
+     *
+     *  The difference between @p pose and @p reference is applied to the local transform
+     *  of each bone, scaled by @p weight, i.e. a bone of the result is the blended bone
+     *  times the weighted @c reference.conjugate() * @c pose.
+     *
+     *  @param pose      The local transform of every bone
+     *  @param reference The pose that @p pose is relative to, e.g. the first frame of the animation
+     *  @param weight    How much of the difference to apply, typically [0..1]
+     *  @param mask      Either empty or a weight for every bone that multiplies @p weight
+     *
+     *  @pre @p pose and @p reference have boneCount() unit DualQuaternions
+     */
+    void addAdditivePose(std::span<const Transform> pose, std::span<const Transform> reference, const Type weight, std::span<const Type> mask = {})
+    {
+        assert( pose.size() == boneCount() );
+        assert( reference.size() == boneCount() );
+        assert( mask.empty() || mask.size() == boneCount() );
+
+        const std::size_t count = boneCount();
+        const bool        masked = !mask.empty();
+
+        for (std::size_t bone = 0; bone < count; ++bone)
+        {
+            Transform  difference{ reference[bone].conjugate() * pose[bone] };
+            const Type bone_weight{ masked ? weight * mask[bone] : weight };
+
+            // Take the short way from the identity
+            difference = difference * ((difference.real().w() < Type{0}) ? -bone_weight : bone_weight);
+
+            _additive[bone] = _additive[bone] * normalizedSum( Type{1} - bone_weight + difference.real().w(), difference.real().i(), difference.real().j(), difference.real().k(),
+                                                               difference.dual().w(), difference.dual().i(), difference.dual().j(), difference.dual().k() );
+        }
+        _has_additive = true;
+    }
+
+    /** The total weight of the poses added with addPose() for @p bone */
+    Type totalWeight(std::size_t bone) const
+    {
+        assert( bone < boneCount() );
+
+        return _weights[bone];
+    }
+
+    /** Writes the blended local transform of every bone into @p output
+     *
+     *  @pre @p output has room for boneCount() transforms
+     */
+    void blend(std::span<Transform> output) const
+    {
+        assert( output.size() >= boneCount() );
+
+        const std::size_t count = boneCount();
+
+        for (std::size_t bone = 0; bone < count; ++bone)
+        {
+            output[bone] = normalizedSum( _real_w[bone], _real_i[bone], _real_j[bone], _real_k[bone],
+                                          _dual_w[bone], _dual_i[bone], _dual_j[bone], _dual_k[bone] );
+        }
+
+        if ( _has_additive )
+        {
+            for (std::size_t bone = 0; bone < count; ++bone)
+                output[bone] = output[bone] * _additive[bone];
+        }
+    }
+
+    /** Writes the blended local transform of every bone straight into the nodes of @p skeleton
+     *
+     *  @pre @p skeleton has boneCount() nodes
+     */
+    void apply(HierarchicalCoordinateSystem<Type> &skeleton)
+    {
+        _blended.resize( boneCount() );
+        blend( _blended );
+
+        skeleton.visitPreOrder( [this](SceneNode<Type> &node, std::int32_t index, std::int32_t)
+            {
+                assert( static_cast<std::size_t>( index ) < _blended.size() );
+
+                node.setCoordinateSystem( _blended[index] );
+            } );
+    }
+private:
+    std::vector<Type>      _real_w, _real_i, _real_j, _real_k;
+    std::vector<Type>      _dual_w, _dual_i, _dual_j, _dual_k;
+    std::vector<Type>      _weights;
+    std::vector<Transform> _additive;           // The product of the additive layers for each bone
+    std::vector<Transform> _blended;            // Scratch space for apply()
+    bool                   _has_additive = false;
+
+    /** Normalizes a weighted sum of unit DualQuaternions
+     *
+     *  The real part is scaled to unit length and the dual part is made orthogonal to it.
+     *  A sum of zero becomes the identity.
+     */
+    static Transform normalizedSum(Type real_w, Type real_i, Type real_j, Type real_k,
+                                   Type dual_w, Type dual_i, Type dual_j, Type dual_k)
+    {
+        const Type norm_squared{ real_w * real_w + real_i * real_i + real_j * real_j + real_k * real_k };
+        const bool is_zero{ norm_squared <= Type{0} };
+        const Type inverse_norm{ Type{1} / std::sqrt( is_zero ? Type{1} : norm_squared ) };
+        const Type projection{ (real_w * dual_w + real_i * dual_i + real_j * dual_j + real_k * dual_k) * inverse_norm * inverse_norm };
+
+        real_w = is_zero ? Type{1} : real_w;
+
+        return Transform{ Math::Quaternion<Type>{ real_w * inverse_norm, real_i * inverse_norm, real_j * inverse_norm, real_k * inverse_norm },
+                          Math::Quaternion<Type>{ (dual_w - real_w * projection) * inverse_norm,
+                                                  (dual_i - real_i * projection) * inverse_norm,
+                                                  (dual_j - real_j * projection) * inverse_norm,
+                                                  (dual_k - real_k * projection) * inverse_norm } };
+    }
+};
+
+
+/** @name Type Aliases
+ *
+ *  @relates PoseBlender
+ *
+ *  @{
+ */
+using PoseBlenderf = PoseBlender<float>;
+using PoseBlenderd = PoseBlender<double>;
+/// @}
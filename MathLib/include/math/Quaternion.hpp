@@ -3,8 +3,12 @@
 #include "math/Functions.hpp"
 #include "math/Vector3D.hpp"
 #include "math/Angle.hpp"
+#include "math/FastMath.hpp"
 #include <cassert>
 #include <cmath>
+#include <cstddef>
+#include <limits>
+#include <span>
 
 /** @file
  *  
@@ -51,35 +55,44 @@ public:
 
     constexpr Quaternion<T> conjugate() const
     {
-        if constexpr (std::is_floating_point_v<T>)
+        if constexpr (is_scalar_v<T>)
             return Quaternion<T>{ _w, -_i, -_j, -_k };
         else
             return Quaternion<T>{ _w, conjugate(_i), conjugate(_j), conjugate(_k) };
     }
 
-    /// Computes this Quaternion raised to a real power
+    /** Computes this Quaternion raised to a real power
+     *
+     *  @pre This is a unit Quaternion
+     *
+     *  @note There are no branches, so this is safe to call from loops that should be
+     *        vectorized.  Close to the identity a series expansion replaces the division
+     *        by the length of the imaginary part.
+     *
+     *  @tparam Policy Supplies the trigonometry (see @ref MathPolicies)
+     */
+    template <class Policy = StandardMath>
     Quaternion<T> pow(const T exponent) const
     {
         assert( isUnit() );
 
-        T magnitude{ imaginary().magnitude() };
+        const T magnitude{ Policy::sqrt( imaginary().magnitudeSquared() ) };
+        const T theta{ Policy::atan2( magnitude, w() ) };
+        const T new_theta{ exponent * theta };
+        const T theta_squared{ theta * theta };
 
-        // Are we a purely real number?
-        if ( approximately_equal_to(magnitude, T{0}) )
-            return Quaternion{ std::pow( w(), exponent ) }; // Yes, so only compute the real part
+        // sin(exponent * theta) / sin(theta)
+        const T series{ exponent * (T{1} + (T{1} - exponent * exponent) * theta_squared * (T{1} / T{6} + (T{7} - T{3} * exponent * exponent) * theta_squared / T{360})) };
+        T       sin_new_theta, cos_new_theta;
 
-        // Calculate the angle
-        T theta{ std::atan2(magnitude, w()) };
-        T new_theta{ exponent * theta };
-        T coefficient{ std::sin(new_theta) / magnitude };
+        Policy::sincos( new_theta, sin_new_theta, cos_new_theta );
 
-        // NOW we can calculate to the power of "exponent"...
-        T temp{ w() * w() + magnitude * magnitude };
+        const T coefficient{ (theta < small_angle_threshold()) ? series : sin_new_theta / nonzero( magnitude ) };
 
-        return Quaternion<T>{ std::cos(new_theta),
+        return Quaternion<T>{ cos_new_theta,
                               coefficient * i(),
                               coefficient * j(),
-                              coefficient * k() } * std::pow(temp, exponent);
+                              coefficient * k() };
     }
 
     /** Computes the exponential form of this Quaternion
@@ -88,48 +101,65 @@ public:
      *        when given a unit Quaternion as input.  It is for this reason that
      *        the implementation of log() has been adjusted to automatically handle
      *        non-unit Quaternions.
+     *  @note There are no branches, so this is safe to call from loops that should be
+     *        vectorized.
      */
     Quaternion<T> exp() const
     {
-        T e_to_the_w{ std::exp( w() ) };
-        T vector_part_magnitude{ imaginary().magnitude() };
-        T cos_v{ std::cos(vector_part_magnitude) };
-        T sin_v{ (vector_part_magnitude > T{0}) ? std::sin(vector_part_magnitude) / vector_part_magnitude : T{0} };
+        using std::exp;
+        using std::sqrt;
 
-        return Quaternion{ cos_v,
-                           sin_v * i(),
-                           sin_v * j(),
-                           sin_v * k() } * e_to_the_w;
+        const T e_to_the_w{ exp( w() ) };
+        const T angle_squared{ imaginary().magnitudeSquared() };
+        const T angle{ sqrt( angle_squared ) };
+        const SineCosine<T> sine_cosine{ sincos( Radian<T>{ angle } ) };
+
+        // sin(angle) / angle
+        const T series{ T{1} - angle_squared * (T{1} / T{6} - angle_squared / T{120}) };
+        const T sin_v{ (angle < small_angle_threshold()) ? series : sine_cosine.sin / nonzero( angle ) };
+        const T coefficient{ e_to_the_w * sin_v };
+
+        return Quaternion{ e_to_the_w * sine_cosine.cos,
+                           coefficient * i(),
+                           coefficient * j(),
+                           coefficient * k() };
     }
 
     /** Computes the log base e of this Quaternion
      *  
      *  @note We handle non-unit Quaternions in this version so that we can satisfy the relationship:
      *        log( exp( x ) ) == x
+     *  @note There are no branches, so this is safe to call from loops that should be
+     *        vectorized.  The angle comes from @c atan2, which keeps its precision
+     *        close to the identity where @c acos does not.
      */
     Quaternion<T> log() const
     {
-        T magnitude_of_imaginary_part{ imaginary().magnitude() };
+        using std::sqrt;
+        using std::atan2;
+        using std::log;
 
-        // Are we purely a real number?
-        if ( approximately_equal_to(magnitude_of_imaginary_part, T{0}) )
-            return Quaternion{ std::log( w() ) }; // YES, so just set the w() component (the others will be zero)
+        const T magnitude_squared_of_imaginary_part{ imaginary().magnitudeSquared() };
+        const T magnitude_of_imaginary_part{ sqrt( magnitude_squared_of_imaginary_part ) };
+        const T this_norm{ sqrt( w() * w() + magnitude_squared_of_imaginary_part ) };
+        const T theta{ atan2( magnitude_of_imaginary_part, w() ) };
+        const T theta_squared{ theta * theta };
 
-        T this_norm{ norm() };
-        T theta{ std::acos( w() / this_norm ) };
-        T coefficient{ theta / magnitude_of_imaginary_part };
+        // theta / sin(theta), divided by the norm
+        const T series{ (T{1} + theta_squared * (T{1} / T{6} + theta_squared * T{7} / T{360})) / nonzero( this_norm ) };
+        const T coefficient{ (theta < small_angle_threshold()) ? series : theta / nonzero( magnitude_of_imaginary_part ) };
 
-        return Quaternion{ std::log(this_norm),
+        return Quaternion{ log( this_norm ),
                            coefficient * i(),
                            coefficient * j(),
                            coefficient * k() };
     }
 
-    T    normSquared() const { return accumulate(*this * conjugate()); }
-    T    norm() const { return std::sqrt( normSquared() ); }
+    constexpr T normSquared() const { return accumulate(*this * conjugate()); }
+    constexpr T norm() const { return StandardMath::sqrt( normSquared() ); }
 
-    T    magnitudeSquared() const { return normSquared(); }
-    T    magnitude() const { return norm(); }
+    constexpr T magnitudeSquared() const { return normSquared(); }
+    constexpr T magnitude() const { return norm(); }
 
     constexpr Quaternion<T> normalized() const
     {
@@ -138,11 +168,11 @@ public:
         return *this / this->magnitude();
     }
 
-    Quaternion<T> inverse() const { return conjugate() / normSquared(); }
+    constexpr Quaternion<T> inverse() const { return conjugate() / normSquared(); }
 
-    Radian<T> angle() const
+    constexpr Radian<T> angle() const
     {
-        return T{2} * std::atan2( imaginary().magnitude(), w() );
+        return Radian<T>{ T{2} * StandardMath::atan2( imaginary().magnitude(), w() ) };
     }
 
     constexpr Vector3D<T> axis() const
@@ -153,28 +183,36 @@ public:
     /** @name Element Access
      *  @{
      */
-    const T &w() const { return _w; }
-    const T &real() const { return _w; }
+    constexpr const T &w() const { return _w; }
+    constexpr const T &real() const { return _w; }
 
-    const T &i() const { return _i; }
-    const T &j() const { return _j; }
-    const T &k() const { return _k; }
+    constexpr const T &i() const { return _i; }
+    constexpr const T &j() const { return _j; }
+    constexpr const T &k() const { return _k; }
 
     /// Extracts the imaginary part of a Quaternion as a Vector3D
     constexpr Vector3D<T> imaginary() const { return { _i, _j, _k }; }
     /// @}
 
-    bool isUnit() const { return approximately_equal_to( magnitude(), T{1} ); }
-    bool isUnit(const T tolerance) const { return approximately_equal_to( magnitude(), T{1}, tolerance ); }
+    /** @name Checks
+     *
+     *  @note Only the values are checked, so these ignore any derivatives that dual number
+     *        components carry.
+     *
+     *  @{
+     */
+    constexpr bool isUnit() const { return approximately_equal_to( value_of( magnitude() ), real_type_t<T>{1} ); }
+    constexpr bool isUnit(const real_type_t<T> tolerance) const { return approximately_equal_to( value_of( magnitude() ), real_type_t<T>{1}, tolerance ); }
 
-    bool isZero() const { return approximately_equal_to( magnitude(), T{} ); }
-    bool isZero(const T tolerance) const { return approximately_equal_to( magnitude(), T{}, tolerance ); }
+    constexpr bool isZero() const { return approximately_equal_to( value_of( magnitude() ), real_type_t<T>{} ); }
+    constexpr bool isZero(const real_type_t<T> tolerance) const { return approximately_equal_to( value_of( magnitude() ), real_type_t<T>{}, tolerance ); }
 
     // Checks if the real() part is 0
-    bool isPure() const { return approximately_equal_to(real(), T{}); }
+    constexpr bool isPure() const { return approximately_equal_to( value_of( real() ), real_type_t<T>{} ); }
 
-    bool isNaN() const { return std::isnan(_w) || std::isnan(_i) || std::isnan(_j) || std::isnan(_k); }
-    bool isInf() const { return std::isinf(_w) || std::isinf(_i) || std::isinf(_j) || std::isinf(_k); }
+    bool isNaN() const { return std::isnan( value_of( _w ) ) || std::isnan( value_of( _i ) ) || std::isnan( value_of( _j ) ) || std::isnan( value_of( _k ) ); }
+    bool isInf() const { return std::isinf( value_of( _w ) ) || std::isinf( value_of( _i ) ) || std::isinf( value_of( _j ) ) || std::isinf( value_of( _k ) ); }
+    /// @}
 
     /** @name Convenience Creation Functions
      *  @{
@@ -230,11 +268,14 @@ public:
      *  @param axis_y  The Y component of the vector to rotate around
      *  @param axis_z  The Z component of the vector to rotate around
      *  
+     *  @tparam Policy Supplies the trigonometry (see @ref MathPolicies)
+     *  
      *  @post output.isUnit() == true
      */
+    template <class Policy = StandardMath>
     constexpr static Quaternion<T> make_rotation(const Radian<T> radians, const T axis_x, const T axis_y, const T axis_z)
     {
-        return make_rotation(radians, { axis_x, axis_y, axis_z });
+        return make_rotation<Policy>(radians, { axis_x, axis_y, axis_z });
     }
 
     /** Enocde a rotation into a Quaternion
@@ -242,19 +283,114 @@ public:
      *  @param radians The amount of rotation to apply (in radians)
      *  @param axis    The axis to rotate around
      *  
+     *  @tparam Policy Supplies the trigonometry (see @ref MathPolicies)
+     *  
      *  @post output.isUnit() == true
      */
+    template <class Policy = StandardMath>
     constexpr static Quaternion<T> make_rotation(const Radian<T> radians, const Vector3D<T> &axis)
     {
-        T half_angle = radians.value() * T{0.5};
-        T cos_theta = cos( half_angle );
-        T sin_theta = sin( half_angle );
-        Vector3D<T> n{ axis.normalized() };
+        SineCosine<T> half_angle{ sincos<Policy>( Radian<T>{ radians.value() * T{0.5} } ) };
+        Vector3D<T>   n{ axis * Policy::rsqrt( axis.magnitudeSquared() ) };
 
-        return Quaternion<T>{ cos_theta,
-                              sin_theta * n.x,
-                              sin_theta * n.y,
-                              sin_theta * n.z };
+        return Quaternion<T>{ half_angle.cos,
+                              half_angle.sin * n.x,
+                              half_angle.sin * n.y,
+                              half_angle.sin * n.z };
+    }
+
+    /** Encode the shortest rotation that turns the direction of @p from into the direction of @p to
+     *
+     *  Uses the half-way vector @f$ h = \hat{a} + \hat{b} @f$ of the two unit directions, as
+     *  @f$ (\frac{1}{2} |h|^2, \hat{a} \times h) @f$ normalized, so there is no trigonometry and
+     *  @p from and @p to needn't be unit vectors.  Unlike @f$ |a| |b| + a \cdot b @f$, both parts
+     *  keep their precision when the directions are nearly opposite.
+     *
+     *  @note A zero vector gives the identity, and opposite directions give a half turn
+     *        about an axis perpendicular to them
+     *
+     *  @post output.isUnit() == true
+     */
+    static Quaternion<T> from_to(const Vector3D<T> &from, const Vector3D<T> &to)
+    {
+        using std::abs;
+        using std::sqrt;
+
+        const T from_squared{ from.magnitudeSquared() };
+        const T to_squared{ to.magnitudeSquared() };
+
+        if ( !(from_squared > std::numeric_limits<real_type_t<T>>::min()) || !(to_squared > std::numeric_limits<real_type_t<T>>::min()) )
+            return identity();
+
+        const Vector3D<T>   direction{ from / sqrt( from_squared ) };
+        const Vector3D<T>   sum{ direction + to / sqrt( to_squared ) };
+        const Vector3D<T>   axis{ cross( direction, sum ) };
+        const Quaternion<T> half_way{ T{0.5} * sum.magnitudeSquared(), axis.x, axis.y, axis.z };
+        const T             norm{ half_way.norm() }; // The length of the half-way vector
+
+        if ( norm <= T{4} * std::numeric_limits<real_type_t<T>>::epsilon() )
+        {
+            // Opposite directions, or so close that the half-way vector is only rounding error:
+            // turn half way around anything perpendicular to them
+            const Vector3D<T> perpendicular{ cross( from, (abs( from.x ) < abs( from.z )) ? Vector3D<T>::unit_x() : Vector3D<T>::unit_z() ) };
+
+            return make_pure( perpendicular.normalized() );
+        }
+        return half_way / norm;
+    }
+
+    /** Encode the rotation that turns +z to face along @p forward, with +y as close to @p up as it can be
+     *
+     *  The rotated x axis is @f$ up \times forward @f$, so this is the orientation of an
+     *  object looking along @p forward.  Neither vector needs to be a unit vector.
+     *
+     *  @note A zero @p forward gives the identity, and an @p up along @p forward gives from_to( +z, @p forward )
+     *
+     *  @post output.isUnit() == true
+     */
+    static Quaternion<T> look_rotation(const Vector3D<T> &forward, const Vector3D<T> &up = Vector3D<T>::unit_y())
+    {
+        using std::sqrt;
+
+        const T forward_squared{ forward.magnitudeSquared() };
+
+        if ( !(forward_squared > std::numeric_limits<real_type_t<T>>::min()) )
+            return identity();
+
+        const Vector3D<T> z{ forward / sqrt( forward_squared ) };
+        const Vector3D<T> side{ cross( up, z ) };
+        const T           side_squared{ side.magnitudeSquared() };
+
+        if ( !(side_squared > up.magnitudeSquared() * std::numeric_limits<real_type_t<T>>::epsilon()) )
+            return from_to( Vector3D<T>::unit_z(), z );
+
+        const Vector3D<T> x{ side / sqrt( side_squared ) };
+        const Vector3D<T> y{ cross( z, x ) };
+        const T           trace{ x.x + y.y + z.z };
+
+        // Take the square root of the largest of the four so that it is never close to zero
+        if ( trace > T{0} )
+        {
+            const T s{ sqrt( trace + T{1} ) * T{2} }; // 4 w
+
+            return Quaternion<T>{ T{0.25} * s, (y.z - z.y) / s, (z.x - x.z) / s, (x.y - y.x) / s };
+        }
+        if ( x.x > y.y && x.x > z.z )
+        {
+            const T s{ sqrt( T{1} + x.x - y.y - z.z ) * T{2} }; // 4 i
+
+            return Quaternion<T>{ (y.z - z.y) / s, T{0.25} * s, (y.x + x.y) / s, (z.x + x.z) / s };
+        }
+        if ( y.y > z.z )
+        {
+            const T s{ sqrt( T{1} + y.y - x.x - z.z ) * T{2} }; // 4 j
+
+            return Quaternion<T>{ (z.x - x.z) / s, (y.x + x.y) / s, T{0.25} * s, (z.y + y.z) / s };
+        }
+
+        const T s{ sqrt( T{1} + z.z - x.x - y.y ) * T{2} }; // 4 k
+
+        return Quaternion<T>{ (x.y - y.x) / s, (z.x + x.z) / s, (z.y + y.z) / s, T{0.25} * s };
     }
     /// @}
 
@@ -276,6 +412,20 @@ private:
     T _j{};
     T _k{};
 
+    /** The angle below which pow(), exp() and log() switch to a series expansion
+     *
+     *  The series are accurate to the precision of @p T below this angle.
+     */
+    constexpr static T small_angle_threshold() { return (std::numeric_limits<real_type_t<T>>::digits <= 24) ? T{0.02} : T{0.0001}; }
+
+    /// Replaces zero with the smallest normal number so that it can be divided by
+    constexpr static T nonzero(const T value)
+    {
+        const T smallest{ std::numeric_limits<real_type_t<T>>::min() };
+
+        return (value > smallest) ? value : smallest;
+    }
+
     /** @name Private Friend Functions
      *  @{
      */
@@ -294,7 +444,7 @@ private:
      *  
      *  @return @c true if they are equal
      */
-    friend constexpr bool approximately_equal_to(const Quaternion<T> &value_to_test, const Quaternion<T> &value_it_should_be, const float tolerance = 0.0002f)
+    friend constexpr bool approximately_equal_to(const Quaternion<T> &value_to_test, const Quaternion<T> &value_it_should_be, const real_type_t<T> tolerance = real_type_t<T>{0.0002})
     {
         return approximately_equal_to(value_to_test.w(), value_it_should_be.w(), tolerance) &&
                approximately_equal_to(value_to_test.i(), value_it_should_be.i(), tolerance) &&
@@ -436,7 +586,7 @@ private:
      * 
      *  @return @c true if the two are equal within @c tolerance , @c false otherwise
      */
-    friend bool check_if_equal(const Quaternion<T> &input, const Quaternion<T> &near_to, float tolerance = 0.0002f)
+    friend bool check_if_equal(const Quaternion<T> &input, const Quaternion<T> &near_to, real_type_t<T> tolerance = real_type_t<T>{0.0002})
     {
         if (!approximately_equal_to(input, near_to, tolerance))
         {
@@ -463,7 +613,7 @@ private:
      * 
      *  @return @c true if the two are not equal outside @c tolerance , @c false otherwise
      */
-    friend bool check_if_not_equal(const Quaternion<T> &input, const Quaternion<T> &near_to, float tolerance = 0.0002f)
+    friend bool check_if_not_equal(const Quaternion<T> &input, const Quaternion<T> &near_to, real_type_t<T> tolerance = real_type_t<T>{0.0002})
     {
         if (approximately_equal_to(input, near_to, tolerance))
         {
@@ -480,17 +630,17 @@ private:
         return true;
     }
 
-    friend void CHECK_IF_EQUAL(const Quaternion<T> &input, const Quaternion<T> &near_to, const float tolerance = 0.0002f)
+    friend void CHECK_IF_EQUAL(const Quaternion<T> &input, const Quaternion<T> &near_to, const real_type_t<T> tolerance = real_type_t<T>{0.0002})
     {
         assert( check_if_equal(input, near_to, tolerance) );
     }
 
-    friend void CHECK_IF_NOT_EQUAL(const Quaternion<T> &input, const Quaternion<T> &near_to, const float tolerance = 0.0002f)
+    friend void CHECK_IF_NOT_EQUAL(const Quaternion<T> &input, const Quaternion<T> &near_to, const real_type_t<T> tolerance = real_type_t<T>{0.0002})
     {
         assert( check_if_not_equal(input, near_to, tolerance) );
     }
 
-    friend void CHECK_IF_ZERO(const Quaternion<T> &input, const float tolerance = 0.0002f)
+    friend void CHECK_IF_ZERO(const Quaternion<T> &input, const real_type_t<T> tolerance = real_type_t<T>{0.0002})
     {
         assert( check_if_equal(input, Quaternion<T>::zero(), tolerance));
     }
@@ -644,12 +794,15 @@ private:
      *  @param begin   Origin value
      *  @param end     Destination value
      *  @param percent [0..1] Represents the percentage to interpolate
+     *
+     *  @tparam Policy Supplies the trigonometry (see @ref MathPolicies)
      */
+    template <class Policy = StandardMath>
     friend constexpr Quaternion<T> slerp(const Quaternion<T> &begin, const Quaternion<T> &end, const T percent)
     {
         Quaternion<T> combined{ begin.conjugate() * end };
 
-        return begin * combined.pow(percent);
+        return begin * combined.template pow<Policy>(percent);
     }
 
     friend std::string format(const Quaternion<T> &input)
@@ -688,6 +841,123 @@ private:
 };
 
 
+/** The components of many Quaternions, one array per component
+ *
+ *  Use @c QuaternionArrays<const T> for read-only input.
+ *
+ *  @note All of the arrays must be the same size
+ *
+ *  @relates Quaternion
+ */
+template <class T>
+struct QuaternionArrays
+{
+    std::span<T> w, i, j, k;
+
+    std::size_t size() const { return w.size(); }
+};
+
+/** @name Batched Functions
+ *
+ *  The same as calling the member functions on each element in turn.  The members have
+ *  no branches, so the compiler is free to vectorize these loops.
+ *
+ *  @pre @p output has room for as many Quaternions as @p input
+ *
+ *  @relates Quaternion
+ * 
+ *  @{
+ */
+
+/// Computes the exponential of each of @p input
+template <class T>
+void exp_quaternions(std::span<const Quaternion<T>> input, std::span<Quaternion<T>> output)
+{
+    assert( output.size() >= input.size() );
+
+    const std::size_t count = input.size();
+
+    for (std::size_t i = 0; i < count; ++i)
+        output[i] = input[i].exp();
+}
+
+/// Computes the log base e of each of @p input
+template <class T>
+void log_quaternions(std::span<const Quaternion<T>> input, std::span<Quaternion<T>> output)
+{
+    assert( output.size() >= input.size() );
+
+    const std::size_t count = input.size();
+
+    for (std::size_t i = 0; i < count; ++i)
+        output[i] = input[i].log();
+}
+
+/** Raises each of @p input to the power @p exponent
+ *
+ *  @pre @p input are unit Quaternions
+ */
+template <class T>
+void pow_quaternions(std::span<const Quaternion<T>> input, const T exponent, std::span<Quaternion<T>> output)
+{
+    assert( output.size() >= input.size() );
+
+    const std::size_t count = input.size();
+
+    for (std::size_t i = 0; i < count; ++i)
+        output[i] = input[i].pow( exponent );
+}
+
+/** Encodes a rotation about each of @p axes by the matching angle
+ *
+ *  @pre @p axes is the same size as @p angles
+ *
+ *  @tparam Policy Supplies the trigonometry (see @ref MathPolicies)
+ */
+template <class Policy = StandardMath, class T>
+void make_rotations(std::span<const Radian<T>> angles, std::span<const Vector3D<T>> axes, std::span<Quaternion<T>> output)
+{
+    assert( axes.size() == angles.size() && output.size() >= angles.size() );
+
+    const std::size_t count = angles.size();
+
+    for (std::size_t i = 0; i < count; ++i)
+        output[i] = Quaternion<T>::template make_rotation<Policy>( angles[i], axes[i] );
+}
+
+/** Encodes the shortest rotation from each of @p from to the matching one of @p to
+ *
+ *  @pre @p to is the same size as @p from
+ *
+ *  @note Only zero and opposite vectors take a different path
+ */
+template <class T>
+void from_to_rotations(std::span<const Vector3D<T>> from, std::span<const Vector3D<T>> to, std::span<Quaternion<T>> output)
+{
+    assert( to.size() == from.size() && output.size() >= from.size() );
+
+    const std::size_t count = from.size();
+
+    for (std::size_t i = 0; i < count; ++i)
+        output[i] = Quaternion<T>::from_to( from[i], to[i] );
+}
+
+/** Encodes the rotation that looks along each of @p forwards, with the same @p up for all of them
+ *
+ *  @note Only zero forwards and ones along @p up take a different path
+ */
+template <class T>
+void look_rotations(std::span<const Vector3D<T>> forwards, const Vector3D<T> &up, std::span<Quaternion<T>> output)
+{
+    assert( output.size() >= forwards.size() );
+
+    const std::size_t count = forwards.size();
+
+    for (std::size_t i = 0; i < count; ++i)
+        output[i] = Quaternion<T>::look_rotation( forwards[i], up );
+}
+/// @}
+
 /** @name Type Aliases
  *
  *  @relates Quaternion
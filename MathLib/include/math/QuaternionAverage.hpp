@@ -0,0 +1,310 @@
+#pragma once
+
+#include "math/Quaternion.hpp"
+#include "math/DualQuaternion.hpp"
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+/** @file
+ *
+ *  Contains accumulators for averaging many rotations and rigid transformations
+ *
+ *  @hideincludegraph
+ */
+
+namespace Math
+{
+
+/** Averages unit Quaternions one at a time
+ *
+ *  Samples are added one at a time in constant time and memory, so the average of any
+ *  number of them can be taken in a single pass.  Accumulators that were filled
+ *  separately (e.g. by different threads) can be combined with merge().
+ *
+ *  Two averages are available:
+ *  - mean() normalizes the weighted sum of the samples after flipping each one onto the
+ *    same hemisphere.  This is fast and accurate when the samples are close together.
+ *  - markleyMean() finds the rotation that maximizes the weighted sum of the squared
+ *    dot products with the samples, i.e. the eigenvector of the largest eigenvalue of
+ *    @f$ \sum w_i q_i q_i^T @f$ (Markley et al., "Averaging Quaternions", 2007).
+ *    This does not depend on the signs of the samples and stays accurate for samples
+ *    that are far apart.
+ *
+ *  @headerfile "math/QuaternionAverage.hpp"
+ */
+template <class T>
+class QuaternionAccumulator
+{
+public:
+    /** Adds a sample
+     *
+     *  @param rotation The sample to add
+     *  @param weight   How much it counts towards the average
+     *
+     *  @pre @p rotation is a unit Quaternion and @p weight >= 0
+     */
+    void add(const Quaternion<T> &rotation, const T weight = T{1})
+    {
+        assert( weight >= T{0} );
+
+        const std::array<T, 4> q{ rotation.w(), rotation.i(), rotation.j(), rotation.k() };
+
+        if ( _count == 0 )
+            _reference = rotation;
+
+        const T signed_weight{ (dot( _reference, rotation ) < T{0}) ? -weight : weight };
+
+        for (std::size_t row = 0, index = 0; row < 4; ++row)
+        {
+            _sum[row] += signed_weight * q[row];
+
+            for (std::size_t column = row; column < 4; ++column)
+                _outer_products[index++] += weight * q[row] * q[column];
+        }
+        _total_weight += weight;
+        ++_count;
+    }
+
+    /** Adds all the samples of @p other as if they had been added to this one */
+    void merge(const QuaternionAccumulator<T> &other)
+    {
+        if ( other._count == 0 )
+            return;
+        if ( _count == 0 )
+        {
+            *this = other;
+            return;
+        }
+
+        const Quaternion<T> other_sum{ other._sum[0], other._sum[1], other._sum[2], other._sum[3] };
+        const T             sign{ (dot( _reference, other_sum ) < T{0}) ? T{-1} : T{1} };
+
+        for (std::size_t i = 0; i < 4; ++i)
+            _sum[i] += sign * other._sum[i];
+        for (std::size_t i = 0; i < _outer_products.size(); ++i)
+            _outer_products[i] += other._outer_products[i];
+        _total_weight += other._total_weight;
+        _count += other._count;
+    }
+
+    std::size_t count() const { return _count; }
+
+    T totalWeight() const { return _total_weight; }
+
+    /** The normalized, sign-aligned weighted sum of the samples
+     *
+     *  @pre totalWeight() > 0
+     *
+     *  @note The output is on the same hemisphere as the first sample
+     */
+    Quaternion<T> mean() const
+    {
+        assert( _total_weight > T{0} );
+
+        return Quaternion<T>{ _sum[0], _sum[1], _sum[2], _sum[3] }.normalized();
+    }
+
+    /** The rotation closest to all of the samples in the least squares sense
+     *
+     *  @pre totalWeight() > 0
+     *
+     *  @note The output is on the same hemisphere as the first sample
+     */
+    Quaternion<T> markleyMean() const
+    {
+        assert( _total_weight > T{0} );
+
+        T matrix[4][4];
+
+        for (std::size_t row = 0, index = 0; row < 4; ++row)
+        {
+            for (std::size_t column = row; column < 4; ++column, ++index)
+                matrix[row][column] = matrix[column][row] = _outer_products[index];
+        }
+
+        const std::array<T, 4> eigenvector{ largestEigenvector( matrix ) };
+        const Quaternion<T>    average{ Quaternion<T>{ eigenvector[0], eigenvector[1], eigenvector[2], eigenvector[3] }.normalized() };
+
+        return (dot( _reference, average ) < T{0}) ? -average : average;
+    }
+private:
+    std::array<T, 4>  _sum{};
+    std::array<T, 10> _outer_products{}; // The upper triangle of the sum of w q q^T, row by row
+    Quaternion<T>     _reference{ Quaternion<T>::identity() }; // The samples are flipped onto this one's hemisphere
+    T                 _total_weight{};
+    std::size_t       _count = 0;
+
+    /** Finds the eigenvector of the largest eigenvalue of a symmetric 4x4 matrix
+     *
+     *  Uses cyclic Jacobi rotations, which converge quickly and reliably at this size
+     */
+    static std::array<T, 4> largestEigenvector(T (&matrix)[4][4])
+    {
+        T vectors[4][4] = { { T{1}, T{}, T{}, T{} }, { T{}, T{1}, T{}, T{} }, { T{}, T{}, T{1}, T{} }, { T{}, T{}, T{}, T{1} } };
+
+        for (int sweep = 0; sweep < 16; ++sweep)
+        {
+            T off_diagonal{};
+
+            for (std::size_t p = 0; p < 3; ++p)
+            {
+                for (std::size_t q = p + 1; q < 4; ++q)
+                    off_diagonal += matrix[p][q] * matrix[p][q];
+            }
+            if ( off_diagonal <= std::numeric_limits<T>::min() )
+                break;
+
+            for (std::size_t p = 0; p < 3; ++p)
+            {
+                for (std::size_t q = p + 1; q < 4; ++q)
+                {
+                    if ( matrix[p][q] == T{0} )
+                        continue;
+
+                    // Choose the rotation that zeroes matrix[p][q]
+                    const T theta{ (matrix[q][q] - matrix[p][p]) / (T{2} * matrix[p][q]) };
+                    const T t{ std::copysign( T{1}, theta ) / (std::abs( theta ) + std::sqrt( theta * theta + T{1} )) };
+                    const T c{ T{1} / std::sqrt( t * t + T{1} ) };
+                    const T s{ t * c };
+
+                    for (std::size_t k = 0; k < 4; ++k)
+                    {
+                        const T kp{ matrix[k][p] };
+                        const T kq{ matrix[k][q] };
+
+                        matrix[k][p] = c * kp - s * kq;
+                        matrix[k][q] = s * kp + c * kq;
+                    }
+                    for (std::size_t k = 0; k < 4; ++k)
+                    {
+                        const T pk{ matrix[p][k] };
+                        const T qk{ matrix[q][k] };
+
+                        matrix[p][k] = c * pk - s * qk;
+                        matrix[q][k] = s * pk + c * qk;
+                    }
+                    for (std::size_t k = 0; k < 4; ++k)
+                    {
+                        const T kp{ vectors[k][p] };
+                        const T kq{ vectors[k][q] };
+
+                        vectors[k][p] = c * kp - s * kq;
+                        vectors[k][q] = s * kp + c * kq;
+                    }
+                }
+            }
+        }
+
+        std::size_t largest = 0;
+
+        for (std::size_t i = 1; i < 4; ++i)
+        {
+            if ( matrix[i][i] > matrix[largest][largest] )
+                largest = i;
+        }
+        return { vectors[0][largest], vectors[1][largest], vectors[2][largest], vectors[3][largest] };
+    }
+};
+
+
+/** Averages unit DualQuaternions one at a time
+ *
+ *  The counterpart of QuaternionAccumulator for rigid transformations.
+ *
+ *  - mean() is dual quaternion linear blending of all the samples: the sign-aligned
+ *    weighted sum normalized once.
+ *  - markleyMean() combines the QuaternionAccumulator::markleyMean() of the rotations
+ *    with the weighted mean of the translations.
+ *
+ *  @headerfile "math/QuaternionAverage.hpp"
+ */
+template <class T>
+class DualQuaternionAccumulator
+{
+public:
+    /** Adds a sample
+     *
+     *  @param transform The sample to add
+     *  @param weight    How much it counts towards the average
+     *
+     *  @pre @p transform is a unit DualQuaternion and @p weight >= 0
+     */
+    void add(const DualQuaternion<T> &transform, const T weight = T{1})
+    {
+        if ( _rotations.count() == 0 )
+            _reference = transform.real();
+
+        const T signed_weight{ (dot( _reference, transform.real() ) < T{0}) ? -weight : weight };
+
+        _sum = _sum + transform * signed_weight;
+        _translation_sum = _translation_sum + transform.translation() * weight;
+        _rotations.add( transform.real(), weight );
+    }
+
+    /** Adds all the samples of @p other as if they had been added to this one */
+    void merge(const DualQuaternionAccumulator<T> &other)
+    {
+        if ( other.count() == 0 )
+            return;
+        if ( count() == 0 )
+        {
+            *this = other;
+            return;
+        }
+
+        const T sign{ (dot( _reference, other._sum.real() ) < T{0}) ? T{-1} : T{1} };
+
+        _sum = _sum + other._sum * sign;
+        _translation_sum = _translation_sum + other._translation_sum;
+        _rotations.merge( other._rotations );
+    }
+
+    std::size_t count() const { return _rotations.count(); }
+
+    T totalWeight() const { return _rotations.totalWeight(); }
+
+    /** The normalized, sign-aligned weighted sum of the samples
+     *
+     *  @pre totalWeight() > 0
+     */
+    DualQuaternion<T> mean() const
+    {
+        assert( totalWeight() > T{0} );
+
+        return _sum.normalized();
+    }
+
+    /** The least squares average rotation combined with the mean translation
+     *
+     *  @pre totalWeight() > 0
+     */
+    DualQuaternion<T> markleyMean() const
+    {
+        assert( totalWeight() > T{0} );
+
+        return DualQuaternion<T>{ _rotations.markleyMean(), _translation_sum / totalWeight() };
+    }
+private:
+    DualQuaternion<T>        _sum{ DualQuaternion<T>::zero() };
+    Vector3D<T>              _translation_sum{};
+    Quaternion<T>            _reference{ Quaternion<T>::identity() };
+    QuaternionAccumulator<T> _rotations;
+};
+
+
+/** @name Type Aliases
+ *
+ *  @relates QuaternionAccumulator
+ *
+ *  @{
+ */
+using QuaternionAccumulatorf     = QuaternionAccumulator<float>;
+using QuaternionAccumulatord     = QuaternionAccumulator<double>;
+using DualQuaternionAccumulatorf = DualQuaternionAccumulator<float>;
+using DualQuaternionAccumulatord = DualQuaternionAccumulator<double>;
+/// @}
+
+}
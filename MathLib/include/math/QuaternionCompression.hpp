@@ -0,0 +1,346 @@
+#pragma once
+
+#include "math/Quaternion.hpp"
+#include "math/FastMath.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <numbers>
+#include <span>
+
+/** @file
+ *
+ *  Contains functions for storing unit Quaternions in fewer bits
+ *
+ *  @hideincludegraph
+ */
+
+namespace Math
+{
+
+/** @addtogroup QuaternionCompression Quaternion Compression
+ *
+ *  Encodes unit Quaternions with the "smallest three" method
+ *
+ *  A unit Quaternion only has three degrees of freedom, so one of its components
+ *  can be dropped and recomputed from the others.  Dropping the component with the
+ *  largest magnitude means that the other three are within [-1/sqrt(2), 1/sqrt(2)],
+ *  and since q and -q are the same rotation, the sign of the largest one can be
+ *  made positive.  That leaves 2 bits for the index of the dropped component and
+ *  three small values to quantize.
+ *
+ *  There are three ready-made formats:
+ *
+ *  | Format          | Size    | Bits per component | Maximum component error |
+ *  | --------------- | ------- | ------------------ | ----------------------- |
+ *  | SmallestThree32 | 4 bytes | 10                 | 0.0021                  |
+ *  | SmallestThree48 | 6 bytes | 15                 | 0.000065                |
+ *  | SmallestThree64 | 8 bytes | 20                 | 0.0000020               |
+ *
+ *  The maximum component error is the largest difference between any component of the
+ *  input and the output (after making their signs agree), as given by
+ *  max_compression_error().  The three stored components are off by at most half a
+ *  quantization step and the recomputed one by at most twice that again.  For
+ *  comparison, a Quaternion of floats takes 16 bytes and one of doubles takes 32.
+ *
+ *  @{
+ */
+
+/** Packs a unit Quaternion with the smallest three method
+ *
+ *  @tparam BitsPerComponent The number of bits to quantize each of the three smallest components to
+ *
+ *  @param rotation The rotation to pack
+ *
+ *  @return The index of the largest component in the lowest 2 bits followed by the
+ *          three quantized components, lowest first, in @c 3*BitsPerComponent bits
+ *
+ *  @pre @p rotation is a unit Quaternion
+ *
+ *  @note This is straight-line code: the largest component and the three that are kept
+ *        are picked with selects rather than branches or an index that depends on
+ *        @p rotation, so that loops over it can be vectorized.
+ */
+template <unsigned BitsPerComponent, class T>
+inline std::uint64_t pack_smallest_three(const Quaternion<T> &rotation)
+{
+    static_assert( BitsPerComponent >= 2 && 2 + 3 * BitsPerComponent <= 64 );
+
+    constexpr std::uint32_t max_quantized = (std::uint32_t{1} << BitsPerComponent) - 1;
+    constexpr T             range         = std::numbers::sqrt2_v<T> / T{2}; // 1 / sqrt(2)
+
+    const T w{ rotation.w() }, i{ rotation.i() }, j{ rotation.j() }, k{ rotation.k() };
+
+    // The first of the components with the largest magnitude
+    std::uint32_t largest{ 0 };
+    T             largest_value{ w };
+    T             largest_magnitude{ std::abs( w ) };
+
+    auto keep_if_larger = [&](const std::uint32_t index, const T value)
+        {
+            const T    magnitude{ std::abs( value ) };
+            const bool larger{ magnitude > largest_magnitude };
+
+            // Arithmetic rather than a select so that the three updates are not merged into a switch
+            largest          += (index - largest) * std::uint32_t{ larger };
+            largest_value     = larger ? value : largest_value;
+            largest_magnitude = larger ? magnitude : largest_magnitude;
+        };
+
+    keep_if_larger( 1, i );
+    keep_if_larger( 2, j );
+    keep_if_larger( 3, k );
+
+    const T scale{ ((largest_value < T{0}) ? T{-0.5} : T{0.5}) / range };
+
+    // Each quantized value has at most 20 bits, so it goes through a 32-bit integer, and it is
+    // clamped after rounding because integer min/max never become branches
+    auto quantize = [scale](const T component) -> std::uint64_t
+        {
+            const T normalized_value{ component * scale + T{0.5} }; // [0..1]
+            const std::int32_t quantized{ static_cast<std::int32_t>( normalized_value * T(max_quantized) + T{0.5} ) };
+
+            return static_cast<std::uint32_t>( std::clamp( quantized, std::int32_t{0}, std::int32_t(max_quantized) ) );
+        };
+
+    const T kept_0{ (largest == 0) ? i : w };
+    const T kept_1{ (largest <= 1) ? j : i };
+    const T kept_2{ (largest <= 2) ? k : j };
+
+    return std::uint64_t{ largest } |
+           (quantize( kept_0 ) << 2) |
+           (quantize( kept_1 ) << (2 + BitsPerComponent)) |
+           (quantize( kept_2 ) << (2 + 2 * BitsPerComponent));
+}
+
+/** Unpacks a Quaternion packed with pack_smallest_three()
+ *
+ *  @tparam BitsPerComponent Must match the one used for packing
+ *
+ *  @post output.isUnit() == true
+ *
+ *  @note The output may be the negation of the input to pack_smallest_three(),
+ *        which represents the same rotation.
+ *  @note Like pack_smallest_three() this is straight-line code
+ */
+template <class T, unsigned BitsPerComponent>
+inline Quaternion<T> unpack_smallest_three(std::uint64_t packed)
+{
+    static_assert( BitsPerComponent >= 2 && 2 + 3 * BitsPerComponent <= 64 );
+
+    constexpr std::uint64_t max_quantized = (std::uint64_t{1} << BitsPerComponent) - 1;
+    constexpr T             range         = std::numbers::sqrt2_v<T> / T{2}; // 1 / sqrt(2)
+    constexpr T             scale         = T{2} * range / T(max_quantized);
+
+    auto stored = [packed](const unsigned index) -> T
+        {
+            const std::uint64_t quantized{ (packed >> (2 + index * BitsPerComponent)) & max_quantized };
+
+            return static_cast<T>( static_cast<std::int32_t>( quantized ) ) * scale - range;
+        };
+
+    const std::uint32_t largest{ static_cast<std::uint32_t>( packed & 0x3 ) };
+    const T             stored_0{ stored( 0 ) }, stored_1{ stored( 1 ) }, stored_2{ stored( 2 ) };
+    const T             sum_of_squares{ stored_0 * stored_0 + stored_1 * stored_1 + stored_2 * stored_2 };
+
+    // Only rescale when rounding pushed the stored components past unit length.  The square roots
+    // are the fast ones at high precision because std::sqrt can set errno, which is a branch.
+    const T missing{ T{1} - sum_of_squares };
+    const T dropped{ fast::sqrt<fast::Precision::High>( fast::select( missing > T{0}, missing, T{0} ) ) };
+    const T renormalize{ fast::select( sum_of_squares > T{1}, fast::rsqrt<fast::Precision::High>( sum_of_squares ), T{1} ) };
+
+    // The stored components skip over the largest one
+    return Quaternion<T>{ fast::select( largest == 0, dropped, stored_0 ) * renormalize,
+                          fast::select( largest == 1, dropped, fast::select( largest == 0, stored_0, stored_1 ) ) * renormalize,
+                          fast::select( largest == 2, dropped, fast::select( largest <= 1, stored_1, stored_2 ) ) * renormalize,
+                          fast::select( largest == 3, dropped, stored_2 ) * renormalize };
+}
+
+
+/** A 48-bit packed Quaternion
+ *
+ *  @note This is kept as three 16-bit words so that arrays of them take exactly 6 bytes each
+ */
+struct PackedQuaternion48
+{
+    std::uint16_t words[3];
+
+    bool operator==(const PackedQuaternion48 &) const = default;
+};
+
+/** Describes a smallest three format that packs into 4 bytes
+ *
+ *  @see compress_quaternion(), decompress_quaternion()
+ */
+struct SmallestThree32
+{
+    using packed_type = std::uint32_t;
+
+    constexpr static unsigned bits_per_component = 10;
+
+    constexpr static packed_type   store(std::uint64_t bits) { return static_cast<packed_type>( bits ); }
+    constexpr static std::uint64_t load(packed_type packed)  { return packed; }
+};
+
+/** Describes a smallest three format that packs into 6 bytes
+ *
+ *  @see compress_quaternion(), decompress_quaternion()
+ */
+struct SmallestThree48
+{
+    using packed_type = PackedQuaternion48;
+
+    constexpr static unsigned bits_per_component = 15;
+
+    constexpr static packed_type store(std::uint64_t bits)
+    {
+        return { { static_cast<std::uint16_t>( bits ), static_cast<std::uint16_t>( bits >> 16 ), static_cast<std::uint16_t>( bits >> 32 ) } };
+    }
+
+    constexpr static std::uint64_t load(packed_type packed)
+    {
+        return std::uint64_t{ packed.words[0] } | (std::uint64_t{ packed.words[1] } << 16) | (std::uint64_t{ packed.words[2] } << 32);
+    }
+};
+
+/** Describes a smallest three format that packs into 8 bytes
+ *
+ *  @see compress_quaternion(), decompress_quaternion()
+ */
+struct SmallestThree64
+{
+    using packed_type = std::uint64_t;
+
+    constexpr static unsigned bits_per_component = 20;
+
+    constexpr static packed_type   store(std::uint64_t bits) { return bits; }
+    constexpr static std::uint64_t load(packed_type packed)  { return packed; }
+};
+
+/** The largest error in any component of a Quaternion compressed with @p Format
+ *
+ *  @note Compare the components after making the signs of the input and output agree,
+ *        i.e. after negating the output when dot( input, output ) < 0.
+ */
+template <class Format, class T = float>
+constexpr T max_compression_error()
+{
+    constexpr T half_step = std::numbers::sqrt2_v<T> / T{2} / T((std::uint64_t{1} << Format::bits_per_component) - 1);
+
+    return T{3} * half_step;
+}
+
+/** Compresses a unit Quaternion into @p Format
+ *
+ *  @tparam Format One of SmallestThree32, SmallestThree48 or SmallestThree64
+ *
+ *  @pre @p rotation is a unit Quaternion
+ */
+template <class Format, class T>
+typename Format::packed_type compress_quaternion(const Quaternion<T> &rotation)
+{
+    return Format::store( pack_smallest_three<Format::bits_per_component>( rotation ) );
+}
+
+/** Decompresses a Quaternion made by compress_quaternion()
+ *
+ *  @tparam Format Must match the one used for compressing
+ *
+ *  @post output.isUnit() == true
+ *
+ *  @note The output may be the negation of the original, which represents the same rotation
+ */
+template <class Format, class T>
+Quaternion<T> decompress_quaternion(typename Format::packed_type packed)
+{
+    return unpack_smallest_three<T, Format::bits_per_component>( Format::load( packed ) );
+}
+
+/** Compresses each Quaternion of @p rotations into @p output
+ *
+ *  This is a plain loop over compress_quaternion().  Storing the rotations as
+ *  QuaternionArrays instead lets compilers vectorize it.
+ *
+ *  @pre @p output is at least as large as @p rotations
+ *  @pre @p rotations are all unit Quaternions
+ */
+template <class Format, class T>
+void compress_quaternions(std::span<const Quaternion<T>> rotations, std::span<typename Format::packed_type> output)
+{
+    assert( output.size() >= rotations.size() );
+
+    const std::size_t count = rotations.size();
+
+    for (std::size_t i = 0; i < count; ++i)
+        output[i] = compress_quaternion<Format>( rotations[i] );
+}
+
+/** Decompresses each of @p packed into @p output
+ *
+ *  This is a plain loop over decompress_quaternion().  Storing the output as
+ *  QuaternionArrays instead lets compilers vectorize it.
+ *
+ *  @pre @p output is at least as large as @p packed
+ */
+template <class Format, class T>
+void decompress_quaternions(std::span<const typename Format::packed_type> packed, std::span<Quaternion<T>> output)
+{
+    assert( output.size() >= packed.size() );
+
+    const std::size_t count = packed.size();
+
+    for (std::size_t i = 0; i < count; ++i)
+        output[i] = decompress_quaternion<Format, T>( packed[i] );
+}
+
+/** Compresses the Quaternions in @p rotations, which are stored one array per component, into @p output
+ *
+ *  There are no data-dependent branches in the loop, so compilers can vectorize it with
+ *  the default floating-point flags (checked with GCC 12 at @c -O3).  The results are
+ *  the same as compress_quaternion()'s.
+ *
+ *  @pre @p output is at least as large as @p rotations
+ *  @pre @p rotations are all unit Quaternions
+ */
+template <class Format, class T>
+void compress_quaternions(QuaternionArrays<const T> rotations, std::span<typename Format::packed_type> output)
+{
+    assert( rotations.i.size() == rotations.size() && rotations.j.size() == rotations.size() && rotations.k.size() == rotations.size() );
+    assert( output.size() >= rotations.size() );
+
+    const std::size_t count = rotations.size();
+
+    for (std::size_t n = 0; n < count; ++n)
+        output[n] = compress_quaternion<Format>( Quaternion<T>{ rotations.w[n], rotations.i[n], rotations.j[n], rotations.k[n] } );
+}
+
+/** Decompresses each of @p packed into @p output, which is stored one array per component
+ *
+ *  There are no data-dependent branches or calls that can set @c errno in the loop, so
+ *  compilers can vectorize it with the default floating-point flags (checked with GCC 12
+ *  at @c -O3).  The results are the same as decompress_quaternion()'s.
+ *
+ *  @pre @p output is at least as large as @p packed
+ */
+template <class Format, class T>
+void decompress_quaternions(std::span<const typename Format::packed_type> packed, QuaternionArrays<T> output)
+{
+    assert( output.i.size() == output.size() && output.j.size() == output.size() && output.k.size() == output.size() );
+    assert( output.size() >= packed.size() );
+
+    const std::size_t count = packed.size();
+
+    for (std::size_t n = 0; n < count; ++n)
+    {
+        const Quaternion<T> rotation{ decompress_quaternion<Format, T>( packed[n] ) };
+
+        output.w[n] = rotation.w();
+        output.i[n] = rotation.i();
+        output.j[n] = rotation.j();
+        output.k[n] = rotation.k();
+    }
+}
+/// @}  {QuaternionCompression}
+
+}
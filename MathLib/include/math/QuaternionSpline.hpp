@@ -0,0 +1,235 @@
+#pragma once
+
+#include "math/Quaternion.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+
+/** @file
+ *
+ *  Contains smooth interpolation through a sequence of rotations
+ *
+ *  @hideincludegraph
+ */
+
+namespace Math
+{
+
+/** @addtogroup QuaternionSplines Quaternion Splines
+ *
+ *  Curves through a sequence of unit Quaternions that, unlike a chain of slerp() calls,
+ *  have a continuous angular velocity at every key.
+ *
+ *  Both kinds of curve need extra control points for each key that depend on its
+ *  neighbours.  These use log() and exp(), so they are best computed once and stored,
+ *  as QuaternionSpline does.  Evaluating a curve afterwards only takes slerp() calls.
+ *
+ *  @{
+ */
+
+/** Computes the inner control point of @p current for squad()
+ *
+ *  @param previous The key before @p current
+ *  @param current  The key to compute the control point of
+ *  @param next     The key after @p current
+ *
+ *  @pre All inputs are unit Quaternions on the same hemisphere as @p current
+ *
+ *  @note For the first and last keys, pass the key itself as the missing neighbour
+ */
+template <class T>
+Quaternion<T> squad_control_point(const Quaternion<T> &previous, const Quaternion<T> &current, const Quaternion<T> &next)
+{
+    const Quaternion<T> inverse{ current.conjugate() };
+    const Quaternion<T> tangent{ ((inverse * next).log() + (inverse * previous).log()) * T{-0.25} };
+
+    return (current * tangent.exp()).normalized();
+}
+
+/** Spherical quadrangle interpolation between two keys
+ *
+ *  @param begin         The key at 0
+ *  @param end           The key at 1
+ *  @param begin_control squad_control_point() of @p begin
+ *  @param end_control   squad_control_point() of @p end
+ *  @param percent       [0..1] Represents the percentage to interpolate
+ *
+ *  @note This only takes 3 slerp() calls
+ */
+template <class T>
+Quaternion<T> squad(const Quaternion<T> &begin, const Quaternion<T> &end,
+                    const Quaternion<T> &begin_control, const Quaternion<T> &end_control,
+                    const T percent)
+{
+    return slerp( slerp( begin, end, percent ),
+                  slerp( begin_control, end_control, percent ),
+                  T{2} * percent * (T{1} - percent) );
+}
+
+/** Computes the two Bézier control points of @p current for a Catmull-Rom spline
+ *
+ *  The tangent at @p current is half the difference between @p next and @p previous,
+ *  measured in the frame of @p current.
+ *
+ *  @param previous The key before @p current
+ *  @param current  The key to compute the control points of
+ *  @param next     The key after @p current
+ *  @param incoming Set to the control point used by the segment ending at @p current
+ *  @param outgoing Set to the control point used by the segment starting at @p current
+ *
+ *  @pre All inputs are unit Quaternions on the same hemisphere as @p current
+ *
+ *  @note For the first and last keys, pass the key itself as the missing neighbour
+ */
+template <class T>
+void catmull_rom_control_points(const Quaternion<T> &previous, const Quaternion<T> &current, const Quaternion<T> &next,
+                                Quaternion<T> &incoming, Quaternion<T> &outgoing)
+{
+    const Quaternion<T> inverse{ current.conjugate() };
+    const Quaternion<T> tangent{ ((inverse * next).log() - (inverse * previous).log()) / T{6} };
+
+    incoming = (current * (-tangent).exp()).normalized();
+    outgoing = (current * tangent.exp()).normalized();
+}
+
+/** Evaluates a cubic Bézier curve of rotations with De Casteljau's algorithm
+ *
+ *  @param begin            The key at 0
+ *  @param begin_outgoing   The outgoing control point of @p begin
+ *  @param end_incoming     The incoming control point of @p end
+ *  @param end              The key at 1
+ *  @param percent          [0..1] Represents the percentage to interpolate
+ *
+ *  @note This takes 6 slerp() calls
+ */
+template <class T>
+Quaternion<T> bezier(const Quaternion<T> &begin, const Quaternion<T> &begin_outgoing,
+                     const Quaternion<T> &end_incoming, const Quaternion<T> &end,
+                     const T percent)
+{
+    const Quaternion<T> a{ slerp( begin, begin_outgoing, percent ) };
+    const Quaternion<T> b{ slerp( begin_outgoing, end_incoming, percent ) };
+    const Quaternion<T> c{ slerp( end_incoming, end, percent ) };
+
+    return slerp( slerp( a, b, percent ), slerp( b, c, percent ), percent );
+}
+
+
+/** A smooth curve through a sequence of rotations
+ *
+ *  The control points of every key are computed once when the spline is created, so
+ *  evaluating it never calls log() or exp().  The curve goes through every key, which
+ *  are spaced one unit of the curve's parameter apart.
+ *
+ *  @headerfile "math/QuaternionSpline.hpp"
+ */
+template <class T>
+class QuaternionSpline
+{
+public:
+    enum class Kind
+    {
+        Squad,      ///< squad() between keys.  3 slerps to evaluate.
+        CatmullRom  ///< Cubic Bézier segments with Catmull-Rom tangents.  6 slerps to evaluate.
+    };
+
+    QuaternionSpline() = default;
+
+    /** Creates a spline through @p keys
+     *
+     *  @pre @p keys are unit Quaternions
+     *
+     *  @note Keys are flipped where needed so that each one is on the same hemisphere as
+     *        the one before it, so the curve always takes the shortest way between keys.
+     */
+    explicit QuaternionSpline(std::vector<Quaternion<T>> keys, Kind kind = Kind::CatmullRom)
+        :
+        _keys{ std::move( keys ) },
+        _controls( 2 * _keys.size() ),
+        _kind{ kind }
+    {
+        for (std::size_t i = 1; i < _keys.size(); ++i)
+        {
+            if ( dot( _keys[i - 1], _keys[i] ) < T{0} )
+                _keys[i] = -_keys[i];
+        }
+
+        for (std::size_t i = 0; i < _keys.size(); ++i)
+        {
+            const Quaternion<T> &previous{ _keys[(i > 0) ? i - 1 : i] };
+            const Quaternion<T> &next{ _keys[(i + 1 < _keys.size()) ? i + 1 : i] };
+
+            if ( _kind == Kind::Squad )
+                _controls[2 * i] = _controls[2 * i + 1] = squad_control_point( previous, _keys[i], next );
+            else
+                catmull_rom_control_points( previous, _keys[i], next, _controls[2 * i], _controls[2 * i + 1] );
+        }
+    }
+
+    Kind kind() const { return _kind; }
+
+    /// The keys, after being flipped onto the same hemisphere as each other
+    std::span<const Quaternion<T>> keys() const { return _keys; }
+
+    std::size_t size() const { return _keys.size(); }
+
+    bool empty() const { return _keys.empty(); }
+
+    /** Evaluates the curve between key @p segment and the one after it
+     *
+     *  @param segment The index of the key at the start of the segment
+     *  @param percent [0..1] Represents the percentage to interpolate
+     *
+     *  @pre @p segment + 1 < size()
+     */
+    Quaternion<T> evaluate(std::size_t segment, const T percent) const
+    {
+        assert( segment + 1 < size() );
+
+        if ( _kind == Kind::Squad )
+            return squad( _keys[segment], _keys[segment + 1], _controls[2 * segment + 1], _controls[2 * segment + 2], percent );
+        return bezier( _keys[segment], _controls[2 * segment + 1], _controls[2 * segment + 2], _keys[segment + 1], percent );
+    }
+
+    /** Evaluates the curve at @p parameter, where key i is at i
+     *
+     *  @pre The spline is not empty
+     *
+     *  @note The parameter is clamped to [0..size() - 1]
+     */
+    Quaternion<T> evaluate(const T parameter) const
+    {
+        assert( !empty() );
+
+        if ( parameter <= T{0} || size() == 1 )
+            return _keys.front();
+        if ( parameter >= T(size() - 1) )
+            return _keys.back();
+
+        const std::size_t segment{ std::min( static_cast<std::size_t>( parameter ), size() - 2 ) };
+
+        return evaluate( segment, parameter - T(segment) );
+    }
+private:
+    std::vector<Quaternion<T>> _keys;
+    std::vector<Quaternion<T>> _controls; // The incoming and outgoing control points of each key, interleaved
+    Kind                       _kind = Kind::CatmullRom;
+};
+/// @}  {QuaternionSplines}
+
+
+/** @name Type Aliases
+ *
+ *  @relates QuaternionSpline
+ *
+ *  @{
+ */
+using QuaternionSplinef = QuaternionSpline<float>;
+using QuaternionSplined = QuaternionSpline<double>;
+/// @}
+
+}
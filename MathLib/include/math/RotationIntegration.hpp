@@ -0,0 +1,218 @@
+#pragma once
+
+#include "math/Quaternion.hpp"
+#include "math/Vector3D.hpp"
+#include "math/FastMath.hpp"
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+/** @file
+ *
+ *  Contains functions for integrating angular velocities into rotations
+ *
+ *  @hideincludegraph
+ */
+
+namespace Math
+{
+
+/** @addtogroup RotationIntegration Rotation Integration
+ *
+ *  Steps the orientation @f$ q @f$ of a body spinning with angular velocity @f$ \omega @f$
+ *  forward in time by solving @f$ \dot{q} = \frac{1}{2} \omega q @f$ (or
+ *  @f$ \dot{q} = \frac{1}{2} q \omega @f$ when @f$ \omega @f$ is in the body's own frame).
+ *
+ *  With @f$ \omega @f$ held constant over a step, every method amounts to multiplying
+ *  @f$ q @f$ by @f$ a + b \omega @f$ for some scalars @f$ a @f$ and @f$ b @f$ that only
+ *  depend on the step and @f$ |\omega| @f$, so they cost about the same:
+ *
+ *  | Method         | a                                                                 | b                                                  |
+ *  | -------------- | ----------------------------------------------------------------- | -------------------------------------------------- |
+ *  | Euler          | @f$ 1 @f$                                                         | @f$ \frac{h}{2} @f$                                |
+ *  | RungeKutta4    | @f$ 1 - \frac{h^2 |\omega|^2}{8} + \frac{h^4 |\omega|^4}{384} @f$ | @f$ \frac{h}{2} - \frac{h^3 |\omega|^2}{48} @f$    |
+ *  | ExponentialMap | @f$ \cos \frac{h |\omega|}{2} @f$                                 | @f$ \frac{\sin \frac{h |\omega|}{2}}{|\omega|} @f$ |
+ *
+ *  The exponential map is exact for a constant angular velocity, which is the same
+ *  as @c exp( Quaternion::make_pure( omega * h / 2 ) ) * q.  The result is always
+ *  renormalized as part of the same step.
+ *
+ *  The batched functions work on a structure of arrays, one array per component, and
+ *  have no data-dependent branches.  Every function takes an optional policy after the
+ *  method, which supplies the square roots and the trigonometry (see @ref MathPolicies).
+ *  With one of the fast:: policies the batched loop vectorizes with the default
+ *  floating-point flags (checked with GCC 12 at @c -O3).  With StandardMath the Euler and
+ *  RungeKutta4 loops also need @c -fno-math-errno, since @c std::sqrt can set @c errno,
+ *  and the ExponentialMap loop doesn't vectorize because of its calls to @c std::sin and
+ *  @c std::cos.
+ *
+ *  @{
+ */
+
+enum class RotationIntegrator
+{
+    Euler,          ///< First order
+    RungeKutta4,    ///< Fourth order
+    ExponentialMap  ///< Exact for a constant angular velocity
+};
+
+/// The frame that angular velocities are expressed in
+enum class AngularVelocityFrame
+{
+    World,  ///< @f$ \dot{q} = \frac{1}{2} \omega q @f$
+    Body    ///< @f$ \dot{q} = \frac{1}{2} q \omega @f$
+};
+
+/** The components of many Vector3Ds, one array per component
+ *
+ *  @note All of the arrays must be the same size
+ */
+template <class T>
+struct Vector3DArrays
+{
+    std::span<const T> x, y, z;
+
+    std::size_t size() const { return x.size(); }
+};
+
+/** Computes the scalars @p a and @p b such that one step multiplies the rotation by @f$ a + b \omega @f$
+ *
+ *  @param angular_speed_squared @f$ |\omega|^2 @f$
+ *  @param time_step             The length of the step
+ *  @param a                     Set to the scalar part of the multiplier
+ *  @param b                     Set to the factor of @f$ \omega @f$ in the multiplier
+ */
+template <RotationIntegrator Method, class Policy = StandardMath, class T>
+MATHLIB_FORCE_INLINE void rotation_step_coefficients(const T angular_speed_squared, const T time_step, T &a, T &b)
+{
+    const T half_step{ T{0.5} * time_step };
+
+    if constexpr ( Method == RotationIntegrator::Euler )
+    {
+        a = T{1};
+        b = half_step;
+    }
+    else if constexpr ( Method == RotationIntegrator::RungeKutta4 )
+    {
+        const T x{ half_step * half_step * angular_speed_squared }; // (h |w| / 2)^2
+
+        a = T{1} - x * (T{0.5} - x / T{24});
+        b = half_step * (T{1} - x / T{6});
+    }
+    else
+    {
+        const T x{ half_step * half_step * angular_speed_squared }; // (h |w| / 2)^2
+        const T half_angle{ Policy::sqrt( x ) };
+        T       sine, cosine;
+
+        Policy::sincos( half_angle, sine, cosine );
+
+        // sin(angle) / angle, without dividing by zero or branching around the division
+        const bool small_angle{ x < T{1e-8} };
+        const T    sine_over_angle{ fast::select( small_angle, T{1} - x / T{6}, sine / fast::select( small_angle, T{1}, half_angle ) ) };
+
+        a = cosine;
+        b = half_step * sine_over_angle;
+    }
+}
+
+/** Steps a single rotation forward in time
+ *
+ *  @param rotation         The rotation at the start of the step
+ *  @param angular_velocity The angular velocity over the step, in radians per unit of time
+ *  @param time_step        The length of the step
+ *  @param frame            The frame @p angular_velocity is expressed in
+ *
+ *  @return The normalized rotation at the end of the step
+ */
+template <RotationIntegrator Method, class Policy = StandardMath, class T>
+Quaternion<T> integrate_rotation(const Quaternion<T>        &rotation,
+                                 const Vector3D<T>          &angular_velocity,
+                                 const T                     time_step,
+                                 const AngularVelocityFrame  frame = AngularVelocityFrame::World)
+{
+    T a, b;
+
+    rotation_step_coefficients<Method, Policy>( angular_velocity.magnitudeSquared(), time_step, a, b );
+
+    const Quaternion<T> step{ a, b * angular_velocity.x, b * angular_velocity.y, b * angular_velocity.z };
+    const Quaternion<T> stepped{ (frame == AngularVelocityFrame::World) ? step * rotation : rotation * step };
+
+    return stepped * Policy::rsqrt( stepped.normSquared() );
+}
+
+/** Steps many rotations forward in time, in place
+ *
+ *  @param rotations          The rotations to update
+ *  @param angular_velocities The angular velocity of each rotation, in radians per unit of time
+ *  @param time_step          The length of the step
+ *  @param frame              The frame @p angular_velocities are expressed in
+ *
+ *  @pre @p rotations and @p angular_velocities are the same size
+ *  @pre @p rotations are unit Quaternions
+ *  @pre None of the arrays overlap
+ */
+template <RotationIntegrator Method, class Policy = StandardMath, class T>
+void integrate_rotations(QuaternionArrays<T>         rotations,
+                         Vector3DArrays<T>           angular_velocities,
+                         const T                     time_step,
+                         const AngularVelocityFrame  frame = AngularVelocityFrame::World)
+{
+    assert( rotations.i.size() == rotations.size() && rotations.j.size() == rotations.size() && rotations.k.size() == rotations.size() );
+    assert( angular_velocities.size() == rotations.size() );
+    assert( angular_velocities.y.size() == rotations.size() && angular_velocities.z.size() == rotations.size() );
+
+    const std::size_t count = rotations.size();
+
+    // Instantiated once per frame so that the choice isn't made inside the loop.  The arrays are restrict
+    // parameters because there are too many pairs of them for compilers to check for overlap at run time.
+    auto step_all = [count, time_step](auto                       body_frame,
+                                       T       * MATHLIB_RESTRICT rotation_w,
+                                       T       * MATHLIB_RESTRICT rotation_i,
+                                       T       * MATHLIB_RESTRICT rotation_j,
+                                       T       * MATHLIB_RESTRICT rotation_k,
+                                       const T * MATHLIB_RESTRICT velocity_x,
+                                       const T * MATHLIB_RESTRICT velocity_y,
+                                       const T * MATHLIB_RESTRICT velocity_z)
+        {
+            for (std::size_t n = 0; n < count; ++n)
+            {
+                const T x{ velocity_x[n] };
+                const T y{ velocity_y[n] };
+                const T z{ velocity_z[n] };
+                const T qw{ rotation_w[n] };
+                const T qi{ rotation_i[n] };
+                const T qj{ rotation_j[n] };
+                const T qk{ rotation_k[n] };
+                T       a, b;
+
+                rotation_step_coefficients<Method, Policy>( x * x + y * y + z * z, time_step, a, b );
+
+                // (a + b w) q for the world frame and q (a + b w) for the body frame only differ in the sign of the cross product
+                const T cross_sign{ decltype(body_frame)::value ? T{-1} : T{1} };
+                const T bx{ b * x }, by{ b * y }, bz{ b * z };
+                const T w{ a * qw - (bx * qi + by * qj + bz * qk) };
+                const T i{ a * qi + qw * bx + cross_sign * (by * qk - bz * qj) };
+                const T j{ a * qj + qw * by + cross_sign * (bz * qi - bx * qk) };
+                const T k{ a * qk + qw * bz + cross_sign * (bx * qj - by * qi) };
+                const T inverse_norm{ Policy::rsqrt( w * w + i * i + j * j + k * k ) };
+
+                rotation_w[n] = w * inverse_norm;
+                rotation_i[n] = i * inverse_norm;
+                rotation_j[n] = j * inverse_norm;
+                rotation_k[n] = k * inverse_norm;
+            }
+        };
+
+    if ( frame == AngularVelocityFrame::World )
+        step_all( std::false_type{}, rotations.w.data(), rotations.i.data(), rotations.j.data(), rotations.k.data(),
+                  angular_velocities.x.data(), angular_velocities.y.data(), angular_velocities.z.data() );
+    else
+        step_all( std::true_type{}, rotations.w.data(), rotations.i.data(), rotations.j.data(), rotations.k.data(),
+                  angular_velocities.x.data(), angular_velocities.y.data(), angular_velocities.z.data() );
+}
+/// @}  {RotationIntegration}
+
+}
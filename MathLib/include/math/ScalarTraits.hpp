@@ -0,0 +1,60 @@
+#pragma once
+
+#include <type_traits>
+
+
+/** @file
+ *  
+ *  Contains the traits that describe the number types the math classes can be built on
+ *
+ *  @hideincludegraph
+ */
+
+namespace Math
+{
+
+/** @addtogroup ScalarTraits Scalar Traits
+ * 
+ *  Quaternion, DualQuaternion and Vector3D only need their components to behave like real
+ *  numbers, so they also work with the dual numbers of @ref AutomaticDifferentiation in
+ *  place of @c float or @c double.  These traits tell such scalars apart from the other
+ *  types that are used as components, like the Quaternions inside a Dual, and give the
+ *  plain number underneath them for tolerances, limits and the like.
+ * 
+ *  A number type opts in by specializing scalar_traits.
+ * 
+ *  @{
+ */
+
+/** Describes a type that can be used as a scalar
+ * 
+ *  The general case covers the floating-point types.
+ */
+template <class T>
+struct scalar_traits
+{
+    using real_type = T; ///< The plain number underneath, used for tolerances and limits
+
+    constexpr static bool is_scalar = std::is_floating_point_v<T>; ///< Whether @p T behaves like a real number
+
+    /// The plain value of @p input, without any derivatives it carries
+    constexpr static real_type value(const T &input) { return input; }
+};
+
+/// @c true if @p T behaves like a real number
+template <class T>
+inline constexpr bool is_scalar_v = scalar_traits<T>::is_scalar;
+
+/// The plain number underneath @p T
+template <class T>
+using real_type_t = typename scalar_traits<T>::real_type;
+
+/// The plain value of @p input, without any derivatives it carries
+template <class T>
+constexpr real_type_t<T> value_of(const T &input)
+{
+    return scalar_traits<T>::value( input );
+}
+/// @}
+
+}
\ No newline at end of file
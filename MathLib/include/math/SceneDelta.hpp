@@ -0,0 +1,288 @@
+#pragma once
+
+#include "math/HierarchicalCoordinateSystem.hpp"
+#include "math/QuaternionCompression.hpp"
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+
+/** @file
+ *
+ *  Contains the encoder and decoder for streams of changes to the local transforms
+ *  of a HierarchicalCoordinateSystem
+ *
+ *  Each message of a stream holds the nodes whose transform changed since a given
+ *  version of the hierarchy:
+ *
+ *  | Field                 | Encoding                                                    |
+ *  | --------------------- | ----------------------------------------------------------- |
+ *  | tag                   | 1 byte, SceneDeltaEncoding::message_tag                      |
+ *  | since version         | varint                                                      |
+ *  | to version            | varint                                                      |
+ *  | translation precision | 4 bytes, little-endian IEEE-754 float                       |
+ *  | node count            | varint                                                      |
+ *  | per node: index       | varint, the gap to the previous index minus one             |
+ *  | per node: rotation    | 6 bytes, little-endian, smallest three with 15 bits each    |
+ *  | per node: translation | 3 zig-zag varints, in multiples of the translation precision |
+ *
+ *  Nodes are identified by their index in HierarchicalCoordinateSystem::visitPreOrder(),
+ *  the same as in a hierarchy snapshot, so both ends must have the same structure.
+ *  A snapshot followed by a stream of deltas is a complete replay log.
+ *
+ *  @hideincludegraph
+ */
+
+/** Low-level pieces of the delta stream format
+ *
+ */
+namespace SceneDeltaEncoding
+{
+
+constexpr std::byte     message_tag{ 0xD5 };
+constexpr unsigned      rotation_bits_per_component = Math::SmallestThree48::bits_per_component;
+constexpr std::size_t   rotation_bytes              = 6;
+
+inline void write_varint(std::vector<std::byte> &stream, std::uint64_t value)
+{
+    while ( value >= 0x80 )
+    {
+        stream.push_back( static_cast<std::byte>( (value & 0x7F) | 0x80 ) );
+        value >>= 7;
+    }
+    stream.push_back( static_cast<std::byte>( value ) );
+}
+
+inline std::optional<std::uint64_t> read_varint(std::span<const std::byte> stream, std::size_t &position)
+{
+    std::uint64_t value = 0;
+
+    for (unsigned shift = 0; shift < 64; shift += 7)
+    {
+        if ( position >= stream.size() )
+            return std::nullopt;
+
+        std::uint64_t next_byte = std::to_integer<std::uint64_t>( stream[position++] );
+
+        value |= (next_byte & 0x7F) << shift;
+
+        if ( (next_byte & 0x80) == 0 )
+            return value;
+    }
+    return std::nullopt;
+}
+
+inline std::uint64_t zigzag(std::int64_t value)
+{
+    return (static_cast<std::uint64_t>( value ) << 1) ^ static_cast<std::uint64_t>( value >> 63 );
+}
+
+inline std::int64_t unzigzag(std::uint64_t value)
+{
+    return static_cast<std::int64_t>( value >> 1 ) ^ -static_cast<std::int64_t>( value & 1 );
+}
+
+inline void write_little_endian(std::vector<std::byte> &stream, std::uint64_t value, std::size_t byte_count)
+{
+    for (std::size_t i = 0; i < byte_count; ++i)
+        stream.push_back( static_cast<std::byte>( (value >> (8 * i)) & 0xFF ) );
+}
+
+inline std::optional<std::uint64_t> read_little_endian(std::span<const std::byte> stream, std::size_t &position, std::size_t byte_count)
+{
+    if ( stream.size() - position < byte_count )
+        return std::nullopt;
+
+    std::uint64_t value = 0;
+
+    for (std::size_t i = 0; i < byte_count; ++i)
+        value |= std::to_integer<std::uint64_t>( stream[position++] ) << (8 * i);
+    return value;
+}
+
+}
+
+
+/** Appends the changes to the local transforms of @p hierarchy since @p since_version to @p stream
+ *
+ *  @param hierarchy             The hierarchy to encode
+ *  @param since_version         Only nodes changed after this version are written.  Use 0 for all of them.
+ *  @param stream                The message is appended to the end of it
+ *  @param translation_precision The translations are rounded to multiples of this
+ *
+ *  @return The version that a receiver is brought up to.  Pass this as @p since_version next time.
+ *
+ *  @note Rotations are quantized to 15 bits for each of the smallest three components,
+ *        which is within 0.0001 of the original for each component.
+ *
+ *  @see SceneDeltaDecoder
+ */
+template <class Type>
+std::uint64_t encode_scene_delta(const HierarchicalCoordinateSystem<Type> &hierarchy,
+                                 const std::uint64_t                       since_version,
+                                 std::vector<std::byte>                   &stream,
+                                 const Type                                translation_precision = Type{1} / Type{1024})
+{
+    using namespace SceneDeltaEncoding;
+
+    assert( translation_precision > Type{0} );
+
+    const std::uint64_t to_version{ hierarchy.version() };
+    const float         precision{ static_cast<float>( translation_precision ) };
+
+    stream.push_back( message_tag );
+    write_varint( stream, since_version );
+    write_varint( stream, to_version );
+    write_little_endian( stream, std::bit_cast<std::uint32_t>( precision ), 4 );
+
+    // The count isn't known yet, so gather the changed nodes first
+    std::vector<std::pair<std::int32_t, const SceneNode<Type> *>> changed;
+
+    hierarchy.visitPreOrder( [&](const SceneNode<Type> &node, std::int32_t index, std::int32_t)
+        {
+            if ( node.version() > since_version )
+                changed.emplace_back( index, &node );
+        } );
+
+    write_varint( stream, changed.size() );
+
+    std::int32_t previous_index = -1;
+
+    for (auto [index, node] : changed)
+    {
+        const Math::DualQuaternion<Type> &transform{ node->coordinate_system() };
+        Math::Vector3D<Type>              translation{ transform.translation() };
+
+        write_varint( stream, static_cast<std::uint64_t>( index - previous_index - 1 ) );
+        write_little_endian( stream, Math::pack_smallest_three<rotation_bits_per_component>( transform.rotation() ), rotation_bytes );
+        write_varint( stream, zigzag( std::llround( translation.x / Type(precision) ) ) );
+        write_varint( stream, zigzag( std::llround( translation.y / Type(precision) ) ) );
+        write_varint( stream, zigzag( std::llround( translation.z / Type(precision) ) ) );
+        previous_index = index;
+    }
+
+    return to_version;
+}
+
+
+/** Applies messages made by encode_scene_delta() to a hierarchy
+ *
+ *  The nodes of the hierarchy are looked up once and kept, so applying a message
+ *  only touches the nodes that it contains.
+ *
+ *  @headerfile "math/SceneDelta.hpp"
+ */
+template <class Type>
+class SceneDeltaDecoder
+{
+public:
+    /** Creates a decoder applying changes to @p hierarchy
+     *
+     *  @param hierarchy The hierarchy to apply the changes to
+     *  @param version   The version of the sender that @p hierarchy already matches, e.g. the
+     *                   one it had when the snapshot @p hierarchy was loaded from was made
+     *
+     *  @note @p hierarchy must outlive the decoder
+     */
+    explicit SceneDeltaDecoder(HierarchicalCoordinateSystem<Type> &hierarchy, const std::uint64_t version = 0)
+        :
+        _hierarchy{ hierarchy },
+        _version{ version }
+    {
+        refresh();
+    }
+
+    /** Looks up the nodes of the hierarchy again
+     *
+     *  @note Must be called after adding or removing nodes
+     */
+    void refresh()
+    {
+        _nodes.clear();
+        _hierarchy.visitPreOrder( [this](SceneNode<Type> &node, std::int32_t, std::int32_t) { _nodes.push_back( &node ); } );
+    }
+
+    /** Applies the message at the start of @p stream to the local transforms of the hierarchy
+     *
+     *  Messages have to be applied in the order they were encoded: one is only accepted
+     *  if it starts from version(), so repeated and out of order messages are rejected.
+     *
+     *  @return The number of bytes the message takes up, or @c std::nullopt if it is malformed
+     *          or doesn't follow on from version().  Rejected messages change nothing.
+     */
+    std::optional<std::size_t> apply(std::span<const std::byte> stream)
+    {
+        using namespace SceneDeltaEncoding;
+
+        std::size_t position = 0;
+
+        if ( stream.empty() || stream[position++] != message_tag )
+            return std::nullopt;
+
+        std::optional<std::uint64_t> since_version{ read_varint( stream, position ) };
+        std::optional<std::uint64_t> to_version{ read_varint( stream, position ) };
+        std::optional<std::uint64_t> precision_bits{ read_little_endian( stream, position, 4 ) };
+        std::optional<std::uint64_t> count{ read_varint( stream, position ) };
+
+        if ( !since_version || !to_version || !precision_bits || !count )
+            return std::nullopt;
+
+        if ( *since_version != _version || *to_version < *since_version || *count > _nodes.size() )
+            return std::nullopt;
+
+        const float precision{ std::bit_cast<float>( static_cast<std::uint32_t>( *precision_bits ) ) };
+
+        if ( !std::isfinite( precision ) || !(precision > 0.0f) )
+            return std::nullopt;
+
+        // Decode the whole message before touching the hierarchy, so that a malformed one changes nothing
+        std::size_t next_index = 0; // Indices only go up, so this is the smallest one left
+
+        _decoded.clear();
+
+        for (std::uint64_t i = 0; i < *count; ++i)
+        {
+            std::optional<std::uint64_t> gap{ read_varint( stream, position ) };
+            std::optional<std::uint64_t> rotation{ read_little_endian( stream, position, rotation_bytes ) };
+            std::optional<std::uint64_t> x{ read_varint( stream, position ) };
+            std::optional<std::uint64_t> y{ read_varint( stream, position ) };
+            std::optional<std::uint64_t> z{ read_varint( stream, position ) };
+
+            if ( !gap || !rotation || !x || !y || !z )
+                return std::nullopt;
+
+            if ( *gap >= _nodes.size() - next_index )
+                return std::nullopt;
+
+            const std::size_t    index{ next_index + static_cast<std::size_t>( *gap ) };
+            Math::Vector3D<Type> translation{ Type( unzigzag( *x ) ) * Type( precision ),
+                                              Type( unzigzag( *y ) ) * Type( precision ),
+                                              Type( unzigzag( *z ) ) * Type( precision ) };
+
+            if ( !std::isfinite( translation.x ) || !std::isfinite( translation.y ) || !std::isfinite( translation.z ) )
+                return std::nullopt;
+
+            _decoded.emplace_back( index, Math::DualQuaternion<Type>{ Math::unpack_smallest_three<Type, rotation_bits_per_component>( *rotation ), translation } );
+            next_index = index + 1;
+        }
+
+        for (const auto &[index, transform] : _decoded)
+            _nodes[index]->setCoordinateSystem( transform );
+
+        _version = *to_version;
+        return position;
+    }
+
+    /// The version of the sender after the last message that was applied
+    std::uint64_t version() const { return _version; }
+private:
+    HierarchicalCoordinateSystem<Type>                             &_hierarchy;
+    std::vector<SceneNode<Type> *>                                  _nodes;
+    std::vector<std::pair<std::size_t, Math::DualQuaternion<Type>>> _decoded; // Kept to reuse its memory
+    std::uint64_t                                                   _version = 0;
+};
\ No newline at end of file
@@ -1,10 +1,11 @@
 #pragma once
 
 #include "math/DualQuaternion.hpp"
+#include "math/SceneNodeRegistry.hpp"
 #include <memory>
 #include <vector>
 #include <algorithm>
-#include <string>
+#include <string_view>
 
 
 /** @file
@@ -41,6 +42,8 @@ class SceneNode : public std::enable_shared_from_this<SceneNode<Type>>
     struct Private { explicit Private() = default; };
 
 public:
+    using NameId = typename SceneNodeRegistry<Type>::NameId;
+
     /** Default constructor
      * 
      *  @note I only want some other class to be able to create these, which
@@ -57,16 +60,33 @@ public:
      */
     SceneNode(Private ,
               std::weak_ptr<SceneNode>  parent,
+              SceneNodeRegistry<Type>  *registry,
               const Math::Vector3D<Type>     &translation,
               const Math::Quaternion<Type>   &rotation,
-              const std::string        &name)
+              const NameId              name_id)
         :
         _coordinate_system{ Math::DualQuaternion<Type>::make_coordinate_system(rotation, translation.x, translation.y, translation.z) },
         _parent{parent},
-        _name{name}
+        _registry{registry},
+        _version{registry->nextVersion()},
+        _name_id{name_id}
+    {
+        _registry->add( _name_id, this );
+    }
+
+    SceneNode(const SceneNode &) = delete;
+    SceneNode &operator =(const SceneNode &) = delete;
+
+    /** Destructor
+     * 
+     *  Removes this node from the registry of the hierarchy it belongs to, and
+     *  frees the registry if this was its last node.
+     */
+    ~SceneNode()
     {
+        if ( _registry )
+            leaveRegistry();
     }
-    ~SceneNode() = default;
 
     /** @name Creation Functions
      *  @{
@@ -77,7 +97,12 @@ public:
      */
     static std::shared_ptr<SceneNode<Type>> make()
     {
-        return std::make_shared<SceneNode<Type>>(Private{});
+        std::shared_ptr<SceneNode<Type>> new_node = std::make_shared<SceneNode<Type>>(Private{});
+
+        new_node->_registry = new SceneNodeRegistry<Type>;
+        new_node->_version  = new_node->_registry->nextVersion();
+        new_node->_registry->add( new_node->_name_id, new_node.get() );
+        return new_node;
     }
     /// @}
 
@@ -86,22 +111,84 @@ public:
     const SceneNodeList<Type> &children() const { return _children; }
 
     const Math::DualQuaternion<Type> &coordinate_system() const { return _coordinate_system; }
-          Math::DualQuaternion<Type> &coordinate_system()       { return _coordinate_system; }
 
-    const std::string &name() const { return _name; }
-          std::string &name()       { return _name; }
+    /** Gives write access to the local transform of this node
+     * 
+     *  @note Changes made through here are not tracked by version().  Call
+     *        markChanged() after them, or use setCoordinateSystem() instead.
+     */
+    Math::DualQuaternion<Type> &coordinate_system() { return _coordinate_system; }
+
+    /** Replaces the local transform of this node and updates version()
+     */
+    void setCoordinateSystem(const Math::DualQuaternion<Type> &coordinate_system)
+    {
+        _coordinate_system = coordinate_system;
+        markChanged();
+    }
+
+    /** Records that the local transform of this node changed, by updating version()
+     * 
+     *  @see SceneNodeRegistry::nextVersion
+     */
+    void markChanged() { _version = _registry->nextVersion(); }
+
+    /** The version of the hierarchy when the transform of this node last changed
+     * 
+     *  @note Creating a node and moving it to another hierarchy count as changes.
+     * 
+     *  @see SceneNodeRegistry::version
+     */
+    std::uint64_t version() const { return _version; }
+
+    /** The name of this node
+     * 
+     *  @note The text is owned by the registry of the hierarchy.  The node itself
+     *        only stores the id of its name.
+     */
+    std::string_view name() const { return _registry->name( _name_id ); }
+
+    /// The id of the name of this node in its registry()
+    NameId nameId() const { return _name_id; }
+
+    /** Changes the name of this node
+     * 
+     *  @note The name is only changeable through here so that the registry
+     *        of the hierarchy stays in sync.
+     */
+    void setName(std::string_view new_name)
+    {
+        const NameId new_name_id{ _registry->intern( new_name ) };
+
+        if ( new_name_id == _name_id )
+            return;
+
+        // Added before the old name is removed, which may release it, since new_name may point into its text
+        _registry->add( new_name_id, this );
+        _registry->remove( _name_id, this );
+        _name_id = new_name_id;
+    }
+
+    /** The name index of the hierarchy this node belongs to
+     * 
+     *  @note All the nodes of the same tree share the same registry.
+     */
+    const SceneNodeRegistry<Type> &registry() const { return *_registry; }
 
     std::weak_ptr<SceneNode<Type>> createChildNode(const Math::Vector3D<Type>   &translation = Math::Vector3D<Type>::zero(),
                                                    const Math::Quaternion<Type> &rotation    = Math::Quaternion<Type>::identity(),
-                                                   const std::string      &name        = std::string())
+                                                   std::string_view              name        = std::string_view())
     {
-        std::shared_ptr<SceneNode<Type>> new_node = make( this->weak_from_this(), translation, rotation, name );
+        std::shared_ptr<SceneNode<Type>> new_node = make( this->weak_from_this(), _registry, translation, rotation, _registry->intern( name ) );
 
         _children.push_back( new_node );
         return new_node;
     }
 
-    /** Removes the given SceneNode from its list of children */
+    /** Removes the given SceneNode from its list of children
+     * 
+     *  @note The detached subtree gets a registry of its own
+     */
     void detachChild(std::shared_ptr<SceneNode<Type>> item_to_detach)
     {
         auto iter = std::ranges::find(_children, item_to_detach);
@@ -110,16 +197,22 @@ public:
         {
             // Found!
             (*iter)->_parent.reset();
+            (*iter)->adoptRegistry( new SceneNodeRegistry<Type> );
             _children.erase(iter);
         }
     }
 
+    /** Adds the given SceneNode to the list of children
+     * 
+     *  @note The attached subtree moves into the registry of this node
+     */
     void attachChild(std::shared_ptr<SceneNode<Type>> node)
     {
         assert( std::ranges::find(_children, node) == _children.end() ); // It is currently not in the list of children!
 
         _children.push_back( node );
         node->_parent = this->weak_from_this();
+        node->adoptRegistry( _registry );
     }
 
     Math::Vector3D<Type> localToWorld(const Math::Vector3D<Type> &local_coordinate) const
@@ -157,14 +250,48 @@ private:
     Math::DualQuaternion<Type>     _coordinate_system;
     std::weak_ptr<SceneNode<Type>> _parent;
     SceneNodeList<Type>            _children;
-    std::string                    _name;
+    SceneNodeRegistry<Type>       *_registry = nullptr; // Shared by the whole tree, which frees it with its last node
+    std::uint64_t                  _version = 0;
+    NameId                         _name_id = SceneNodeRegistry<Type>::empty_name();
+
+    /** Removes this node from its registry, freeing the registry if this was its last node */
+    void leaveRegistry()
+    {
+        _registry->remove( _name_id, this );
+
+        if ( _registry->nodeCount() == 0 )
+            delete _registry;
+        _registry = nullptr;
+    }
+
+    /** Moves this node and all of its descendants into @p new_registry
+     * 
+     *  @note The name is re-interned in the new registry
+     */
+    void adoptRegistry(SceneNodeRegistry<Type> *new_registry)
+    {
+        if ( _registry == new_registry )
+            return;
+
+        NameId new_name_id = new_registry->intern( name() );
+
+        new_registry->add( new_name_id, this );
+        leaveRegistry();
+        _registry = new_registry;
+        _version  = _registry->nextVersion();
+        _name_id  = new_name_id;
+
+        for (auto &child : _children)
+            child->adoptRegistry( new_registry );
+    }
 
     static std::shared_ptr<SceneNode<Type>> make(std::weak_ptr<SceneNode<Type>> parent,
+                                                 SceneNodeRegistry<Type>        *registry,
                                                  const Math::Vector3D<Type>     &translation,
                                                  const Math::Quaternion<Type>   &rotation,
-                                                 const std::string        &name)
+                                                 const NameId                    name_id)
     {
-        return std::make_shared<SceneNode<Type>>(Private{}, parent, translation, rotation, name);
+        return std::make_shared<SceneNode<Type>>(Private{}, parent, registry, translation, rotation, name_id);
     }
 };
 
@@ -0,0 +1,273 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+
+/** @file
+ *
+ *  Contains the definition of the SceneNodeRegistry class
+ *
+ *  @hideincludegraph
+ */
+
+template <class T> class SceneNode;
+
+/** Interns the names of, and indexes, every SceneNode of a single hierarchy
+ *
+ *  Every SceneNode belongs to exactly one registry, which is shared by all
+ *  the nodes of the same tree.  The registry owns the text of every name used
+ *  in the tree and hands out small integer ids for them, so that a node only
+ *  needs to store a 4-byte id instead of a whole std::string.  Names that are
+ *  repeated across a hierarchy (e.g. "hand" in every skeleton) are stored once.
+ *
+ *  Nodes only keep a plain pointer back to their registry.  The registry counts
+ *  the nodes that belong to it and SceneNode frees it along with the last one,
+ *  so it lives exactly as long as some node of the tree does.
+ *
+ *  The SceneNode class keeps the index up to date when nodes are created,
+ *  renamed, attached, detached or destroyed, so looking up a node by name is a
+ *  single hash lookup instead of a walk of the hierarchy.
+ *
+ *  It also keeps the version counter of the hierarchy, which SceneNode uses to
+ *  record when each node's transform was last changed.  Nothing here is
+ *  synchronized, so a hierarchy must not be changed by one thread while
+ *  another one uses it.
+ *
+ *  @note Nodes with an empty name are not indexed.
+ *  @note Names do not need to be unique.  All nodes sharing a name are kept
+ *        in the order they were registered.
+ *  @note A name is released when the last node using it is renamed, moved to
+ *        another hierarchy or destroyed, and its id is then reused for the next
+ *        new name.  The table only holds the names that are in use.
+ *
+ *  @headerfile "math/SceneNodeRegistry.hpp"
+ */
+template <class Type>
+class SceneNodeRegistry
+{
+public:
+    using Node   = SceneNode<Type>;
+    using NameId = std::uint32_t;
+
+    /// The id of the empty name
+    constexpr static NameId empty_name() { return 0; }
+
+    SceneNodeRegistry()
+    {
+        intern( std::string_view{} );
+    }
+
+    SceneNodeRegistry(const SceneNodeRegistry &) = delete;
+    SceneNodeRegistry &operator =(const SceneNodeRegistry &) = delete;
+
+    /** @name Names
+     *  @{
+     */
+    /** Gets the id of @p name, adding it to the registry if it is not already there
+     *
+     *  @post name( output ) == @p name
+     *
+     *  @note A new name is released again by the first remove() that leaves it without
+     *        nodes, so add() a node with it right away.
+     */
+    NameId intern(std::string_view name)
+    {
+        auto iter = _ids.find( name );
+
+        if ( iter != _ids.end() )
+            return iter->second;
+
+        NameId new_id;
+
+        if ( !_free_ids.empty() )
+        {
+            new_id = _free_ids.back();
+            _free_ids.pop_back();
+        }
+        else
+        {
+            assert( _names.size() < std::numeric_limits<NameId>::max() );
+
+            new_id = static_cast<NameId>( _names.size() );
+            _names.push_back( nullptr );
+            _nodes_by_name.emplace_back();
+        }
+
+        iter = _ids.emplace( std::string{ name }, new_id ).first;
+        _names[new_id] = &iter->first;
+        return new_id;
+    }
+
+    /** Gets the id of @p name without adding it
+     *
+     *  @return The id, or @c std::nullopt if the name has never been interned
+     */
+    std::optional<NameId> idOf(std::string_view name) const
+    {
+        auto iter = _ids.find( name );
+
+        if ( iter == _ids.end() )
+            return std::nullopt;
+        return iter->second;
+    }
+
+    /** Gets the text of a name from its id
+     *
+     *  @pre @p id was returned by intern()
+     */
+    std::string_view name(NameId id) const
+    {
+        assert( id < _names.size() && _names[id] );
+
+        return *_names[id];
+    }
+
+    /// The number of distinct names in use, including the empty one
+    std::size_t nameCount() const { return _ids.size(); }
+
+    /// One more than the largest id handed out so far, for tables indexed by NameId
+    std::size_t nameIdLimit() const { return _names.size(); }
+    /// @}
+
+    /** @name Lookup
+     *  @{
+     */
+    /** Looks up all the nodes with the given @p name
+     *
+     *  @param name The name to look for
+     *
+     *  @return The matching nodes, or an empty span if there are none
+     *
+     *  @note The returned span is invalidated by any change to the hierarchy
+     */
+    std::span<Node * const> find(std::string_view name) const
+    {
+        std::optional<NameId> id{ idOf( name ) };
+
+        if ( !id )
+            return {};
+        return find( *id );
+    }
+
+    /** Looks up all the nodes with the given name @p id
+     *
+     *  @note The returned span is invalidated by any change to the hierarchy
+     */
+    std::span<Node * const> find(NameId id) const
+    {
+        if ( id == empty_name() )
+            return {};
+        return _nodes_by_name[id];
+    }
+
+    /** Looks up the first node registered with the given @p name
+     *
+     *  @return The node or @c nullptr if there is none
+     */
+    Node *findFirst(std::string_view name) const
+    {
+        std::span<Node * const> matches{ find( name ) };
+
+        return matches.empty() ? nullptr : matches.front();
+    }
+
+    /// The number of named nodes in the registry
+    std::size_t size() const { return _size; }
+
+    bool empty() const { return _size == 0; }
+
+    /// The number of nodes in the registry, named or not
+    std::size_t nodeCount() const { return _node_count; }
+    /// @}
+
+    /** @name Change Tracking
+     *  @{
+     */
+    /// The version of the most recent change to any node of the hierarchy
+    std::uint64_t version() const { return _version; }
+
+    /** Advances the version of the hierarchy for a new change
+     *
+     *  @note This is called by SceneNode and is not meant to be called by the user.
+     */
+    std::uint64_t nextVersion() { return ++_version; }
+    /// @}
+
+    /** @name Maintenance
+     *
+     *  @note These are called by SceneNode and are not meant to be called by the user.
+     *
+     *  @{
+     */
+    void add(NameId id, Node *node)
+    {
+        ++_node_count;
+
+        if ( id == empty_name() )
+            return;
+
+        _nodes_by_name[id].push_back( node );
+        ++_size;
+    }
+
+    /// Releases the name @p id when @p node was the last one using it
+    void remove(NameId id, const Node *node)
+    {
+        assert( _node_count > 0 );
+
+        --_node_count;
+
+        if ( id == empty_name() )
+            return;
+
+        std::vector<Node *> &nodes{ _nodes_by_name[id] };
+        auto                 found = std::ranges::find( nodes, node );
+
+        if ( found == nodes.end() )
+            return;
+
+        nodes.erase( found );
+        --_size;
+
+        if ( nodes.empty() )
+            release( id );
+    }
+    /// @}
+private:
+    /** Hashes anything convertible to a std::string_view
+     *
+     *  @note This enables heterogeneous lookup so that no std::string
+     *        needs to be constructed just to do a find().
+     */
+    struct NameHash
+    {
+        using is_transparent = void;
+
+        std::size_t operator()(std::string_view name) const { return std::hash<std::string_view>{}( name ); }
+    };
+
+    std::unordered_map<std::string, NameId, NameHash, std::equal_to<>> _ids;
+    std::vector<const std::string *>                                    _names;         // Indexed by NameId.  Points at the keys of _ids, which never move, or is null once released.
+    std::vector<std::vector<Node *>>                                    _nodes_by_name; // Indexed by NameId
+    std::vector<NameId>                                                 _free_ids;      // Released ids, for reuse
+    std::size_t                                                         _size = 0;
+    std::size_t                                                         _node_count = 0;
+    std::uint64_t                                                       _version = 0;
+
+    void release(NameId id)
+    {
+        _ids.erase( _ids.find( std::string_view{ *_names[id] } ) );
+        _names[id] = nullptr;
+        _free_ids.push_back( id );
+    }
+};
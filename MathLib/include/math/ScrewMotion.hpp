@@ -0,0 +1,179 @@
+#pragma once
+
+#include "math/DualQuaternion.hpp"
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <span>
+
+/** @file
+ *
+ *  Contains functions for treating rigid transformations as screw motions
+ *
+ *  @hideincludegraph
+ */
+
+namespace Math
+{
+
+/** @addtogroup ScrewMotion Screw Motion
+ *
+ *  Every rigid transformation is a rotation about some line in space combined with a
+ *  translation along that same line.  The line is given by its direction (the axis) and
+ *  its moment, and the motion by the angle of the rotation and the distance along the
+ *  line (the pitch).
+ *
+ *  Scaling the angle and the pitch by the same amount gives the constant velocity motion
+ *  that screw linear interpolation (ScLERP) follows.
+ *
+ *  @{
+ */
+
+/** The screw parameters of a rigid transformation
+ *
+ *  @headerfile "math/ScrewMotion.hpp"
+ */
+template <class T>
+struct ScrewParameters
+{
+    Vector3D<T> axis{ T{1}, T{}, T{} }; ///< The unit direction of the line
+    Vector3D<T> moment{};                ///< The moment of the line about the origin.  Always perpendicular to @c axis.
+    T           angle{};                 ///< The rotation about the line, in radians
+    T           pitch{};                 ///< The translation along the line
+};
+
+/** Extracts the screw parameters of a unit DualQuaternion
+ *
+ *  @pre @p transform is a unit DualQuaternion
+ *
+ *  @note The output angle is within [0, 2 pi].  Negate @p transform first to get the
+ *        shortest motion when its real part is negative.
+ *  @note Only rotations whose half angle has a sine of zero, or too small to be a normal
+ *        @p T, are treated as pure translations, for which the axis is the direction of the
+ *        translation (or the X axis when there is none).  Every other rotation is kept, however
+ *        small, so that from_screw_parameters() gives back @p transform.  The moment of a small
+ *        rotation is large, as its axis is far from the origin.
+ */
+template <class T>
+ScrewParameters<T> to_screw_parameters(const DualQuaternion<T> &transform)
+{
+    const Quaternion<T> &real{ transform.real() };
+    const Quaternion<T> &dual{ transform.dual() };
+    const T              sin_half_angle{ real.imaginary().magnitude() };
+    ScrewParameters<T>   screw;
+
+    if ( sin_half_angle < std::numeric_limits<T>::min() )
+    {
+        const Vector3D<T> translation{ transform.translation() };
+
+        screw.pitch = translation.magnitude();
+        if ( screw.pitch > T{0} )
+            screw.axis = translation / screw.pitch;
+        return screw;
+    }
+
+    const T half_pitch{ -dual.w() / sin_half_angle };
+
+    screw.angle  = T{2} * std::atan2( sin_half_angle, real.w() );
+    screw.pitch  = T{2} * half_pitch;
+    screw.axis   = real.imaginary() / sin_half_angle;
+    screw.moment = (dual.imaginary() - screw.axis * (half_pitch * real.w())) / sin_half_angle;
+    return screw;
+}
+
+/** Creates the unit DualQuaternion for @p screw with its angle and pitch scaled by @p amount
+ *
+ *  @note This takes one sincos()
+ */
+template <class T>
+DualQuaternion<T> from_screw_parameters(const ScrewParameters<T> &screw, const T amount = T{1})
+{
+    const SineCosine<T> half_angle{ sincos( Radian<T>{ T{0.5} * amount * screw.angle } ) };
+    const T             half_pitch{ T{0.5} * amount * screw.pitch };
+    const T             sin_half_angle{ half_angle.sin };
+    const T             cos_half_angle{ half_angle.cos };
+
+    const Vector3D<T> real_part{ screw.axis * sin_half_angle };
+    const Vector3D<T> dual_part{ screw.axis * (half_pitch * cos_half_angle) + screw.moment * sin_half_angle };
+
+    return DualQuaternion<T>{ Quaternion<T>{ cos_half_angle, real_part.x, real_part.y, real_part.z },
+                              Quaternion<T>{ -half_pitch * sin_half_angle, dual_part.x, dual_part.y, dual_part.z } };
+}
+
+
+/** Screw linear interpolation between two fixed transformations
+ *
+ *  The screw motion from the start to the end is worked out once, when the object is
+ *  created, so that each sample only costs one sincos() and one DualQuaternion
+ *  multiplication.  The samples move at a constant linear and angular velocity and take
+ *  the shortest way round.
+ *
+ *  @headerfile "math/ScrewMotion.hpp"
+ */
+template <class T>
+class ScrewInterpolation
+{
+public:
+    /** Prepares to interpolate from @p begin to @p end
+     *
+     *  @pre @p begin and @p end are unit DualQuaternions
+     */
+    ScrewInterpolation(const DualQuaternion<T> &begin, const DualQuaternion<T> &end)
+        :
+        _begin{ begin }
+    {
+        DualQuaternion<T> difference{ begin.conjugate() * end };
+
+        if ( difference.real().w() < T{0} )
+            difference = difference * T{-1};
+
+        _screw = to_screw_parameters( difference );
+    }
+
+    /// The screw motion from the start to the end, in the frame of the start
+    const ScrewParameters<T> &screw() const { return _screw; }
+
+    /** Samples the motion
+     *
+     *  @param percent [0..1] Represents the percentage to interpolate
+     */
+    DualQuaternion<T> operator()(const T percent) const
+    {
+        return _begin * from_screw_parameters( _screw, percent );
+    }
+
+    /** Samples the motion at each of @p percents
+     *
+     *  @pre @p output has room for as many samples as @p percents
+     */
+    void operator()(std::span<const T> percents, std::span<DualQuaternion<T>> output) const
+    {
+        assert( output.size() >= percents.size() );
+
+        const std::size_t count = percents.size();
+
+        for (std::size_t i = 0; i < count; ++i)
+            output[i] = (*this)( percents[i] );
+    }
+private:
+    DualQuaternion<T>  _begin;
+    ScrewParameters<T> _screw;
+};
+
+/** Calculates the Screw Linear Interpolation between two DualQuaternions
+ *
+ *  @param begin   Origin value
+ *  @param end     Destination value
+ *  @param percent [0..1] Represents the percentage to interpolate
+ *
+ *  @note Use a ScrewInterpolation when sampling between the same two values more than once
+ */
+template <class T>
+DualQuaternion<T> sclerp(const DualQuaternion<T> &begin, const DualQuaternion<T> &end, const T percent)
+{
+    return ScrewInterpolation<T>{ begin, end }( percent );
+}
+/// @}  {ScrewMotion}
+
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "math/FastMath.hpp"
 #include <cassert>
 #include <cmath>
 #include <numbers>
@@ -12,22 +13,30 @@
 namespace Math
 {
 
-template <class T>
-inline T unnormalized_sinc(T radians)
+/** Computes @f$ \frac{\sin x}{x} @f$
+ *
+ *  @tparam Policy Supplies the sine (see @ref MathPolicies)
+ */
+template <class Policy = StandardMath, class T>
+constexpr T unnormalized_sinc(T radians)
 {
     if ( radians == T{0} )
         return T{1};
     else
-        return sin(radians) / radians;
+        return Policy::sin(radians) / radians;
 }
 
-template <class T>
-inline T normalized_sinc(T radians)
+/** Computes @f$ \frac{\sin \pi x}{\pi x} @f$
+ *
+ *  @tparam Policy Supplies the sine (see @ref MathPolicies)
+ */
+template <class Policy = StandardMath, class T>
+constexpr T normalized_sinc(T radians)
 {
     if ( radians == T{0} )
         return T{1};
     else
-        return sin( std::numbers::pi_v<T> * radians) / (std::numbers::pi_v<T> * radians);
+        return Policy::sin( std::numbers::pi_v<T> * radians) / (std::numbers::pi_v<T> * radians);
 }
 
 }
\ No newline at end of file
@@ -116,7 +116,7 @@ struct Vector3D
          *  
          *  @return @c true if they are equal
          */
-        friend constexpr bool approximately_equal_to(const Ref &value_to_test, const Ref &value_it_should_be, const float tolerance = 0.0002f)
+        friend constexpr bool approximately_equal_to(const Ref &value_to_test, const Ref &value_it_should_be, const real_type_t<Type> tolerance = real_type_t<Type>{0.0002})
         {
             return approximately_equal_to(value_to_test.x, value_it_should_be.x, tolerance) &&
                    approximately_equal_to(value_to_test.y, value_it_should_be.y, tolerance) &&
@@ -211,7 +211,9 @@ struct Vector3D
          */
         friend constexpr Vector3D<Type> abs(const Ref &input)
         {
-            return Vector3D<Type>( std::abs(input.x), std::abs(input.y), std::abs(input.z) );
+            using std::abs;
+
+            return Vector3D<Type>( abs(input.x), abs(input.y), abs(input.z) );
         }
 
         /** Calculate the fractional part of all components of a Vector3D
@@ -273,7 +275,8 @@ struct Vector3D
     /// @}
 
     constexpr value_type normSquared() const { return (x * x) + (y * y) + (z * z); }
-    constexpr value_type norm() const { return std::sqrt( normSquared() ); } ///< @todo See if we need to use std::hypot()
+    /// @todo See if we need to use std::hypot()
+    constexpr value_type norm() const { return StandardMath::sqrt( normSquared() ); }
 
     constexpr value_type magnitudeSquared() const { return normSquared(); }
     constexpr value_type magnitude() const { return norm(); }
@@ -285,8 +288,8 @@ struct Vector3D
         return { x / n, y / n, z / n };
     }
 
-    bool isNaN() const { return std::isnan(x) || std::isnan(y) || std::isnan(z); }
-    bool isInf() const { return std::isinf(x) || std::isinf(y) || std::isinf(z); }
+    bool isNaN() const { return std::isnan( value_of(x) ) || std::isnan( value_of(y) ) || std::isnan( value_of(z) ); }
+    bool isInf() const { return std::isinf( value_of(x) ) || std::isinf( value_of(y) ) || std::isinf( value_of(z) ); }
 
     /** @name Swizzle operations
      *  @{
@@ -360,7 +363,7 @@ struct Vector3D
      *  
      *  @return @c true if they are equal
      */
-    friend constexpr bool approximately_equal_to(const Vector3D<Type> &value_to_test, const Vector3D<Type> &value_it_should_be, const float tolerance = 0.0002f)
+    friend constexpr bool approximately_equal_to(const Vector3D<Type> &value_to_test, const Vector3D<Type> &value_it_should_be, const real_type_t<Type> tolerance = real_type_t<Type>{0.0002})
     {
         return approximately_equal_to(value_to_test.x, value_it_should_be.x, tolerance) &&
                approximately_equal_to(value_to_test.y, value_it_should_be.y, tolerance) &&
@@ -498,9 +501,9 @@ struct Vector3D
      */
     friend constexpr Vector3D<Type> cross(const Vector3D<Type> &left, const Vector3D<Type> &right)
     {
-        return Vector3D<Type>{ cross( left.yz(), right.yz() ),
-                               cross( left.zx(), right.zx() ),
-                               cross( left.xy(), right.xy() ) };
+        return Vector3D<Type>{ left.y * right.z - left.z * right.y,
+                               left.z * right.x - left.x * right.z,
+                               left.x * right.y - left.y * right.x };
     }
 
     /** Creates the normalized form of a Vector3D
@@ -522,7 +525,9 @@ struct Vector3D
      */
     friend constexpr Vector3D<Type> abs(const Vector3D<Type> &input)
     {
-        return Vector3D<Type>( std::abs(input.x), std::abs(input.y), std::abs(input.z) );
+        using std::abs;
+
+        return Vector3D<Type>( abs(input.x), abs(input.y), abs(input.z) );
     }
 
     /** Calculate the fractional part of all components of a Vector3D
@@ -559,7 +564,7 @@ struct Vector3D
      * 
      *  @return @c true if the two are equal within @c tolerance , @c false otherwise
      */
-    friend bool check_if_equal(const Vector3D<Type> &input, const Vector3D<Type> &near_to, float tolerance = 0.0002f)
+    friend bool check_if_equal(const Vector3D<Type> &input, const Vector3D<Type> &near_to, real_type_t<Type> tolerance = real_type_t<Type>{0.0002})
     {
         if (!approximately_equal_to(input, near_to, tolerance))
         {
@@ -586,7 +591,7 @@ struct Vector3D
      * 
      *  @return @c true if the two are not equal outside @c tolerance , @c false otherwise
      */
-    friend bool check_if_not_equal(const Vector3D<Type> &input, const Vector3D<Type> &near_to, float tolerance = 0.0002f)
+    friend bool check_if_not_equal(const Vector3D<Type> &input, const Vector3D<Type> &near_to, real_type_t<Type> tolerance = real_type_t<Type>{0.0002})
     {
         if (approximately_equal_to(input, near_to, tolerance))
         {
@@ -603,17 +608,17 @@ struct Vector3D
         return true;
     }
 
-    friend void CHECK_IF_EQUAL(const Vector3D<Type> &input, const Vector3D<Type> &near_to, const float tolerance = 0.0002f)
+    friend void CHECK_IF_EQUAL(const Vector3D<Type> &input, const Vector3D<Type> &near_to, const real_type_t<Type> tolerance = real_type_t<Type>{0.0002})
     {
         assert( check_if_equal(input, near_to, tolerance) );
     }
 
-    friend void CHECK_IF_NOT_EQUAL(const Vector3D<Type> &input, const Vector3D<Type> &near_to, const float tolerance = 0.0002f)
+    friend void CHECK_IF_NOT_EQUAL(const Vector3D<Type> &input, const Vector3D<Type> &near_to, const real_type_t<Type> tolerance = real_type_t<Type>{0.0002})
     {
         assert( check_if_not_equal(input, near_to, tolerance) );
     }
 
-    friend void CHECK_IF_ZERO(const Vector3D<Type> &input, const float tolerance = 0.0002f)
+    friend void CHECK_IF_ZERO(const Vector3D<Type> &input, const real_type_t<Type> tolerance = real_type_t<Type>{0.0002})
     {
         assert( check_if_equal(input, Vector3D<Type>::zero(), tolerance));
     }